@@ -9,86 +9,465 @@
 #include <sstream>
 #include <iostream>
 #include <unistd.h>
+#include <getopt.h> // getopt_long
 #include <cstdint>  // uint32_t
+#include <vector>   // vector
+#include <filesystem> // create_directories
+#include <chrono>   // steady_clock
 
 
 #include "src/data_worker.hpp"
-#include "src/huffman/huffman_coder.hpp"
-#include "src/huffman/huffman_decoder.hpp"
-#include "src/rle/rle_compressor.hpp"
-#include "src/rle/rle_decompressor.hpp"
+#include "src/image_codec.hpp"
+#include "src/container.hpp"
+#include "src/frames/frames_compressor.hpp"
+#include "src/frames/frames_decompressor.hpp"
+#include "src/archive/archive_compressor.hpp"
+#include "src/archive/archive_decompressor.hpp"
+#include "src/preview/preview_compressor.hpp"
+#include "src/preview/preview_decompressor.hpp"
+#include "src/progressive/progressive_compressor.hpp"
+#include "src/progressive/progressive_decompressor.hpp"
+#include "src/checksum/block_checksum.hpp"
+#include "src/selector/pipeline_selector.hpp"
+#include "src/tiles/tiles_compressor.hpp"
+#include "src/tiles/tiles_decompressor.hpp"
+#include "src/compression_level.hpp"
+#include "src/profile/compression_profile.hpp"
+#include "src/stats/codec_stats.hpp"
+#include "src/stats/trace_recorder.hpp"
+
+// Values of options, that does not have short variant
+constexpr int OPT_MAX_ERROR = 256;
+constexpr int OPT_FRAMES = 257;
+constexpr int OPT_KEY_INTERVAL = 258;
+constexpr int OPT_KEY_REFERENCE = 259;
+constexpr int OPT_FRAME = 260;
+constexpr int OPT_ARCHIVE = 261;
+constexpr int OPT_SHARED_MODEL = 262;
+constexpr int OPT_MEMBER = 263;
+constexpr int OPT_PREVIEW = 264;
+constexpr int OPT_PREVIEW_SCALE = 265;
+constexpr int OPT_PROGRESSIVE = 266;
+constexpr int OPT_LEVELS = 267;
+constexpr int OPT_LEVEL = 268;
+constexpr int OPT_VERIFY = 269;
+constexpr int OPT_NO_CHECKSUM = 270;
+constexpr int OPT_INFO = 271;
+constexpr int OPT_COMPARE = 272;
+constexpr int OPT_AUTO = 273;
+constexpr int OPT_DEADLINE = 274;
+constexpr int OPT_PROFILE = 275;
+constexpr int OPT_STATS = 276;
+constexpr int OPT_TRACE = 277;
+constexpr int OPT_THREADS = 278;
 
 /**
- * Function will parse arguments and assign their values to given variables
+ * Settings of program, given by arguments
+ * @param compress_decompress True when param -c is present or false when -d is present
+ * @param input_preprocessing True when param -m is present, false otherwise
+ * @param adaptive_sequence_scanning True when param -a is present, false otherwise
+ * @param quadtree_coding True when param -q is present, false otherwise
+ * @param bwt_transform True when param -b is present, false otherwise
+ * @param bwt_block_size Number specified in -s param, BWT_DEFAULT_BLOCK_SIZE otherwise
+ * @param max_error Number specified in --max-error param, 0 (lossless) otherwise
+ * @param frames Number specified in --frames param, 0 (single image) otherwise
+ * @param key_interval Number specified in --key-interval param, FRAMES_DEFAULT_KEY_INTERVAL otherwise
+ * @param key_reference True when param --key-reference is present, false otherwise
+ * @param frame Number specified in --frame param, -1 (all frames) otherwise
+ * @param archive True when param --archive is present, false otherwise
+ * @param shared_model True when param --shared-model is present, false otherwise
+ * @param member Index or name of member specified in --member param, empty (all members) otherwise
+ * @param preview True when param --preview is present, false otherwise
+ * @param preview_scale Number specified in --preview-scale param, PREVIEW_DEFAULT_SCALE otherwise
+ * @param progressive True when param --progressive is present, false otherwise
+ * @param levels Number specified in --levels param, PROGRESSIVE_DEFAULT_LEVELS otherwise
+ * @param level Number specified in --level param, 0 (full resolution) otherwise
+ * @param verify True when param --verify is present, false otherwise
+ * @param checksum False when param --no-checksum is present, true otherwise
+ * @param info True when param --info is present, false otherwise
+ * @param test True when param -t is present, false otherwise
+ * @param compare_file Name of raw image given by --compare, that decompressed image is compared with
+ * @param auto_select True when param --auto is present, false otherwise
+ * @param compression_level Number of param -1 to -9, 0 when no level is given
+ * @param static_huffman True when given level uses static huffman code, false otherwise
+ * @param deadline_ms Number specified in --deadline-ms param, 0 (no deadline) otherwise
+ * @param threads Number specified in --threads param, 0 otherwise (one thread, or threads of profile mode)
+ * @param profile_file Name of profile specified in --profile param, empty (no profile) otherwise
+ * @param stats Format specified in --stats param (text or json), empty (no stats) otherwise
+ * @param trace_file Name of trace specified in --trace param, empty (no trace) otherwise
+ * @param input_file Name of file specified in last -i param
+ * @param input_files Names of files specified in all -i params
+ * @param output_file Name of file specified in -o param
+ * @param width Number specified in -w param
+ * @param help True when -h argument is present
+ * */
+typedef struct Arguments {
+  bool compress_decompress;
+  bool input_preprocessing;
+  bool adaptive_sequence_scanning;
+  bool quadtree_coding;
+  bool bwt_transform;
+  uint32_t bwt_block_size;
+  uint8_t max_error;
+  uint32_t frames;
+  uint32_t key_interval;
+  bool key_reference;
+  int64_t frame;
+  bool archive;
+  bool shared_model;
+  std::string member;
+  bool preview;
+  uint8_t preview_scale;
+  bool progressive;
+  uint8_t levels;
+  uint8_t level;
+  bool verify;
+  bool checksum;
+  bool info;
+  bool test;
+  std::string compare_file;
+  bool auto_select;
+  uint8_t compression_level;
+  bool static_huffman;
+  uint32_t deadline_ms;
+  uint32_t threads;
+  std::string profile_file;
+  std::string stats;
+  std::string trace_file;
+  std::string input_file;
+  std::vector<std::string> input_files;
+  std::string output_file;
+  uint32_t width;
+  bool help;
+} Arguments;
+
+/**
+ * Function will parse arguments and assign their values to given structure
  * @param[in] argc Number of arguments
  * @param[in] argv Array of arguments
- * @param[out] compress_decompress Set to true when param -c is present or false when -d is present,
- * @param[out] input_preprocessing Set to true when param -m is present, false otherwise
- * @param[out] adaptive_sequence_scanning Set to true when param -a is present, false otherwise
- * @param[out] input_file Set to name of file specified in -i param
- * @param[out] output_file Set to name of file specified in -o param
- * @param[out] input_width Set to number specified in -w param
- * @param[out] help Set to true when -h argument is present
+ * @param[out] arguments Structure holding values of all arguments
  * @return True when all arguments were rightly formatted, false otherwise
  **/
-bool parse_arguments(
-  const int &argc,
-  char* argv[],
-  bool &compress_decompress,
-  bool &input_preprocessing,
-  bool &adaptive_sequence_scanning,
-  std::string &input_file,
-  std::string &output_file,
-  uint32_t &input_width,
-  bool &help
-) {
+bool parse_arguments(const int &argc, char* argv[], Arguments &arguments) {
   // -c, -d are mandatory, used for checking if one of them was set
   bool compress_decompress_set = false;
 
   // Set default values before looping through arguments
-  input_preprocessing = false;
-  adaptive_sequence_scanning = false;
-  input_file = "";
-  output_file = "";
-  input_width = 0;
+  arguments.input_preprocessing = false;
+  arguments.adaptive_sequence_scanning = false;
+  arguments.quadtree_coding = false;
+  arguments.bwt_transform = false;
+  arguments.bwt_block_size = BWT_DEFAULT_BLOCK_SIZE;
+  arguments.max_error = 0;
+  arguments.frames = 0;
+  arguments.key_interval = FRAMES_DEFAULT_KEY_INTERVAL;
+  arguments.key_reference = false;
+  arguments.frame = -1;
+  arguments.archive = false;
+  arguments.shared_model = false;
+  arguments.member = "";
+  arguments.preview = false;
+  arguments.preview_scale = PREVIEW_DEFAULT_SCALE;
+  arguments.progressive = false;
+  arguments.levels = PROGRESSIVE_DEFAULT_LEVELS;
+  arguments.level = 0;
+  arguments.verify = false;
+  arguments.checksum = true;
+  arguments.info = false;
+  arguments.test = false;
+  arguments.compare_file = "";
+  arguments.auto_select = false;
+  arguments.compression_level = 0;
+  arguments.static_huffman = false;
+  arguments.deadline_ms = 0;
+  arguments.threads = 0;
+  arguments.profile_file = "";
+  arguments.stats = "";
+  arguments.trace_file = "";
+  arguments.input_file = "";
+  arguments.output_file = "";
+  arguments.width = 0;
+  arguments.help = false;
 
   int opt;
 
+  // Options without short variant
+  const struct option long_options[] = {
+    {"max-error", required_argument, nullptr, OPT_MAX_ERROR},
+    {"frames", required_argument, nullptr, OPT_FRAMES},
+    {"key-interval", required_argument, nullptr, OPT_KEY_INTERVAL},
+    {"key-reference", no_argument, nullptr, OPT_KEY_REFERENCE},
+    {"frame", required_argument, nullptr, OPT_FRAME},
+    {"archive", no_argument, nullptr, OPT_ARCHIVE},
+    {"shared-model", no_argument, nullptr, OPT_SHARED_MODEL},
+    {"member", required_argument, nullptr, OPT_MEMBER},
+    {"preview", no_argument, nullptr, OPT_PREVIEW},
+    {"preview-scale", required_argument, nullptr, OPT_PREVIEW_SCALE},
+    {"progressive", no_argument, nullptr, OPT_PROGRESSIVE},
+    {"levels", required_argument, nullptr, OPT_LEVELS},
+    {"level", required_argument, nullptr, OPT_LEVEL},
+    {"verify", no_argument, nullptr, OPT_VERIFY},
+    {"no-checksum", no_argument, nullptr, OPT_NO_CHECKSUM},
+    {"info", no_argument, nullptr, OPT_INFO},
+    {"compare", required_argument, nullptr, OPT_COMPARE},
+    {"auto", no_argument, nullptr, OPT_AUTO},
+    {"deadline-ms", required_argument, nullptr, OPT_DEADLINE},
+    {"profile", required_argument, nullptr, OPT_PROFILE},
+    {"stats", optional_argument, nullptr, OPT_STATS},
+    {"trace", required_argument, nullptr, OPT_TRACE},
+    {"threads", required_argument, nullptr, OPT_THREADS},
+    {nullptr, 0, nullptr, 0}
+  };
+
   // Loop through all arguments
-  while ((opt = getopt(argc, argv, ":cdmaw:i:o:h")) != -1) {
+  while ((opt = getopt_long(argc, argv, ":cdtmaqbs:w:i:o:h123456789", long_options, nullptr)) != -1) {
     switch (opt) {
       // Compress argument
       case 'c':
-        compress_decompress = true;
+        arguments.compress_decompress = true;
         compress_decompress_set = true;
         break;
       // Decompress argument
       case 'd':
-        compress_decompress = false;
+        arguments.compress_decompress = false;
         compress_decompress_set = true;
         break;
       // Model preprocessing of image argument
       case 'm':
-        input_preprocessing = true;
+        arguments.input_preprocessing = true;
         break;
       // Adaptive scanning in RLE argument
       case 'a':
-        adaptive_sequence_scanning = true;
+        arguments.adaptive_sequence_scanning = true;
+        break;
+      // Quadtree coding of uniform blocks argument
+      case 'q':
+        arguments.quadtree_coding = true;
+        break;
+      // BWT with MTF before huffman argument
+      case 'b':
+        arguments.bwt_transform = true;
+        break;
+      // Size of BWT block argument
+      case 's':
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.bwt_block_size;
+          if (arguments.bwt_block_size < 1 || arguments.bwt_block_size > BWT_MAX_BLOCK_SIZE) {
+            std::cerr << "BWT block size, needs to be from 1 to " << BWT_MAX_BLOCK_SIZE << "!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      // Maximum error of each pixel argument
+      case OPT_MAX_ERROR:
+        {
+          uint32_t max_error = 0;
+          std::stringstream sstream(optarg);
+          sstream >> max_error;
+          if (sstream.fail() || max_error > NEAR_LOSSLESS_MAX_ERROR) {
+            std::cerr << "Maximum error, needs to be from 0 to " << static_cast<uint32_t>(NEAR_LOSSLESS_MAX_ERROR) << "!" << std::endl;
+            return false;
+          }
+          arguments.max_error = static_cast<uint8_t>(max_error);
+
+          // Quantized residuals are always computed from prediction
+          arguments.input_preprocessing = (arguments.input_preprocessing || max_error > 0);
+        }
+        break;
+      // Number of frames stacked in input image argument
+      case OPT_FRAMES:
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.frames;
+          if (sstream.fail() || arguments.frames < 1) {
+            std::cerr << "Number of frames, needs to be >= 1!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      // Number of frames between key frames argument
+      case OPT_KEY_INTERVAL:
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.key_interval;
+          if (sstream.fail() || arguments.key_interval < 1) {
+            std::cerr << "Key frame interval, needs to be >= 1!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      // Code frames as difference from key frame argument
+      case OPT_KEY_REFERENCE:
+        arguments.key_reference = true;
+        break;
+      // Decompress only one frame argument
+      case OPT_FRAME:
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.frame;
+          if (sstream.fail() || arguments.frame < 0 || arguments.frame > UINT32_MAX) {
+            std::cerr << "Index of frame, needs to be from 0 to " << UINT32_MAX << "!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      // Pack input images into archive argument
+      case OPT_ARCHIVE:
+        arguments.archive = true;
+        break;
+      // Share huffman model between archive members argument
+      case OPT_SHARED_MODEL:
+        arguments.shared_model = true;
+        break;
+      // Decompress only one archive member argument
+      case OPT_MEMBER:
+        arguments.member = optarg;
+        break;
+      // Save preview when compressing, or decompress only preview argument
+      case OPT_PREVIEW:
+        arguments.preview = true;
+        break;
+      // Size of block averaged into one pixel of preview argument
+      case OPT_PREVIEW_SCALE:
+        {
+          uint32_t preview_scale = 0;
+          std::stringstream sstream(optarg);
+          sstream >> preview_scale;
+          if (sstream.fail() || preview_scale < 1 || preview_scale > UINT8_MAX) {
+            std::cerr << "Preview scale, needs to be from 1 to " << UINT8_MAX << "!" << std::endl;
+            return false;
+          }
+          arguments.preview_scale = static_cast<uint8_t>(preview_scale);
+          arguments.preview = true;
+        }
+        break;
+      // Resolution progressive pyramid argument
+      case OPT_PROGRESSIVE:
+        arguments.progressive = true;
+        break;
+      // Number of levels of pyramid argument
+      case OPT_LEVELS:
+        {
+          uint32_t levels = 0;
+          std::stringstream sstream(optarg);
+          sstream >> levels;
+          if (sstream.fail() || levels < 1 || levels > PROGRESSIVE_MAX_LEVELS) {
+            std::cerr << "Number of levels, needs to be from 1 to " << static_cast<uint32_t>(PROGRESSIVE_MAX_LEVELS) << "!" << std::endl;
+            return false;
+          }
+          arguments.levels = static_cast<uint8_t>(levels);
+          arguments.progressive = true;
+        }
+        break;
+      // Decompress only up to given level argument
+      case OPT_LEVEL:
+        {
+          uint32_t level = 0;
+          std::stringstream sstream(optarg);
+          sstream >> level;
+          if (sstream.fail() || level >= PROGRESSIVE_MAX_LEVELS) {
+            std::cerr << "Level, needs to be from 0 to " << (PROGRESSIVE_MAX_LEVELS - 1) << "!" << std::endl;
+            return false;
+          }
+          arguments.level = static_cast<uint8_t>(level);
+          arguments.progressive = true;
+        }
+        break;
+      // Only check checksums of file argument
+      case OPT_VERIFY:
+        arguments.verify = true;
+        break;
+      // Decompress without writing output argument
+      case 't':
+        arguments.test = true;
+        break;
+      // Raw image compared with decompressed image argument
+      case OPT_COMPARE:
+        arguments.compare_file = optarg;
+        break;
+      // Choose pipeline from sample of image argument
+      case OPT_AUTO:
+        arguments.auto_select = true;
+        break;
+      // Only print header of file argument
+      case OPT_INFO:
+        arguments.info = true;
+        break;
+      // Do not save checksums argument
+      case OPT_NO_CHECKSUM:
+        arguments.checksum = false;
+        break;
+      // Time budget of compression argument
+      case OPT_DEADLINE:
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.deadline_ms;
+          if (sstream.fail() || arguments.deadline_ms < 1) {
+            std::cerr << "Deadline, needs to be >= 1 ms!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      // Profile with modes found by tuning argument
+      case OPT_PROFILE:
+        arguments.profile_file = optarg;
+        break;
+      // Print time and sizes of stages argument
+      case OPT_STATS:
+        arguments.stats = (optarg != nullptr) ? optarg : "text";
+        if (arguments.stats != "text" && arguments.stats != "json") {
+          std::cerr << "Format of stats, needs to be text or json!" << std::endl;
+          return false;
+        }
+        break;
+      // Save trace of stages, blocks and I/O argument
+      case OPT_TRACE:
+        arguments.trace_file = optarg;
+        break;
+      // Number of threads coding tiles argument, 0 for all hardware threads
+      case OPT_THREADS:
+        {
+          int64_t threads = 0;
+          std::stringstream sstream(optarg);
+          sstream >> threads;
+          if (sstream.fail() || threads < 0 || threads > TILE_WORKERS_MAX_THREADS) {
+            std::cerr << "Number of threads, needs to be from 0 to " << TILE_WORKERS_MAX_THREADS << "!" << std::endl;
+            return false;
+          }
+          arguments.threads = static_cast<uint32_t>(threads);
+          if (arguments.threads == 0) {
+            arguments.threads = TileWorkers::GetHardwareThreads();
+          }
+        }
         break;
-      // Input image argument
+      // Compression level argument
+      case '1':
+      case '2':
+      case '3':
+      case '4':
+      case '5':
+      case '6':
+      case '7':
+      case '8':
+      case '9':
+        arguments.compression_level = static_cast<uint8_t>(opt - '0');
+        break;
+      // Input image argument, archive can be given more of them
       case 'i':
-        input_file = optarg;
+        arguments.input_file = optarg;
+        arguments.input_files.push_back(optarg);
         break;
       // Output image argument
       case 'o':
-        output_file = optarg;
+        arguments.output_file = optarg;
         break;
       // Width of image argument
       case 'w':
         {
           std::stringstream sstream(optarg);
-          sstream >> input_width;
-          if (input_width < 1) {
+          sstream >> arguments.width;
+          if (arguments.width < 1) {
             std::cerr << "Input width, needs to be >= 1!" << std::endl;
             return false;
           }
@@ -96,8 +475,8 @@ bool parse_arguments(
         break;
       // Helo argument
       case 'h':
-        // Print out help and exit
-        help = true;
+        // Print out arguments.help and exit
+        arguments.help = true;
         return true;
         break;
 
@@ -111,33 +490,130 @@ bool parse_arguments(
     }
   }
 
-  // Check we -c or -d were set
-  if (!compress_decompress_set) {
+  // Test without -c decompresses given file
+  if (arguments.test && !compress_decompress_set) {
+    arguments.compress_decompress = false;
+    compress_decompress_set = true;
+  }
+
+  // Only decompressed image can be compared
+  if (arguments.compare_file != "" && !(arguments.test && !arguments.compress_decompress)) {
+    std::cerr << "Param --compare requires param -t without -c!" << std::endl;
+    return false;
+  }
+
+  // Check we -c or -d were set, verifying and printing header needs neither of them
+  const bool read_only = (arguments.verify || arguments.info);
+  if (!compress_decompress_set && !read_only) {
     std::cerr << "Param -c or -d are mandatory!" << std::endl;
     return false;
   }
 
+  // Verifying and printing header are separate modes, that only read input file
+  if (read_only && (compress_decompress_set || (arguments.verify && arguments.info))) {
+    std::cerr << "Params --verify and --info can not be combined with each other or with -c or -d!" << std::endl;
+    return false;
+  }
+
   // Check if we were given input file
-  if (input_file == "") {
+  if (arguments.input_file == "") {
     std::cerr << "Input file is mandatory!" << std::endl;
     return false;
   }
 
   // Check if we were given output file
-  if (output_file == "") {
+  if (arguments.output_file == "" && !read_only && !(arguments.test && !arguments.compress_decompress)) {
     std::cerr << "Output file is mandatory!" << std::endl;
     return false;
   }
 
-  // When compressing, we require width
-  if (compress_decompress && input_width == 0) {
+  // More images can be compressed only into archive
+  if (arguments.input_files.size() > 1 && !(arguments.compress_decompress && arguments.archive)) {
+    std::cerr << "More input files are allowed only with params -c and --archive!" << std::endl;
+    return false;
+  }
+
+  // Archive members are single images
+  if (arguments.archive && arguments.frames > 0) {
+    std::cerr << "Param --archive can not be combined with --frames!" << std::endl;
+    return false;
+  }
+
+  // Deadline chooses stages of each tile itself, tiles are coded only for single lossless image
+  if (arguments.deadline_ms > 0 && (arguments.compression_level > 0 || arguments.input_preprocessing ||
+    arguments.adaptive_sequence_scanning || arguments.quadtree_coding || arguments.bwt_transform || arguments.auto_select ||
+    arguments.frames > 0 || arguments.archive || arguments.preview || arguments.progressive))
+  {
+    std::cerr << "Param --deadline-ms can not be combined with -1 to -9, -m, -a, -q, -b, --auto, --max-error, "
+      "--frames, --archive, --preview or --progressive!" << std::endl;
+    return false;
+  }
+
+  // Profile chooses stages itself, level chooses one of its modes
+  if (arguments.profile_file != "" && (arguments.adaptive_sequence_scanning || arguments.quadtree_coding ||
+    arguments.bwt_transform || arguments.auto_select || arguments.deadline_ms > 0 ||
+    (arguments.input_preprocessing && arguments.max_error == 0)))
+  {
+    std::cerr << "Param --profile can not be combined with -m, -a, -q, -b, --auto or --deadline-ms!" << std::endl;
+    return false;
+  }
+
+  // Compression level chooses stages itself
+  if (arguments.compression_level > 0 && arguments.profile_file == "") {
+    if (arguments.adaptive_sequence_scanning || arguments.quadtree_coding || arguments.bwt_transform ||
+      arguments.auto_select || (arguments.input_preprocessing && arguments.max_error == 0))
+    {
+      std::cerr << "Params -1 to -9 can not be combined with -m, -a, -q, -b or --auto!" << std::endl;
+      return false;
+    }
+
+    const CompressionLevel &level = COMPRESSION_LEVELS[arguments.compression_level - 1];
+    arguments.input_preprocessing = (level.input_preprocessing || arguments.max_error > 0);
+    arguments.adaptive_sequence_scanning = level.adaptive_sequence_scanning;
+    arguments.static_huffman = true;
+    // Pipeline is chosen from one image, so members of archive take settings of level as they are
+    arguments.auto_select = (level.auto_select && !arguments.archive);
+  }
+
+  // Pipeline is chosen from one image
+  if (arguments.auto_select && arguments.archive) {
+    std::cerr << "Param --auto can not be combined with --archive!" << std::endl;
+    return false;
+  }
+
+  // Preview is saved only for single image
+  if (arguments.preview && (arguments.archive || arguments.frames > 0)) {
+    std::cerr << "Param --preview can not be combined with --archive or --frames!" << std::endl;
+    return false;
+  }
+
+  // Pyramid is built only for single image
+  if (arguments.progressive && (arguments.archive || arguments.frames > 0 || arguments.preview)) {
+    std::cerr << "Param --progressive can not be combined with --archive, --frames or --preview!" << std::endl;
+    return false;
+  }
+
+  // When compressing, we require width, archive members can have their own width
+  if (arguments.compress_decompress && !arguments.archive && arguments.width == 0) {
     std::cerr << "Width of input is mandatory with param -c!" << std::endl;
     return false;
   }
 
+  // Quantization error would accumulate through frame differences
+  if (arguments.frames > 0 && arguments.max_error > 0) {
+    std::cerr << "Param --max-error can not be combined with --frames!" << std::endl;
+    return false;
+  }
+
+  // Stages are measured only while compressing
+  if (arguments.stats != "" && !arguments.compress_decompress) {
+    std::cerr << "Param --stats requires param -c!" << std::endl;
+    return false;
+  }
+
   // Extra arguments given
   if (optind < argc) {
-    std::cerr << "Extra arguments given, remove these arguments and try again, for help type -h!" << std::endl;
+    std::cerr << "Extra arguments given, remove these arguments and try again, for arguments.help type -h!" << std::endl;
     return false;
   }
 
@@ -155,127 +631,815 @@ void print_help() {
     "./huff_codec -c -i image.raw -o compressed_image -w 512 -a\n"
     "./huff_codec -c -i image.raw -o compressed_image -w 512 -m\n"
     "./huff_codec -c -i image.raw -o compressed_image -w 512 -a -m\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 -m -b -s 262144\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 -q\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 --max-error 2\n"
+    "./huff_codec -c -i frames.raw -o compressed_frames -w 512 --frames 64 --key-interval 8\n"
     "./huff_codec -d -i compressed_image -o image.raw\n"
+    "./huff_codec -d -i compressed_frames -o frame.raw --frame 10\n"
+    "./huff_codec -c -i a.raw -i b.raw:256 -o images.arch -w 512 --archive --shared-model\n"
+    "./huff_codec -d -i images.arch -o images_dir\n"
+    "./huff_codec -d -i images.arch -o b.raw --member b.raw\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 --preview\n"
+    "./huff_codec -d -i compressed_image -o thumbnail.raw --preview\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 --progressive --levels 5\n"
+    "./huff_codec -d -i compressed_image -o half.raw --level 1\n"
+    "./huff_codec --verify -i compressed_image\n"
+    "./huff_codec --info -i compressed_image\n"
+    "./huff_codec -t -i compressed_image --compare image.raw\n"
+    "./huff_codec -c -t -i image.raw -o compressed_image -w 512\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 --auto\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 -9\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 --deadline-ms 100\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 --profile corpus.prof -3\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 -m --stats=json\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 -7 --trace trace.json\n"
+    "./huff_codec -c -i image.raw -o compressed_image -w 512 -9 --threads 0\n"
     "./huff_codec -h\n\n"
   "Options:\n"
     "-h\t\tShow this screen.\n"
     "-c\t\tCompress input image.\n"
     "-d\t\tDecompress input data.\n"
-    "-i=<filename>\tSpecify input file that is either RAW image when -c is pressent or compressed data when -d is present.\n"
+    "-t\t\tTest that input data decompress without writing output file, with -c written file is decompressed and compared with input image.\n"
+    "-i=<filename>\tSpecify input file that is either RAW image when -c is pressent or compressed data when -d is present, with --archive can be repeated and given as <filename>:<width>.\n"
     "-o=<filename>\tSpecify output file name that will be either RAW image when -d is pressent or compressed data when -c is present.\n"
     "-w=<width>\tSpecify width of image, value needs to be higher than 0.\n"
     "-m\t\tSpecify to use preprocessing of image, that will calculate difference of pixels.\n"
-    "-a\t\tSpecify to use adaptive scanning for RLE algorithm, that will choose option that reduces image the most.\n";
+    "-a\t\tSpecify to use adaptive scanning for RLE algorithm, that will choose option that reduces image the most.\n"
+    "-q\t\tSpecify to code uniform blocks of image with quadtree, only pixels of other blocks are compressed by RLE.\n"
+    "-b\t\tSpecify to transform RLE data with BWT and move-to-front before huffman coding.\n"
+    "-s=<size>\tSpecify size of BWT block in bytes, default is 1048576, maximum is 16777215.\n"
+    "--max-error=<N>\tSpecify maximum error of each pixel from 0 to 255, residuals are quantized so result is near-lossless, implies -m.\n"
+    "--frames=<N>\tSpecify that input image holds N frames of same height below each other, frames are coded as difference from reference frame.\n"
+    "--key-interval=<K>\tSpecify that every K-th frame is coded on its own as key frame, default is 16.\n"
+    "--key-reference\tSpecify to code frames as difference from last key frame instead of previous frame.\n"
+    "--frame=<K>\tSpecify to decompress only frame K from multi-frame data, only frames from the closest key frame are decoded.\n"
+    "--archive\tSpecify to pack all input images into one archive with directory of members, identical images are stored only once, decompressed archive is written into directory given by -o.\n"
+    "--shared-model\tSpecify to train huffman tree of each archive member with model built from all members.\n"
+    "--member=<M>\tSpecify to decompress only archive member with index or name M.\n"
+    "--preview\tWith -c specify to save downsampled preview before image, with -d specify to decompress only preview, without reading image data.\n"
+    "--preview-scale=<S>\tSpecify that each pixel of preview is average of SxS block of image, default is 8, implies --preview.\n"
+    "--progressive\tSpecify to code image as pyramid of levels from coarse to fine, any prefix of file decompresses to lower resolution image.\n"
+    "--levels=<N>\tSpecify number of levels of pyramid including full resolution, default is 4, implies --progressive.\n"
+    "--level=<K>\tSpecify to decompress image downsampled K times, only needed start of file is read, implies --progressive.\n"
+    "--verify\tSpecify to only check checksums of blocks of file given by -i, without decoding it.\n"
+    "--no-checksum\tSpecify to not save CRC32C checksums of blocks at the end of file.\n"
+    "--auto\tSpecify to choose params -m, -q and -b by estimating result of each combination on sample of image, scanning is adaptive.\n"
+    "-1 ... -9\tSpecify compression level instead of -m, -a, -q, -b and --auto, all with static huffman code, -1 is the fastest with horizontal RLE, -2 adds -m, -3 adds --auto, -4 to -9 search 2D predictor of each tile with more pipelines, context coder from -5 and more context models, predictors and pipelines on higher levels.\n"
+    "--deadline-ms=<T>\tSpecify time budget of compression, all tiles are coded with the fastest mode and stronger modes are tried on tiles while they are expected to finish in T ms.\n"
+    "--profile=<filename>\tSpecify profile saved by ./huff_tune, its mode with the best ratio is used, with -1 to -9 mode is chosen from the fastest (-1) to the best ratio (-9).\n"
+    "--stats[=<format>]\tSpecify to print wall and CPU time and bytes of each stage, number of runs, counters of huffman coding, peak RSS and hardware counters of stages (when permitted) to standard error, format is text (default) or json.\n"
+    "--trace=<filename>\tSpecify to save spans of stages, blocks (BWT blocks, tiles, frames, levels and archive members) and file operations of every thread as Chrome trace JSON, that is opened by Perfetto or chrome://tracing.\n"
+    "--threads=<N>\tSpecify number of threads coding tiles of -4 to -9, profile with tiles and tiles container while decompressing, from 0 for all hardware threads to 1024, result does not depend on it (default 1, or threads of profile mode).\n"
+    "--compare=<filename>\tWith -t specify RAW image, that decompressed image is compared with, within maximum error saved in file or given by --max-error.\n"
+    "--info\tSpecify to only print size of image and stages from header of file given by -i, only header is read.\n";
 }
 
 /**
- * Starting point of program
+ * Write decompressed image to file, with -t only compare it with image given by --compare
+ * @param[in] arguments Settings of program
+ * @param[in] filename Name of output file, with -t only printed
+ * @param[in] buffer Decompressed image
+ * @param[in] size Size of decompressed image
+ * @param[in] max_error Maximum error of each pixel saved in decompressed file, --max-error overrides it
+ * @returns True when image was written or matches compared image, false otherwise
  * */
-int main(int argc, char *argv[]) {
-  // Variables for configuring program
-  bool compress_decompress;
-  bool input_preprocessing;
-  bool adaptive_sequence_scanning;
-  std::string input_file;
-  std::string output_file;
-  uint32_t width;
-  uint32_t height;
-  bool help = false;
+bool output_image(Arguments &arguments, std::string filename, uint8_t * &buffer, const uint64_t &size, const uint8_t &max_error = 0) {
+  if (!arguments.test) {
+    DataWorker data_worker;
+    if (!data_worker.WriteRawImage(filename, buffer, size)) {
+      std::cerr << "Failed to write RAW image data into given file." << std::endl;
+      return false;
+    }
+    return true;
+  }
 
-  // Parse agruments
-  if (!parse_arguments(argc, argv, compress_decompress, input_preprocessing, adaptive_sequence_scanning, input_file, output_file, width, help)) {
+  // Only check that image was decompressed
+  const std::string name = (filename == "") ? arguments.input_file : filename;
+  if (arguments.compare_file == "") {
+    std::cout << name << ": OK, decompressed " << size << " bytes" << std::endl;
+    return true;
+  }
+
+  // Compare image with raw image from file, file is read in blocks, near-lossless image may differ by maximum error
+  const uint8_t allowed_error = (arguments.max_error > 0) ? arguments.max_error : max_error;
+  uint64_t mismatch = 0;
+  if (!DataWorker::CompareRawImage(arguments.compare_file, buffer, size, allowed_error, mismatch)) {
+    std::cerr << name << ": differs from " << arguments.compare_file << " at byte " << mismatch << "!" << std::endl;
+    return false;
+  }
+  std::cout << name << ": OK, matches " << arguments.compare_file;
+  if (allowed_error > 0) {
+    std::cout << " within maximum error " << static_cast<uint32_t>(allowed_error);
+  }
+  std::cout << std::endl;
+  return true;
+}
+
+/**
+ * Create checksum trailer of encoded data, when checksums are not disabled by --no-checksum
+ * @param[in] arguments Settings of program
+ * @param[in] data Encoded data
+ * @param[in] size Size of encoded data
+ * @returns Trailer to be saved after encoded data, empty when checksums are disabled
+ * */
+std::vector<uint8_t> create_trailer(Arguments &arguments, const uint8_t *data, const uint64_t &size) {
+  if (!arguments.checksum) {
+    return {};
+  }
+  return BlockChecksum::CreateTrailer(data, size);
+}
+
+/**
+ * Write encoded data with checksum trailer to file given by -o, measured as write stage
+ * @param[in] arguments Settings of program
+ * @param[in] data_worker Data worker used for writing encoded data
+ * @param[in] stats Measured stages
+ * @param[in] data Encoded data
+ * @param[in] size Size of encoded data
+ * @returns 0 when data were written, -1 otherwise
+ * */
+int write_encoded(Arguments &arguments, DataWorker &data_worker, CodecStats &stats, uint8_t * &data, const uint64_t &size) {
+  stats.StartStage("write", size);
+  const std::vector<uint8_t> trailer = create_trailer(arguments, data, size);
+  if (!data_worker.WriteEncodedData(arguments.output_file, data, size, trailer)) {
+    std::cerr << "Failed to write encoded data to given file." << std::endl;
     return -1;
   }
+  stats.EndStage(size + trailer.size());
+  return 0;
+}
 
-  // Exit program after printing help menu
-  if (help) {
-    print_help();
+/**
+ * Check all checksums of file given by -i, without decoding it
+ * @param[in] arguments Settings of program
+ * @returns 0 when all blocks match their checksums, -1 otherwise
+ * */
+int verify(Arguments &arguments) {
+  DataWorker data_worker;
+  if (!data_worker.LoadEncodedData(arguments.input_file)) {
+    std::cerr << "Failed to read from given file" << std::endl;
+    return -1;
+  }
+
+  BlockChecksum block_checksum(data_worker.GetBuffer(), data_worker.GetSize());
+  if (!block_checksum.ReadTrailer()) {
+    return -1;
+  }
+
+  // Report every damaged block, with its range in file
+  if (!block_checksum.Verify()) {
+    for (const uint64_t &block : block_checksum.GetBadBlocks()) {
+      std::cerr << "Block " << block << " (bytes from " << (block * CHECKSUM_BLOCK_SIZE) << ") is damaged!" << std::endl;
+    }
+    std::cerr << arguments.input_file << ": " << block_checksum.GetBadBlocks().size() << " of "
+      << block_checksum.GetBlockCount() << " blocks are damaged" << std::endl;
+    return -1;
+  }
+
+  std::cout << arguments.input_file << ": OK, " << block_checksum.GetBlockCount() << " blocks" << std::endl;
+  return 0;
+}
+
+/**
+ * Compress all input images into archive, input can be given as <filename>:<width>
+ * @param[in] arguments Settings of program
+ * @param[in] settings Settings of compression pipeline, used for each member
+ * @param[in] stats Measured stages
+ * @returns 0 when archive was written, -1 otherwise
+ * */
+int compress_archive(Arguments &arguments, const CodecSettings &settings, CodecStats &stats) {
+  ArchiveCompressor archive_compressor(settings);
+
+  // All members are loaded before compression
+  uint64_t raw_size = 0;
+  stats.StartStage("load", 0);
+  for (const std::string &input : arguments.input_files) {
+    std::string filename = input;
+    uint32_t width = arguments.width;
+
+    // Width given after last colon
+    const size_t colon = input.rfind(':');
+    if (colon != std::string::npos && colon + 1 < input.size() &&
+      input.find_first_not_of("0123456789", colon + 1) == std::string::npos)
+    {
+      filename = input.substr(0, colon);
+      std::stringstream sstream(input.substr(colon + 1));
+      sstream >> width;
+    }
+
+    if (width == 0) {
+      std::cerr << "Width of " << filename << " is missing, use -w or <filename>:<width>!" << std::endl;
+      return -1;
+    }
+
+    // Load raw image, with its height
+    DataWorker data_worker;
+    uint32_t height;
+    if (!data_worker.LoadRawImage(filename, width, height)) {
+      return -1;
+    }
+
+    // Member is named by file name without directories
+    archive_compressor.AddMember(std::filesystem::path(filename).filename().string(), data_worker.GetBuffer(), width, height);
+    raw_size += static_cast<uint64_t>(width) * height;
+  }
+  stats.EndStage(raw_size);
+
+  stats.StartStage("archive", raw_size);
+  archive_compressor.Compress(arguments.shared_model);
+  stats.EndStage(archive_compressor.GetSize());
+
+  // Report deduplication statistics
+  std::cout << "Deduplicated " << archive_compressor.GetDuplicateCount() << " of " << arguments.input_files.size()
+    << " members, " << archive_compressor.GetDuplicateBytes() << " raw bytes were not compressed again, hashing took "
+    << archive_compressor.GetHashTime() << " ms" << std::endl;
+
+  // Write archive to file
+  DataWorker data_worker;
+  return write_encoded(arguments, data_worker, stats, archive_compressor.GetBuffer(), archive_compressor.GetSize());
+}
+
+/**
+ * Decompress archive member given by --member into output file, or all members into output directory
+ * @param[in] arguments Settings of program
+ * @param[in] data_worker Data worker holding loaded archive
+ * @returns 0 when members were written, -1 otherwise
+ * */
+int decompress_archive(Arguments &arguments, DataWorker &data_worker) {
+  ArchiveDecompressor archive_decompressor(data_worker.GetBuffer(), data_worker.GetSize());
+  if (!archive_decompressor.ReadHeader()) {
+    return -1;
+  }
+  const std::vector<ArchiveMember> &members = archive_decompressor.GetMembers();
+
+  // Decompress only one member, given by name or index
+  if (arguments.member != "") {
+    int64_t index = archive_decompressor.FindMember(arguments.member);
+    if (index < 0 && arguments.member.find_first_not_of("0123456789") == std::string::npos) {
+      std::stringstream sstream(arguments.member);
+      sstream >> index;
+    }
+
+    if (index < 0 || index >= static_cast<int64_t>(members.size())) {
+      std::cerr << "Archive has no member " << arguments.member << "!" << std::endl;
+      return -1;
+    }
+
+    if (!archive_decompressor.DecompressMember(index)) {
+      return -1;
+    }
+
+    if (!output_image(arguments, arguments.output_file, archive_decompressor.GetBuffer(), archive_decompressor.GetSize(),
+      archive_decompressor.GetMaxError())) {
+      return -1;
+    }
     return 0;
   }
 
-  // Initialize data worker
+  // Members are compared only one at a time
+  if (arguments.compare_file != "") {
+    std::cerr << "Param --compare requires param --member for archive!" << std::endl;
+    return -1;
+  }
+
+  // Decompress all members into output directory, that is not needed with -t
+  std::error_code error;
+  if (!arguments.test) {
+    std::filesystem::create_directories(arguments.output_file, error);
+  }
+  if (error) {
+    std::cerr << "Failed to create output directory " << arguments.output_file << std::endl;
+    return -1;
+  }
+
+  for (uint32_t i = 0; i < members.size(); i++) {
+    // Member names are file names, never leave output directory
+    const std::filesystem::path name(members[i].name);
+    if (name.empty() || name != name.filename() || name == "." || name == "..") {
+      std::cerr << "Invalid name of member " << i << "!" << std::endl;
+      return -1;
+    }
+
+    if (!archive_decompressor.DecompressMember(i)) {
+      return -1;
+    }
+
+    std::string filename = (std::filesystem::path(arguments.output_file) / name).string();
+    if (!output_image(arguments, filename, archive_decompressor.GetBuffer(), archive_decompressor.GetSize(),
+      archive_decompressor.GetMaxError())) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Print header of file given by -i, only start of file is read
+ * @param[in] arguments Settings of program
+ * @returns 0 when header was printed, -1 otherwise
+ * */
+int print_info(Arguments &arguments) {
   DataWorker data_worker;
+  if (!data_worker.LoadEncodedData(arguments.input_file, IMAGE_HEADER_PREFIX_SIZE) || data_worker.GetSize() == 0) {
+    std::cerr << "Failed to read from given file" << std::endl;
+    return -1;
+  }
+  uint8_t *data = data_worker.GetBuffer();
+  const uint64_t size = data_worker.GetSize();
 
-  if (compress_decompress) {
-    /**********************************COMPRESSING*************************************/
+  // Containers save their own headers
+  const std::vector<std::pair<uint8_t, std::string>> containers = {
+    {CONTAINER_FRAMES, "multi-frame container"},
+    {CONTAINER_ARCHIVE, "archive"},
+    {CONTAINER_PREVIEW, "image with preview"},
+    {CONTAINER_PROGRESSIVE, "resolution progressive image"},
+    {CONTAINER_TILES, "tiled image"}
+  };
+  for (const auto &container : containers) {
+    if (IsContainer(data, size, container.first)) {
+      std::cout << arguments.input_file << ": " << container.second << std::endl;
+      return 0;
+    }
+  }
 
-    // Load raw image, with its height
-    if (!data_worker.LoadRawImage(input_file, width, height)) {
+  // Legacy image has only settings byte
+  if (!IsContainer(data, size, CONTAINER_IMAGE)) {
+    std::cout << arguments.input_file << ": image without versioned header, settings byte 0x" << std::hex
+      << static_cast<uint32_t>(data[0]) << std::dec << std::endl;
+    return 0;
+  }
+
+  // Load whole versioned header
+  if (!data_worker.LoadEncodedData(arguments.input_file, ImageHeader::ReadHeaderSize(data, size))) {
+    std::cerr << "Failed to read from given file" << std::endl;
+    return -1;
+  }
+  ImageHeader image_header;
+  if (!image_header.Read(data_worker.GetBuffer(), data_worker.GetSize())) {
+    return -1;
+  }
+
+  std::cout << arguments.input_file << ": image " << image_header.GetWidth() << "x" << image_header.GetHeight()
+    << ", header version " << static_cast<uint32_t>(image_header.GetVersion()) << " (" << image_header.GetHeaderSize()
+    << " bytes)" << std::endl;
+  for (const StageDescriptor &stage : image_header.GetStages()) {
+    std::cout << "  " << ImageHeader::StageName(stage.id) << ": " << stage.size << " bytes";
+    if (stage.id == STAGE_PREDICTION && !stage.params.empty()) {
+      std::cout << ", maximum error " << static_cast<uint32_t>(stage.params[0]);
+    }
+    std::cout << std::endl;
+  }
+  return 0;
+}
+
+/**
+ * Decompress resolution progressive image up to level given by --level, when file is not loaded yet
+ * only its start needed for given level is read
+ * @param[in] arguments Settings of program
+ * @param[in] data_worker Data worker holding loaded file, or empty data worker
+ * @returns 0 when image was written, -1 otherwise
+ * */
+int decompress_progressive(Arguments &arguments, DataWorker &data_worker) {
+  // Read header, then header with level index and at last all levels up to given one
+  if (data_worker.GetSize() == 0) {
+    if (!data_worker.LoadEncodedData(arguments.input_file, PROGRESSIVE_HEADER_SIZE)) {
+      std::cerr << "Failed to read from given file" << std::endl;
       return -1;
     }
 
-    // Preprocess data when compressing and argument -m was set
-    if (input_preprocessing) {
-      data_worker.Preprocess();
+    ProgressiveDecompressor header_reader(data_worker.GetBuffer(), data_worker.GetSize());
+    if (!header_reader.ReadHeader() || !data_worker.LoadEncodedData(arguments.input_file, header_reader.GetIndexEnd())) {
+      return -1;
     }
 
-    // Initialize RLE compressor
-    RleCompressor rle_compressor(data_worker.GetBuffer(), width, height);
+    ProgressiveDecompressor index_reader(data_worker.GetBuffer(), data_worker.GetSize());
+    if (!index_reader.ReadHeader() || !data_worker.LoadEncodedData(arguments.input_file, index_reader.GetLevelEnd(arguments.level))) {
+      return -1;
+    }
+  }
+
+  ProgressiveDecompressor progressive_decompressor(data_worker.GetBuffer(), data_worker.GetSize());
+  if (!progressive_decompressor.ReadHeader() || !progressive_decompressor.Decompress(arguments.level)) {
+    return -1;
+  }
+
+  // Tell size of image, because it differs from original size
+  if (!progressive_decompressor.IsFullResolution()) {
+    std::cout << "Decompressed image of size " << progressive_decompressor.GetWidth() << "x"
+      << progressive_decompressor.GetHeight() << std::endl;
+  }
+
+  // Write image to file
+  uint8_t *image = progressive_decompressor.GetBuffer();
+  if (!output_image(arguments, arguments.output_file, image, progressive_decompressor.GetSize(), progressive_decompressor.GetMaxError())) {
+    return -1;
+  }
+  return 0;
+}
+
+/**
+ * Compress single image by tiles of compression level given by -1 to -9, each tile keeps the smallest result
+ * of its best predictors with pipelines and context coder of level
+ * @param[in] arguments Settings of program
+ * @param[in] data_worker Data worker holding loaded image, used for writing encoded data
+ * @param[in] stats Measured stages
+ * @param[in] settings Settings of compression pipeline, type of huffman code is kept
+ * @param[in] height Height of image
+ * @returns 0 when file was compressed, -1 otherwise
+ * */
+int compress_level_tiles(Arguments &arguments, DataWorker &data_worker, CodecStats &stats, const CodecSettings &settings,
+  const uint32_t &height)
+{
+  const CompressionLevel &level = COMPRESSION_LEVELS[arguments.compression_level - 1];
+  stats.StartStage("tiles", static_cast<uint64_t>(arguments.width) * height);
+  TilesCompressor tiles_compressor(data_worker.GetBuffer(), arguments.width, height);
+  tiles_compressor.SetThreads(arguments.threads);
+  tiles_compressor.Compress(settings, level.tile_size, level.tile_predictors, level.tile_pipelines, level.context_models);
+  stats.EndStage(tiles_compressor.GetSize());
+
+  // Write container to file
+  return write_encoded(arguments, data_worker, stats, tiles_compressor.GetBuffer(), tiles_compressor.GetSize());
+}
+
+/**
+ * Compress file given by -i into file given by -o, with settings given by arguments
+ * @param[in] arguments Settings of program
+ * @param[in] data_worker Data worker used for loading image and writing encoded data
+ * @param[in] stats Measured stages
+ * @returns 0 when file was compressed, -1 otherwise
+ * */
+int compress(Arguments &arguments, DataWorker &data_worker, CodecStats &stats) {
+  // Time budget given by --deadline-ms includes loading of image
+  const auto start = std::chrono::steady_clock::now();
+
+  // Height of image, calculated from size of file
+  uint32_t height;
+
+  // Settings of compression pipeline given by arguments
+  CodecSettings settings = {
+    arguments.input_preprocessing,
+    arguments.adaptive_sequence_scanning,
+    arguments.quadtree_coding,
+    arguments.bwt_transform,
+    arguments.bwt_block_size,
+    arguments.max_error,
+    arguments.static_huffman
+  };
 
-    // When given argument -a, do adaptive scanning
-    if (adaptive_sequence_scanning) {
-      rle_compressor.AdaptiveScanning(width, height, input_preprocessing);
-    // Otherwise do normal horizontal scanning
-    } else {
-      rle_compressor.SequenceScanning(width, height, input_preprocessing);
+  // When given argument --profile, take settings from its mode chosen by level, tiles are coded only for single image
+  ProfileEntry profile_entry = {};
+  if (arguments.profile_file != "") {
+    CompressionProfile profile;
+    if (!profile.Load(arguments.profile_file)) {
+      return -1;
     }
+    profile_entry = profile.Select(arguments.compression_level);
+    settings = CompressionProfile::GetSettings(profile_entry, settings);
 
-    // Initialize huffman coder
-    HuffmanCoder huffman_coder;
-    uint8_t settings = 0;
+    std::cout << "Profile mode: " << CompressionProfile::Describe(profile_entry) << " (ratio " << profile_entry.ratio
+      << ", " << profile_entry.compress_speed << " MB/s on tuning corpus)" << std::endl;
+  }
 
-    // Do huffman encoding
-    // Huffman encoding, will compare RLE data length with huffman result length
-    // And when huffman is lower will return him
-    // Otherwise will return RLE and not use huffman
-    // Which will be saved in first byte, that will also contain number of padding bits
-    huffman_coder.Encode(rle_compressor.GetBuffer(), rle_compressor.GetSize(), settings);
+  // When given argument --archive, pack all input images into archive
+  if (arguments.archive) {
+    return compress_archive(arguments, settings, stats);
+  }
 
-    // Write setting byte and data to file
-    if (!data_worker.WriteEncodedData(output_file, settings, huffman_coder.GetBuffer(), huffman_coder.GetSize()))
-    {
-      std::cerr << "Failed to write encoded data to given file." << std::endl;
+  // Load raw image, with its height
+  stats.StartStage("load", 0);
+  if (!data_worker.LoadRawImage(arguments.input_file, arguments.width, height)) {
+    return -1;
+  }
+  const uint64_t image_size = static_cast<uint64_t>(arguments.width) * height;
+  stats.EndStage(image_size);
+
+  // When given argument --deadline-ms, improve tiles coded by the fastest mode until deadline
+  if (arguments.deadline_ms > 0) {
+    stats.StartStage("deadline tiles", image_size);
+    TilesCompressor tiles_compressor(data_worker.GetBuffer(), arguments.width, height);
+    tiles_compressor.CompressWithDeadline(settings, TILES_DEFAULT_SIZE, start + std::chrono::milliseconds(arguments.deadline_ms));
+    const double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Deadline " << arguments.deadline_ms << " ms: " << tiles_compressor.GetAttempts() << " attempts on "
+      << tiles_compressor.GetTileCount() << " tiles, " << tiles_compressor.GetImprovements() << " improved result, finished in "
+      << time << " ms" << std::endl;
+    stats.EndStage(tiles_compressor.GetSize());
+
+    // Write container to file
+    return write_encoded(arguments, data_worker, stats, tiles_compressor.GetBuffer(), tiles_compressor.GetSize());
+  }
+
+  // When given level -4 to -9, single lossless image is split into tiles, predictors of tiles replace -m
+  if (arguments.compression_level > 0 && arguments.profile_file == "" && arguments.frames == 0 && !arguments.preview &&
+    !arguments.progressive && arguments.max_error == 0 && COMPRESSION_LEVELS[arguments.compression_level - 1].tile_size > 0)
+  {
+    return compress_level_tiles(arguments, data_worker, stats, settings, height);
+  }
+
+  // When given argument --auto, choose settings from sample of image
+  if (arguments.auto_select) {
+    const auto select_start = std::chrono::steady_clock::now();
+    stats.StartStage("auto select", image_size);
+    PipelineSelector pipeline_selector(data_worker.GetBuffer(), arguments.width, height);
+    settings = pipeline_selector.Select(settings);
+    stats.EndStage(0);
+    const double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - select_start).count();
+
+    std::cout << "Selected pipeline:" << (settings.input_preprocessing ? " -m" : "") << " -a"
+      << (settings.quadtree_coding ? " -q" : "") << (settings.bwt_transform ? " -b" : "")
+      << " (estimated " << pipeline_selector.GetEstimatedBitsPerPixel() << " bits per pixel, sampled "
+      << pipeline_selector.GetSampleSize() << " pixels in " << time << " ms)" << std::endl;
+  }
+
+  // When given argument --frames, split image into frames and code them as differences
+  if (arguments.frames > 0) {
+    if ((height % arguments.frames) != 0) {
+      std::cerr << "Height of image " << height << " is not divisible by number of frames!" << std::endl;
       return -1;
     }
 
+    FramesCompressor frames_compressor(data_worker.GetBuffer(), arguments.width, height / arguments.frames, arguments.frames);
+    stats.StartStage("frames", image_size);
+    frames_compressor.Compress(settings, arguments.key_interval, arguments.key_reference);
+    stats.EndStage(frames_compressor.GetSize());
+
+    // Write container to file
+    return write_encoded(arguments, data_worker, stats, frames_compressor.GetBuffer(), frames_compressor.GetSize());
+  }
+
+  // When given argument --preview, save downsampled preview before image
+  if (arguments.preview) {
+    PreviewCompressor preview_compressor(data_worker.GetBuffer(), arguments.width, height);
+    stats.StartStage("preview", image_size);
+    preview_compressor.Compress(settings, arguments.preview_scale);
+    stats.EndStage(preview_compressor.GetSize());
+
+    // Write container to file
+    return write_encoded(arguments, data_worker, stats, preview_compressor.GetBuffer(), preview_compressor.GetSize());
+  }
+
+  // When given argument --progressive, code image as pyramid from coarse to fine
+  if (arguments.progressive) {
+    ProgressiveCompressor progressive_compressor(data_worker.GetBuffer(), arguments.width, height);
+    stats.StartStage("progressive", image_size);
+    if (!progressive_compressor.Compress(settings, arguments.levels)) {
+      return -1;
+    }
+    stats.EndStage(progressive_compressor.GetSize());
+
+    // Write container to file
+    return write_encoded(arguments, data_worker, stats, progressive_compressor.GetBuffer(), progressive_compressor.GetSize());
+  }
+
+  // When profile mode splits image into tiles, code each tile with its predictor, near-lossless image is coded whole
+  if (profile_entry.tile_size > 0 && arguments.max_error == 0) {
+    TilesCompressor tiles_compressor(data_worker.GetBuffer(), arguments.width, height);
+    tiles_compressor.SetThreads((arguments.threads > 0) ? arguments.threads : profile_entry.threads);
+    stats.StartStage("tiles", image_size);
+    tiles_compressor.CompressWithMode(settings, profile_entry.tile_size, profile_entry.predictor);
+    stats.EndStage(tiles_compressor.GetSize());
+
+    // Write container to file
+    return write_encoded(arguments, data_worker, stats, tiles_compressor.GetBuffer(), tiles_compressor.GetSize());
+  }
+
+  // Compress image through whole pipeline
+  ImageCodec image_codec;
+  image_codec.SetStats(&stats);
+  image_codec.Compress(data_worker.GetBuffer(), arguments.width, height, settings);
+
+  // Write header and data to file
+  return write_encoded(arguments, data_worker, stats, image_codec.GetBuffer(), image_codec.GetSize());
+}
+
+/**
+ * Decompress file given by -i into file given by -o, with -t only check that file decompresses
+ * @param[in] arguments Settings of program
+ * @param[in] data_worker Data worker used for loading encoded data and writing image
+ * @returns 0 when file was decompressed, -1 otherwise
+ * */
+int decompress(Arguments &arguments, DataWorker &data_worker) {
+  // When given argument --preview, read only header and preview from start of file
+  if (arguments.preview) {
+    if (!data_worker.LoadEncodedData(arguments.input_file, PREVIEW_HEADER_SIZE)) {
+      std::cerr << "Failed to read from given file" << std::endl;
+      return -1;
+    }
+
+    // Header tells how many bytes are needed for preview
+    PreviewDecompressor header_reader(data_worker.GetBuffer(), data_worker.GetSize());
+    if (!header_reader.ReadHeader() || !data_worker.LoadEncodedData(arguments.input_file, header_reader.GetPreviewEnd())) {
+      return -1;
+    }
+
+    PreviewDecompressor preview_decompressor(data_worker.GetBuffer(), data_worker.GetSize());
+    if (!preview_decompressor.ReadHeader() || !preview_decompressor.DecompressPreview()) {
+      return -1;
+    }
+
+    // Write preview to file
+    if (!output_image(arguments, arguments.output_file, preview_decompressor.GetBuffer(), preview_decompressor.GetSize(),
+      preview_decompressor.GetMaxError())) {
+      return -1;
+    }
     return 0;
   }
 
-  /**********************************DECOMPRESSING*************************************/
+  // When given argument --level, read only start of file needed for given level
+  if (arguments.progressive) {
+    return decompress_progressive(arguments, data_worker);
+  }
 
   // When reading from file failed, return error
-  if (!data_worker.LoadEncodedData(input_file))
+  if (!data_worker.LoadEncodedData(arguments.input_file) || data_worker.GetSize() == 0)
   {
     std::cerr << "Failed to read from given file" << std::endl;
     return -1;
   }
 
-  // Initialize huffman decoder
-  HuffmanDecoder huffman_decoder;
+  // Check checksums before decoding, and continue only with data before trailer
+  BlockChecksum block_checksum(data_worker.GetBuffer(), data_worker.GetSize());
+  if (block_checksum.HasTrailer()) {
+    if (!block_checksum.ReadTrailer()) {
+      return -1;
+    }
+    if (!block_checksum.Verify()) {
+      std::cerr << block_checksum.GetBadBlocks().size() << " of " << block_checksum.GetBlockCount()
+        << " blocks do not match their checksums, file is damaged!" << std::endl;
+      return -1;
+    }
+    data_worker.Truncate(block_checksum.GetDataSize());
+  }
+
+  // Multi-frame container, decompress all frames or only the one given by --frame
+  if (IsContainer(data_worker.GetBuffer(), data_worker.GetSize(), CONTAINER_FRAMES)) {
+    FramesDecompressor frames_decompressor(data_worker.GetBuffer(), data_worker.GetSize());
+    if (!frames_decompressor.ReadHeader()) {
+      return -1;
+    }
+
+    const bool decompressed = (arguments.frame >= 0)
+      ? frames_decompressor.DecompressFrame(static_cast<uint32_t>(arguments.frame))
+      : frames_decompressor.Decompress();
+    if (!decompressed) {
+      return -1;
+    }
+
+    // Write frames to file
+    if (!output_image(arguments, arguments.output_file, frames_decompressor.GetBuffer(), frames_decompressor.GetSize())) {
+      return -1;
+    }
+    return 0;
+  }
+
+  // Archive, decompress all members or only the one given by --member
+  if (IsContainer(data_worker.GetBuffer(), data_worker.GetSize(), CONTAINER_ARCHIVE)) {
+    return decompress_archive(arguments, data_worker);
+  }
 
-  // Do huffman decoding
-  // Check first byte, and when 4th bit is set, do huffman decoding and when not
-  // Just copy data to output buffer because we are only using RLE
-  if (!huffman_decoder.Decode(data_worker.GetBuffer(), data_worker.GetSize())) {
+  // Image with preview, preview is skipped
+  if (IsContainer(data_worker.GetBuffer(), data_worker.GetSize(), CONTAINER_PREVIEW)) {
+    PreviewDecompressor preview_decompressor(data_worker.GetBuffer(), data_worker.GetSize());
+    if (!preview_decompressor.ReadHeader() || !preview_decompressor.Decompress()) {
+      return -1;
+    }
+
+    // Write image to file
+    if (!output_image(arguments, arguments.output_file, preview_decompressor.GetBuffer(), preview_decompressor.GetSize(),
+      preview_decompressor.GetMaxError())) {
+      return -1;
+    }
+    return 0;
+  }
+
+  // Resolution progressive image, decompress all levels that are in file
+  if (IsContainer(data_worker.GetBuffer(), data_worker.GetSize(), CONTAINER_PROGRESSIVE)) {
+    return decompress_progressive(arguments, data_worker);
+  }
+
+  // Image split into tiles, each tile has its own predictor
+  if (IsContainer(data_worker.GetBuffer(), data_worker.GetSize(), CONTAINER_TILES)) {
+    TilesDecompressor tiles_decompressor(data_worker.GetBuffer(), data_worker.GetSize());
+    tiles_decompressor.SetThreads(arguments.threads);
+    if (!tiles_decompressor.ReadHeader() || !tiles_decompressor.Decompress()) {
+      return -1;
+    }
+
+    // Write image to file
+    if (!output_image(arguments, arguments.output_file, tiles_decompressor.GetBuffer(), tiles_decompressor.GetSize())) {
+      return -1;
+    }
+    return 0;
+  }
+
+  // Only archive has members
+  if (arguments.member != "") {
+    std::cerr << "Param --member requires archive!" << std::endl;
     return -1;
   }
 
-  // Initialize RLE decompressor
-  RleDecompressor rle_decompressor(huffman_decoder.GetBuffer(), huffman_decoder.GetSize());
-  bool convert_from_model = false;
+  // Only multi-frame data have frames
+  if (arguments.frame >= 0) {
+    std::cerr << "Param --frame requires multi-frame data!" << std::endl;
+    return -1;
+  }
 
-  // Decompress data
-  if (!rle_decompressor.Decompress(convert_from_model))
-  {
-    std::cerr << "Failed to decompress given data, invalid data" << std::endl;
+  // Decompress image through whole pipeline
+  ImageCodec image_codec;
+  if (!image_codec.Decompress(data_worker.GetBuffer(), data_worker.GetSize())) {
     return -1;
   }
 
-  // Write image to file and when `convert_from_model` is true, preprocess data before saving to file
-  if (!data_worker.WriteRawImage(output_file, rle_decompressor.GetBuffer(), rle_decompressor.GetSize(), convert_from_model))
-  {
-    std::cerr << "Failed to write RAW image data into given file." << std::endl;
+  // Write image to file
+  if (!output_image(arguments, arguments.output_file, image_codec.GetBuffer(), image_codec.GetSize(), image_codec.GetMaxError())) {
     return -1;
   }
   return 0;
 }
+
+/**
+ * Compress or decompress by parsed arguments
+ * @param[in] arguments Parsed arguments
+ * @returns 0 on success, non-zero otherwise
+ * */
+int run(Arguments &arguments) {
+  // Initialize data worker
+  DataWorker data_worker;
+
+  if (arguments.compress_decompress) {
+    CodecStats stats(arguments.stats != "");
+    int result = 0;
+    {
+      TraceSpan span("compress", "run");
+      result = compress(arguments, data_worker, stats);
+    }
+
+    // When given argument --stats, print measured stages to standard error, so they are not mixed with other output
+    if (result == 0 && arguments.stats == "json") {
+      stats.PrintJson(std::cerr);
+    } else if (result == 0 && arguments.stats == "text") {
+      stats.Print(std::cerr);
+    }
+
+    if (result != 0 || !arguments.test) {
+      return result;
+    }
+
+    // When given argument -t, decompress written file and compare it with input image
+    arguments.compare_file = arguments.archive ? "" : arguments.input_file;
+    arguments.input_file = arguments.output_file;
+    arguments.output_file = "";
+    arguments.preview = false;
+    arguments.progressive = false;
+    DataWorker test_worker;
+    TraceSpan span("test", "run");
+    return decompress(arguments, test_worker);
+  }
+
+  TraceSpan span("decompress", "run");
+  return decompress(arguments, data_worker);
+}
+
+/**
+ * Starting point of program
+ * */
+int main(int argc, char *argv[]) {
+  // Settings of program
+  Arguments arguments;
+
+  // Parse agruments
+  if (!parse_arguments(argc, argv, arguments)) {
+    return -1;
+  }
+
+  // Exit program after printing help menu
+  if (arguments.help) {
+    print_help();
+    return 0;
+  }
+
+  // When given argument --verify, only check checksums
+  if (arguments.verify) {
+    return verify(arguments);
+  }
+
+  // When given argument --info, only print header
+  if (arguments.info) {
+    return print_info(arguments);
+  }
+
+  // When given argument --trace, record spans of stages, blocks and I/O of every thread
+  if (arguments.trace_file != "") {
+    TraceRecorder::Enable();
+  }
+  const int result = run(arguments);
+
+  // Trace is saved also when coding failed, so the failing stage can be found
+  if (arguments.trace_file != "" && !TraceRecorder::Write(arguments.trace_file)) {
+    std::cerr << "Failed to write trace file " << arguments.trace_file << "!" << std::endl;
+    return (result != 0) ? result : -1;
+  }
+
+  return result;
+}
@@ -0,0 +1,54 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: archive.hpp
+ * Description: Contains definitions of constant data and structures for both archive compressor and decompressor
+ * */
+#ifndef __ARCHIVE__
+#define __ARCHIVE__
+
+#include <cstdint>  // uint8_t, uint16_t, uint32_t, uint64_t
+#include <string>   // string
+
+// Constants used both in ArchiveCompressor and ArchiveDecompressor
+
+// Number of bytes of member count, model size, width and height
+constexpr uint8_t ARCHIVE_VALUE_BYTES = 4;
+
+// Number of bytes of offset and size of member in directory
+constexpr uint8_t ARCHIVE_OFFSET_BYTES = 8;
+
+// Number of bytes of length of member name
+constexpr uint8_t ARCHIVE_NAME_BYTES = 2;
+
+// Maximum length of member name
+constexpr uint16_t ARCHIVE_MAX_NAME_LENGTH = 0xFFFF;
+
+// Size of header, magic bytes followed by member count and size of shared model
+constexpr uint8_t ARCHIVE_HEADER_SIZE = 4 + 2 * ARCHIVE_VALUE_BYTES;
+
+// Size of directory entry without name, offset, size, width, height, settings byte and name length
+constexpr uint8_t ARCHIVE_ENTRY_SIZE = 2 * ARCHIVE_OFFSET_BYTES + 2 * ARCHIVE_VALUE_BYTES + 1 + ARCHIVE_NAME_BYTES;
+
+// Number of symbols of shared model, that are used to train huffman tree of each member
+constexpr uint32_t ARCHIVE_MODEL_SIZE = 1024;
+
+/**
+ * Entry of archive directory
+ * @param name Name of member, file name of image without directories
+ * @param width Width of image
+ * @param height Height of image
+ * @param settings Settings byte of encoded data, telling which stages were used
+ * @param offset Offset of encoded data from the end of directory
+ * @param size Size of encoded data
+ * */
+typedef struct ArchiveMember {
+  std::string name;
+  uint32_t width;
+  uint32_t height;
+  uint8_t settings;
+  uint64_t offset;
+  uint64_t size;
+} ArchiveMember;
+
+#endif
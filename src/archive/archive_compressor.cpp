@@ -0,0 +1,232 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: archive_compressor.cpp
+ * Description: Contains implementations of archive compressor class that is used to pack
+ * many images into one archive with directory of members
+ * */
+#include "archive_compressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor that will initialize values
+ * @param[in] settings Settings of compression pipeline, used for each member
+ * */
+ArchiveCompressor::ArchiveCompressor(const CodecSettings &settings) {
+  this->settings = settings;
+
+  // Set deduplication statistics
+  this->duplicate_count = 0;
+  this->duplicate_bytes = 0;
+  this->hash_time = 0;
+
+  // Set archive data
+  this->encoded_buff = nullptr;
+  this->encoded_index = 0;
+}
+
+/**
+ * Deconstructor that will free allocated data
+ * */
+ArchiveCompressor::~ArchiveCompressor() {
+  // When buffer was allocated, free him
+  if (this->encoded_buff) {
+    free(this->encoded_buff);
+  }
+}
+
+/**
+ * Add image as member of archive, all stages before huffman coding are done right away,
+ * unless identical image with the same size was already added, then member only references it
+ * @param[in] name Name of member
+ * @param[in] image Image data, that will not be modified
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * */
+void ArchiveCompressor::AddMember(
+  const std::string &name,
+  const uint8_t *image,
+  const uint32_t &width,
+  const uint32_t &height
+) {
+  // Directory entry, offset, size and settings are known after huffman coding
+  this->members.push_back({name.substr(0, ARCHIVE_MAX_NAME_LENGTH), width, height, 0, 0, 0});
+  const uint64_t image_size = static_cast<uint64_t>(width) * height;
+
+  // Hash image, with its size, so images with the same pixels and different width differ
+  const auto start = std::chrono::steady_clock::now();
+  ContentHash hash = ContentHasher::Hash(image, image_size);
+  hash.high ^= (static_cast<uint64_t>(width) << 32) | height;
+  this->hash_time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  // Identical image was already added, reference its codec, pixels are compared as well, so collision
+  // of hashes does not make member decode into other image
+  const auto found = this->hashes.find(hash);
+  if (found != this->hashes.end()) {
+    const ArchiveMember &first = this->members[found->second];
+    const uint8_t *first_image = this->codecs[this->codec_indexes[found->second]].GetRawImage();
+    if (first.width == width && first.height == height &&
+      (image_size == 0 || (first_image != nullptr && memcmp(first_image, image, image_size) == 0)))
+    {
+      this->codec_indexes.push_back(this->codec_indexes[found->second]);
+      this->duplicate_count++;
+      this->duplicate_bytes += image_size;
+      return;
+    }
+  } else {
+    this->hashes[hash] = (this->members.size() - 1);
+  }
+
+  // Run stages before huffman, so symbol counts of all members are known before coding
+  TraceSpan span("member transform", "block", {{"index", this->members.size() - 1}, {"bytes", image_size}});
+  this->codec_indexes.push_back(this->codecs.size());
+  this->codecs.emplace_back();
+  this->codecs.back().Transform(image, width, height, this->settings);
+}
+
+/**
+ * Build shared model from symbol counts of all members, scaled to ARCHIVE_MODEL_SIZE symbols
+ * @param[out] model Symbols used to train huffman tree
+ * */
+void ArchiveCompressor::BuildModel(std::vector<uint8_t> &model) {
+  // Count symbols of all members
+  uint64_t counts[N_VALUES] = {0};
+  uint64_t total = 0;
+  for (ImageCodec &codec : this->codecs) {
+    const uint8_t *data = codec.GetBuffer();
+    for (uint64_t i = 0; i < codec.GetSize(); i++) {
+      counts[data[i]]++;
+    }
+    total += codec.GetSize();
+  }
+
+  // Scale counts, every present symbol is in model at least once
+  uint32_t weights[N_VALUES] = {0};
+  uint32_t max_weight = 0;
+  for (uint16_t i = 0; i < N_VALUES; i++) {
+    if (counts[i] > 0) {
+      weights[i] = std::max<uint64_t>(1, (counts[i] * ARCHIVE_MODEL_SIZE) / total);
+      max_weight = std::max(max_weight, weights[i]);
+    }
+  }
+
+  // Interleave symbols, so tree is trained the same way as by mixed data
+  for (uint32_t round = 0; round < max_weight; round++) {
+    for (uint16_t i = 0; i < N_VALUES; i++) {
+      if (weights[i] > round) {
+        model.push_back(i);
+      }
+    }
+  }
+}
+
+/**
+ * Huffman code all members and create archive
+ * @param[in] shared_model True to train huffman tree of each member with model shared by all members
+ * */
+void ArchiveCompressor::Compress(const bool &shared_model) {
+  // Build model shared by all members
+  std::vector<uint8_t> model;
+  if (shared_model) {
+    this->BuildModel(model);
+  }
+
+  // Huffman code each unique member, data follow each other in order of codecs
+  std::vector<uint64_t> offsets;
+  uint64_t offset = 0;
+  for (ImageCodec &codec : this->codecs) {
+    TraceSpan span("member encode", "block", {{"index", offsets.size()}});
+    codec.Encode(model, false);
+    offsets.push_back(offset);
+    offset += codec.GetSize();
+  }
+
+  // Fill directory entries, duplicate members point to data of identical member
+  uint64_t directory_size = 0;
+  for (size_t i = 0; i < this->members.size(); i++) {
+    ImageCodec &codec = this->codecs[this->codec_indexes[i]];
+
+    this->members[i].settings = codec.GetBuffer()[0];
+    this->members[i].offset = offsets[this->codec_indexes[i]];
+    this->members[i].size = codec.GetSize();
+
+    directory_size += ARCHIVE_ENTRY_SIZE + this->members[i].name.size();
+  }
+
+  // Allocate buffer for header, model, directory and data of all members
+  this->encoded_buff = (uint8_t *)malloc(sizeof(uint8_t) * (ARCHIVE_HEADER_SIZE + model.size() + directory_size + offset));
+
+  // Invalid pointer
+  assert(this->encoded_buff != nullptr);
+
+  // Magic bytes of container
+  memcpy(this->encoded_buff, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC));
+  this->encoded_index = sizeof(CONTAINER_MAGIC);
+  this->encoded_buff[this->encoded_index++] = CONTAINER_ARCHIVE;
+
+  // Member count and shared model
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->members.size(), ARCHIVE_VALUE_BYTES);
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, model.size(), ARCHIVE_VALUE_BYTES);
+  if (!model.empty()) {
+    memcpy(&this->encoded_buff[this->encoded_index], model.data(), model.size());
+    this->encoded_index += model.size();
+  }
+
+  // Directory, offsets are counted from the end of directory
+  for (const ArchiveMember &member : this->members) {
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, member.offset, ARCHIVE_OFFSET_BYTES);
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, member.size, ARCHIVE_OFFSET_BYTES);
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, member.width, ARCHIVE_VALUE_BYTES);
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, member.height, ARCHIVE_VALUE_BYTES);
+    this->encoded_buff[this->encoded_index++] = member.settings;
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, member.name.size(), ARCHIVE_NAME_BYTES);
+    memcpy(&this->encoded_buff[this->encoded_index], member.name.data(), member.name.size());
+    this->encoded_index += member.name.size();
+  }
+
+  // Encoded data of members
+  for (ImageCodec &codec : this->codecs) {
+    memcpy(&this->encoded_buff[this->encoded_index], codec.GetBuffer(), codec.GetSize());
+    this->encoded_index += codec.GetSize();
+  }
+}
+
+/**
+ * Return number of members, that reference identical member
+ * @returns Number of duplicate members
+ * */
+uint32_t ArchiveCompressor::GetDuplicateCount() {
+  return this->duplicate_count;
+}
+
+/**
+ * Return number of raw bytes of duplicate members, that were not compressed again
+ * @returns Number of bytes
+ * */
+uint64_t ArchiveCompressor::GetDuplicateBytes() {
+  return this->duplicate_bytes;
+}
+
+/**
+ * Return time spent by hashing of all members
+ * @returns Time in milliseconds
+ * */
+double ArchiveCompressor::GetHashTime() {
+  return this->hash_time;
+}
+
+/**
+ * Return pointer to archive buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & ArchiveCompressor::GetBuffer() {
+  return this->encoded_buff;
+}
+
+/**
+ * Return archive buffer size
+ * @returns Size of buffer
+ * */
+uint64_t & ArchiveCompressor::GetSize() {
+  return this->encoded_index;
+}
@@ -0,0 +1,118 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: archive_compressor.hpp
+ * Description: Contains definitions of archive compressor class that is used to pack
+ * many images into one archive with directory of members
+ * */
+#ifndef __ARCHIVE_COMPRESSOR__
+#define __ARCHIVE_COMPRESSOR__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstring>  // memcpy, memcmp
+#include <string>   // string
+#include <vector>   // vector
+#include <deque>    // deque
+#include <algorithm> // max
+#include <unordered_map> // unordered_map
+#include <chrono>   // steady_clock
+#include <cassert>  // assert
+
+#include "archive.hpp"
+#include "../container.hpp"
+#include "../image_codec.hpp"
+#include "../hash/content_hasher.hpp"
+
+/**
+ * Class that will compress images into archive, all members use the same settings
+ * */
+class ArchiveCompressor {
+private:
+  // Settings of compression pipeline, shared by all members
+  CodecSettings settings;
+
+  // Directory entries and codecs of members, deque keeps codecs on their place
+  std::vector<ArchiveMember> members;
+  std::deque<ImageCodec> codecs;
+
+  // Index of codec of each member, duplicate members share codec of first identical member
+  std::vector<size_t> codec_indexes;
+
+  // Index of first member with given content hash
+  std::unordered_map<ContentHash, size_t, ContentHashKey> hashes;
+
+  // Deduplication statistics, number of duplicate members, their raw bytes and time spent hashing
+  uint32_t duplicate_count;
+  uint64_t duplicate_bytes;
+  double hash_time;
+
+  // Resulting archive
+  uint8_t *encoded_buff;
+  uint64_t encoded_index;
+
+  /**
+   * Build shared model from symbol counts of all members, scaled to ARCHIVE_MODEL_SIZE symbols
+   * @param[out] model Symbols used to train huffman tree
+   * */
+  void BuildModel(std::vector<uint8_t> &model);
+
+public:
+  /**
+   * Constructor that will initialize values
+   * @param[in] settings Settings of compression pipeline, used for each member
+   * */
+  ArchiveCompressor(const CodecSettings &settings);
+
+  /**
+   * Deconstructor that will free allocated data
+   * */
+  ~ArchiveCompressor();
+
+  /**
+   * Add image as member of archive, all stages before huffman coding are done right away,
+   * unless identical image with the same size was already added, then member only references it
+   * @param[in] name Name of member
+   * @param[in] image Image data, that will not be modified
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * */
+  void AddMember(const std::string &name, const uint8_t *image, const uint32_t &width, const uint32_t &height);
+
+  /**
+   * Huffman code all members and create archive
+   * @param[in] shared_model True to train huffman tree of each member with model shared by all members
+   * */
+  void Compress(const bool &shared_model);
+
+  /**
+   * Return number of members, that reference identical member
+   * @returns Number of duplicate members
+   * */
+  uint32_t GetDuplicateCount();
+
+  /**
+   * Return number of raw bytes of duplicate members, that were not compressed again
+   * @returns Number of bytes
+   * */
+  uint64_t GetDuplicateBytes();
+
+  /**
+   * Return time spent by hashing of all members
+   * @returns Time in milliseconds
+   * */
+  double GetHashTime();
+
+  /**
+   * Return pointer to archive buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return archive buffer size
+   * @returns Size of buffer
+   * */
+  uint64_t & GetSize();
+};
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: archive_decompressor.cpp
+ * Description: Contains implementations of archive decompressor class that is used to read
+ * directory of archive and decompress its members
+ * */
+#include "archive_decompressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor for ArchiveDecompressor that will initialize values
+ * @param[in] buffer Data buffer holding archive
+ * @param[in] size Size of data buffer
+ * */
+ArchiveDecompressor::ArchiveDecompressor(uint8_t * &buffer, const uint64_t &size) {
+  // Receive buffer
+  this->buffer = buffer;
+  this->size = size;
+  this->data_start = 0;
+}
+
+/**
+ * Deconstructor
+ * */
+ArchiveDecompressor::~ArchiveDecompressor() {
+  // Destroy pointer to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Read header, shared model and directory of archive
+ * @returns True when archive is valid, false otherwise
+ * */
+bool ArchiveDecompressor::ReadHeader() {
+  // Check magic bytes and size of header
+  if (!IsContainer(this->buffer, this->size, CONTAINER_ARCHIVE) || this->size < ARCHIVE_HEADER_SIZE) {
+    std::cerr << "Data are not archive!" << std::endl;
+    return false;
+  }
+
+  // Load member count and shared model
+  const uint32_t member_count = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE, ARCHIVE_VALUE_BYTES);
+  const uint32_t model_size = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE + ARCHIVE_VALUE_BYTES, ARCHIVE_VALUE_BYTES);
+  uint64_t position = ARCHIVE_HEADER_SIZE;
+  if (model_size > (this->size - position)) {
+    std::cerr << "Archive does not contain whole shared model!" << std::endl;
+    return false;
+  }
+  this->model.assign(&this->buffer[position], &this->buffer[position + model_size]);
+  position += model_size;
+
+  // Load directory entries
+  for (uint32_t i = 0; i < member_count; i++) {
+    if (ARCHIVE_ENTRY_SIZE > (this->size - position)) {
+      std::cerr << "Archive does not contain whole directory!" << std::endl;
+      return false;
+    }
+
+    ArchiveMember member;
+    member.offset = ByteIo::ReadValue(this->buffer, position, ARCHIVE_OFFSET_BYTES);
+    member.size = ByteIo::ReadValue(this->buffer, position + ARCHIVE_OFFSET_BYTES, ARCHIVE_OFFSET_BYTES);
+    member.width = ByteIo::ReadValue(this->buffer, position + 2 * ARCHIVE_OFFSET_BYTES, ARCHIVE_VALUE_BYTES);
+    member.height = ByteIo::ReadValue(this->buffer, position + 2 * ARCHIVE_OFFSET_BYTES + ARCHIVE_VALUE_BYTES, ARCHIVE_VALUE_BYTES);
+    member.settings = this->buffer[position + 2 * ARCHIVE_OFFSET_BYTES + 2 * ARCHIVE_VALUE_BYTES];
+    const uint16_t name_length = ByteIo::ReadValue(this->buffer, position + ARCHIVE_ENTRY_SIZE - ARCHIVE_NAME_BYTES, ARCHIVE_NAME_BYTES);
+    position += ARCHIVE_ENTRY_SIZE;
+
+    if (name_length > (this->size - position)) {
+      std::cerr << "Archive does not contain whole directory!" << std::endl;
+      return false;
+    }
+    member.name.assign(reinterpret_cast<const char *>(&this->buffer[position]), name_length);
+    position += name_length;
+
+    this->members.push_back(member);
+  }
+
+  this->data_start = position;
+  return true;
+}
+
+/**
+ * Find index of member with given name
+ * @param[in] name Name of member
+ * @returns Index of member, or -1 when archive has no such member
+ * */
+int64_t ArchiveDecompressor::FindMember(const std::string &name) {
+  for (size_t i = 0; i < this->members.size(); i++) {
+    if (this->members[i].name == name) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+ * Decompress member with given index, only its encoded data are read
+ * @param[in] index Index of member in directory
+ * @returns True when decompression was successfull, false otherwise
+ * */
+bool ArchiveDecompressor::DecompressMember(const uint32_t &index) {
+  // Member does not exist
+  if (index >= this->members.size()) {
+    std::cerr << "Archive has only " << this->members.size() << " members!" << std::endl;
+    return false;
+  }
+  const ArchiveMember &member = this->members[index];
+
+  // Encoded data of member are outside of archive
+  const uint64_t offset = this->data_start + member.offset;
+  if (member.offset > this->size || offset > this->size || member.size > (this->size - offset)) {
+    std::cerr << "Member " << member.name << " is outside of archive!" << std::endl;
+    return false;
+  }
+
+  // Decompress member with shared model, check it has size from directory
+  TraceSpan span("member decode", "block", {{"index", index}, {"bytes", member.size}});
+  const uint64_t image_size = static_cast<uint64_t>(member.width) * member.height;
+  if (!this->codec.Decompress(&this->buffer[offset], member.size, this->model) || this->codec.GetSize() != image_size) {
+    std::cerr << "Failed to decompress member " << member.name << "!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Return directory of archive
+ * @returns Vector of directory entries
+ * */
+const std::vector<ArchiveMember> & ArchiveDecompressor::GetMembers() {
+  return this->members;
+}
+
+/**
+ * Return pointer to last decompressed member
+ * @returns Pointer to buffer
+ * */
+uint8_t * & ArchiveDecompressor::GetBuffer() {
+  return this->codec.GetBuffer();
+}
+
+/**
+ * Return size of last decompressed member
+ * @returns Size of buffer
+ * */
+uint64_t ArchiveDecompressor::GetSize() {
+  return this->codec.GetSize();
+}
+
+/**
+ * Return maximum error of each pixel of last decompressed member, saved in its settings
+ * @returns Maximum error, 0 for lossless image
+ * */
+uint8_t ArchiveDecompressor::GetMaxError() {
+  return this->codec.GetMaxError();
+}
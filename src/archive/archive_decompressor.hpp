@@ -0,0 +1,100 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: archive_decompressor.hpp
+ * Description: Contains definitions of archive decompressor class that is used to read
+ * directory of archive and decompress its members
+ * */
+#ifndef __ARCHIVE_DECOMPRESSOR__
+#define __ARCHIVE_DECOMPRESSOR__
+
+#include <iostream> // cerr
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <string>   // string
+#include <vector>   // vector
+
+#include "archive.hpp"
+#include "../container.hpp"
+#include "../image_codec.hpp"
+
+/**
+ * Class used for reading archive directory and decompressing members individually
+ * */
+class ArchiveDecompressor {
+private:
+  // Buffer that holds loaded archive
+  uint8_t *buffer;
+  // Size of loaded archive
+  uint64_t size;
+
+  // Model shared by all members, used to train huffman tree
+  std::vector<uint8_t> model;
+
+  // Directory of members
+  std::vector<ArchiveMember> members;
+
+  // Start of encoded data of members, right after directory
+  uint64_t data_start;
+
+  // Codec holding last decompressed member
+  ImageCodec codec;
+
+public:
+  /**
+   * Constructor for ArchiveDecompressor that will initialize values
+   * @param[in] buffer Data buffer holding archive
+   * @param[in] size Size of data buffer
+   * */
+  ArchiveDecompressor(uint8_t * &buffer, const uint64_t &size);
+
+  /**
+   * Deconstructor
+   * */
+  ~ArchiveDecompressor();
+
+  /**
+   * Read header, shared model and directory of archive
+   * @returns True when archive is valid, false otherwise
+   * */
+  bool ReadHeader();
+
+  /**
+   * Find index of member with given name
+   * @param[in] name Name of member
+   * @returns Index of member, or -1 when archive has no such member
+   * */
+  int64_t FindMember(const std::string &name);
+
+  /**
+   * Decompress member with given index, only its encoded data are read
+   * @param[in] index Index of member in directory
+   * @returns True when decompression was successfull, false otherwise
+   * */
+  bool DecompressMember(const uint32_t &index);
+
+  /**
+   * Return directory of archive
+   * @returns Vector of directory entries
+   * */
+  const std::vector<ArchiveMember> & GetMembers();
+
+  /**
+   * Return pointer to last decompressed member
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return size of last decompressed member
+   * @returns Size of buffer
+   * */
+  uint64_t GetSize();
+
+  /**
+   * Return maximum error of each pixel of last decompressed member, saved in its settings
+   * @returns Maximum error, 0 for lossless image
+   * */
+  uint8_t GetMaxError();
+};
+
+#endif
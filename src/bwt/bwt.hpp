@@ -0,0 +1,29 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: bwt.hpp
+ * Description: Contains definitions of constant data for both BWT encoder and decoder
+ * */
+#ifndef __BWT__
+#define __BWT__
+
+#include <cstdint>  // uint8_t, uint32_t
+
+// Constants used both in BwtEncoder and BwtDecoder
+
+// Bit in settings byte (before huffman data), representing that data went through BWT + MTF
+constexpr uint8_t BWT_SETTINGS_BIT = 0x10;
+
+// Default size of one BWT block in bytes
+constexpr uint32_t BWT_DEFAULT_BLOCK_SIZE = (1 << 20);
+
+// Maximum size of one BWT block, so row index fits together with symbol into uint32_t
+constexpr uint32_t BWT_MAX_BLOCK_SIZE = ((1 << 24) - 1);
+
+// Number of bytes used for saving block size and primary index of each block
+constexpr uint8_t BWT_INDEX_BYTES = 3;
+
+// Number of symbols in MTF list
+constexpr uint16_t MTF_SYMBOLS = 256;
+
+#endif
@@ -0,0 +1,201 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: bwt_decoder.cpp
+ * Description: Contains implementations of BWT decoder class that is used to reverse
+ * move-to-front and Burrows-Wheeler transform made by BwtEncoder
+ * */
+#include "bwt_decoder.hpp"
+
+/**
+ * Constructor for BwtDecoder that will initialize values
+ * @param[in] buffer Data buffer holding transformed data
+ * @param[in] size Size of data buffer
+ * */
+BwtDecoder::BwtDecoder(uint8_t * &buffer, const size_t &size) {
+  // Receive buffer
+  this->buffer = buffer;
+  this->size = size;
+  this->index = 0;
+
+  // Initialize original data buffer
+  this->dec_buffer = nullptr;
+  this->dec_buffer_index = 0;
+  this->links = nullptr;
+}
+
+/**
+ * Deconstructor for BwtDecoder that will free allocated data
+ * */
+BwtDecoder::~BwtDecoder() {
+  // Free allocated buffers, when they were allocated
+  if (this->dec_buffer != nullptr) {
+    free(this->dec_buffer);
+  }
+
+  if (this->links != nullptr) {
+    free(this->links);
+  }
+
+  // Destroy pointer to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Read BWT_INDEX_BYTES bytes from buffer as one value, most significant byte first
+ * @param[out] val Read value
+ * @returns True when there were enough bytes in buffer, false otherwise
+ * */
+bool BwtDecoder::ReadIndex(uint32_t &val) {
+  // Not enough bytes in buffer
+  if ((this->index + BWT_INDEX_BYTES) > this->size) {
+    return false;
+  }
+
+  val = 0;
+  for (uint8_t i = 0; i < BWT_INDEX_BYTES; i++) {
+    val = (val << 8) | this->buffer[this->index++];
+  }
+
+  return true;
+}
+
+/**
+ * Reverse move-to-front on given part of buffer
+ * @param[out] data Data to be transformed in place
+ * @param[in] length Number of bytes to be transformed
+ * */
+void BwtDecoder::MoveToFront(uint8_t *data, const size_t &length) {
+  // List of symbols ordered by their last occurrence
+  uint8_t list[MTF_SYMBOLS];
+  for (uint16_t i = 0; i < MTF_SYMBOLS; i++) {
+    list[i] = static_cast<uint8_t>(i);
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t pos = data[i];
+    const uint8_t symbol = list[pos];
+
+    // Move symbol to the front of list
+    memmove(&list[1], &list[0], pos);
+    list[0] = symbol;
+    data[i] = symbol;
+  }
+}
+
+/**
+ * Reverse BWT of one block, last column is read from decoded buffer and original data
+ * are written back to the same place
+ * @param[out] block Last column of block, that will be replaced by original data
+ * @param[in] length Length of block
+ * @param[in] primary Row of BWT matrix, holding the whole block
+ * @returns True when block was reversed, false on invalid data
+ * */
+bool BwtDecoder::ReverseBlock(uint8_t *block, const size_t &length, const uint32_t &primary) {
+  // Row 0 is the end marker, so primary row needs to be between 1 and length
+  if (primary == 0 || primary > length) {
+    return false;
+  }
+
+  // Count symbols, first row of matrix belongs to the end marker
+  uint32_t starts[MTF_SYMBOLS] = {0};
+  for (size_t i = 0; i < length; i++) {
+    starts[block[i]]++;
+  }
+
+  uint32_t sum = 1;
+  for (uint16_t i = 0; i < MTF_SYMBOLS; i++) {
+    const uint32_t count = starts[i];
+    starts[i] = sum;
+    sum += count;
+  }
+
+  // For each row save row of the following suffix together with its first symbol,
+  // so following the links costs only one random memory access per symbol
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t symbol = block[i];
+    const uint32_t row = static_cast<uint32_t>((i < primary) ? i : (i + 1));
+    this->links[starts[symbol]++] = ((row << 8) | symbol);
+  }
+
+  // Row of end marker has no following suffix, keep it pointing to itself on invalid data
+  this->links[0] = 0;
+
+  // Walk rows from the whole block, writing one symbol per row
+  uint32_t row = primary;
+  for (size_t i = 0; i < length; i++) {
+    const uint32_t link = this->links[row];
+    block[i] = (link & 0xFF);
+    row = (link >> 8);
+  }
+
+  return true;
+}
+
+/**
+ * Reverse BWT and MTF of all blocks
+ * @returns True when all blocks were reversed, false otherwise
+ * */
+bool BwtDecoder::Decode() {
+  uint32_t block_size = 0;
+
+  // Load size of blocks
+  if (!this->ReadIndex(block_size) || block_size == 0) {
+    std::cerr << "Invalid BWT block size!" << std::endl;
+    return false;
+  }
+
+  // Original data are never bigger than transformed data
+  this->dec_buffer = (uint8_t *)malloc(sizeof(uint8_t) * (this->size + 1));
+  this->links = (uint32_t *)malloc(sizeof(uint32_t) * (block_size + 1));
+
+  // Invalid allocation
+  assert(this->dec_buffer != nullptr && this->links != nullptr);
+
+  // Reverse each block
+  while (this->index < this->size) {
+    uint32_t primary = 0;
+
+    // Every block starts with its primary index
+    if (!this->ReadIndex(primary)) {
+      std::cerr << "Missing BWT primary index!" << std::endl;
+      return false;
+    }
+
+    // Last block may be shorter
+    const size_t remaining = this->size - this->index;
+    const size_t length = (remaining < block_size) ? remaining : block_size;
+    uint8_t *block = &this->dec_buffer[this->dec_buffer_index];
+    TraceSpan span("bwt block decode", "block", {{"offset", this->dec_buffer_index}, {"bytes", length}});
+
+    // Copy block and reverse both transformations
+    memcpy(block, &this->buffer[this->index], length);
+    this->MoveToFront(block, length);
+
+    if (!this->ReverseBlock(block, length, primary)) {
+      std::cerr << "Invalid BWT primary index!" << std::endl;
+      return false;
+    }
+
+    this->index += length;
+    this->dec_buffer_index += length;
+  }
+
+  return true;
+}
+
+/**
+ * Return pointer to original data buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & BwtDecoder::GetBuffer() {
+  return this->dec_buffer;
+}
+
+/**
+ * Return original data buffer size
+ * @returns Size of buffer
+ * */
+size_t BwtDecoder::GetSize() {
+  return this->dec_buffer_index;
+}
@@ -0,0 +1,95 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: bwt_decoder.hpp
+ * Description: Contains definitions of BWT decoder class that is used to reverse
+ * move-to-front and Burrows-Wheeler transform made by BwtEncoder
+ * */
+#ifndef __BWT_DECODER__
+#define __BWT_DECODER__
+
+#include <iostream> // cerr
+#include <cstdint>  // uint8_t, uint32_t
+#include <cstring>  // memmove
+#include <cassert>  // assert
+
+#include "bwt.hpp"
+#include "../stats/trace_recorder.hpp"
+
+/**
+ * Class used for reversing data transformed by class BwtEncoder
+ * */
+class BwtDecoder {
+private:
+  // Buffer that holds transformed data
+  const uint8_t *buffer;
+  // Size of transformed data buffer
+  size_t size;
+  // Current index in transformed data buffer
+  size_t index;
+
+  // Buffer for holding original data
+  uint8_t *dec_buffer;
+  // Current index in original data buffer
+  size_t dec_buffer_index;
+
+  // Links between rows of BWT matrix, reused by all blocks
+  uint32_t *links;
+
+  /**
+   * Read BWT_INDEX_BYTES bytes from buffer as one value, most significant byte first
+   * @param[out] val Read value
+   * @returns True when there were enough bytes in buffer, false otherwise
+   * */
+  bool ReadIndex(uint32_t &val);
+
+  /**
+   * Reverse move-to-front on given part of buffer
+   * @param[out] data Data to be transformed in place
+   * @param[in] length Number of bytes to be transformed
+   * */
+  void MoveToFront(uint8_t *data, const size_t &length);
+
+  /**
+   * Reverse BWT of one block, last column is read from decoded buffer and original data
+   * are written back to the same place
+   * @param[out] block Last column of block, that will be replaced by original data
+   * @param[in] length Length of block
+   * @param[in] primary Row of BWT matrix, holding the whole block
+   * @returns True when block was reversed, false on invalid data
+   * */
+  bool ReverseBlock(uint8_t *block, const size_t &length, const uint32_t &primary);
+
+public:
+  /**
+   * Constructor for BwtDecoder that will initialize values
+   * @param[in] buffer Data buffer holding transformed data
+   * @param[in] size Size of data buffer
+   * */
+  BwtDecoder(uint8_t * &buffer, const size_t &size);
+
+  /**
+   * Deconstructor for BwtDecoder that will free allocated data
+   * */
+  ~BwtDecoder();
+
+  /**
+   * Reverse BWT and MTF of all blocks
+   * @returns True when all blocks were reversed, false otherwise
+   * */
+  bool Decode();
+
+  /**
+   * Return pointer to original data buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return original data buffer size
+   * @returns Size of buffer
+   * */
+  size_t GetSize();
+};
+
+#endif
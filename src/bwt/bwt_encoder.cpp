@@ -0,0 +1,298 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: bwt_encoder.cpp
+ * Description: Contains implementations of BWT encoder class that is used to transform
+ * data with Burrows-Wheeler transform followed by move-to-front
+ * */
+#include "bwt_encoder.hpp"
+
+/**
+ * Constructor that will initialize values
+ * @param[in] buffer Buffer with data to be transformed
+ * @param[in] size Size of buffer
+ * */
+BwtEncoder::BwtEncoder(const uint8_t *buffer, const size_t &size) {
+  // Set buffer which we will be transforming
+  this->buffer = buffer;
+  this->size = size;
+
+  // Set transformed buffer data
+  this->encoded_buff = nullptr;
+  this->encoded_index = 0;
+}
+
+/**
+ * Deconstructor that will free allocated data
+ * */
+BwtEncoder::~BwtEncoder() {
+  // When buffer was allocated, free him
+  if (this->encoded_buff) {
+    free(this->encoded_buff);
+  }
+
+  // Remove pointer pointing to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Construct suffix array of given string with SA-IS algorithm in linear time
+ * @param[in] str String of symbols in range <0, upper>
+ * @param[in] upper Highest symbol that may occur in string
+ * @returns Suffix array of string
+ * */
+std::vector<int32_t> BwtEncoder::SuffixArray(const std::vector<int32_t> &str, const int32_t &upper) {
+  const int32_t n = static_cast<int32_t>(str.size());
+
+  // Trivial strings, that does not need to be sorted
+  if (n == 0) {
+    return {};
+  }
+  if (n == 1) {
+    return {0};
+  }
+  if (n == 2) {
+    return (str[0] < str[1]) ? std::vector<int32_t>{0, 1} : std::vector<int32_t>{1, 0};
+  }
+
+  std::vector<int32_t> sa(n);
+
+  // Type of each suffix, true for S-type, false for L-type, last suffix is L-type
+  std::vector<bool> s_type(n, false);
+  for (int32_t i = n - 2; i >= 0; i--) {
+    s_type[i] = (str[i] == str[i + 1]) ? s_type[i + 1] : (str[i] < str[i + 1]);
+  }
+
+  // Start of L-type and S-type part of each bucket
+  std::vector<int32_t> sum_l(upper + 1, 0);
+  std::vector<int32_t> sum_s(upper + 1, 0);
+  for (int32_t i = 0; i < n; i++) {
+    if (!s_type[i]) {
+      sum_s[str[i]]++;
+    } else {
+      sum_l[str[i] + 1]++;
+    }
+  }
+  for (int32_t i = 0; i <= upper; i++) {
+    sum_s[i] += sum_l[i];
+    if (i < upper) {
+      sum_l[i + 1] += sum_s[i];
+    }
+  }
+
+  // Induce order of all suffixes from given order of LMS suffixes
+  auto induce = [&](const std::vector<int32_t> &lms) {
+    std::vector<int32_t> bucket(upper + 1);
+    std::fill(sa.begin(), sa.end(), -1);
+
+    // Place LMS suffixes to the S-type part of their buckets
+    std::copy(sum_s.begin(), sum_s.end(), bucket.begin());
+    for (const int32_t &d : lms) {
+      if (d != n) {
+        sa[bucket[str[d]]++] = d;
+      }
+    }
+
+    // Induce L-type suffixes from left to right
+    std::copy(sum_l.begin(), sum_l.end(), bucket.begin());
+    sa[bucket[str[n - 1]]++] = n - 1;
+    for (int32_t i = 0; i < n; i++) {
+      const int32_t v = sa[i];
+      if (v >= 1 && !s_type[v - 1]) {
+        sa[bucket[str[v - 1]]++] = v - 1;
+      }
+    }
+
+    // Induce S-type suffixes from right to left
+    std::copy(sum_l.begin(), sum_l.end(), bucket.begin());
+    for (int32_t i = n - 1; i >= 0; i--) {
+      const int32_t v = sa[i];
+      if (v >= 1 && s_type[v - 1]) {
+        sa[--bucket[str[v - 1] + 1]] = v - 1;
+      }
+    }
+  };
+
+  // Find all LMS positions, and map them to their order in string
+  std::vector<int32_t> lms_map(n + 1, -1);
+  std::vector<int32_t> lms;
+  for (int32_t i = 1; i < n; i++) {
+    if (!s_type[i - 1] && s_type[i]) {
+      lms_map[i] = static_cast<int32_t>(lms.size());
+      lms.push_back(i);
+    }
+  }
+  const int32_t m = static_cast<int32_t>(lms.size());
+
+  // Sort LMS substrings
+  induce(lms);
+
+  // When there are LMS suffixes, sort them recursively through reduced string
+  if (m > 0) {
+    std::vector<int32_t> sorted_lms;
+    sorted_lms.reserve(m);
+    for (const int32_t &v : sa) {
+      if (lms_map[v] != -1) {
+        sorted_lms.push_back(v);
+      }
+    }
+
+    // Name LMS substrings, equal substrings will get the same name
+    std::vector<int32_t> reduced(m);
+    int32_t reduced_upper = 0;
+    reduced[lms_map[sorted_lms[0]]] = 0;
+    for (int32_t i = 1; i < m; i++) {
+      int32_t l = sorted_lms[i - 1];
+      int32_t r = sorted_lms[i];
+      const int32_t end_l = (lms_map[l] + 1 < m) ? lms[lms_map[l] + 1] : n;
+      const int32_t end_r = (lms_map[r] + 1 < m) ? lms[lms_map[r] + 1] : n;
+      bool same = true;
+
+      // Compare both substrings, including their ending LMS symbol
+      if (end_l - l != end_r - r) {
+        same = false;
+      } else {
+        while (l < end_l && str[l] == str[r]) {
+          l++;
+          r++;
+        }
+        if (l == n || str[l] != str[r]) {
+          same = false;
+        }
+      }
+
+      if (!same) {
+        reduced_upper++;
+      }
+      reduced[lms_map[sorted_lms[i]]] = reduced_upper;
+    }
+
+    // Sort reduced string and induce final order from sorted LMS suffixes
+    std::vector<int32_t> reduced_sa = this->SuffixArray(reduced, reduced_upper);
+    for (int32_t i = 0; i < m; i++) {
+      sorted_lms[i] = lms[reduced_sa[i]];
+    }
+    induce(sorted_lms);
+  }
+
+  return sa;
+}
+
+/**
+ * Append value to buffer as BWT_INDEX_BYTES bytes, most significant byte first
+ * @param[in] val Value to be added to buffer
+ * */
+void BwtEncoder::AppendIndex(uint32_t val) {
+  for (int8_t i = (BWT_INDEX_BYTES - 1); i >= 0; i--) {
+    this->encoded_buff[this->encoded_index++] = ((val >> (i * 8)) & 0xFF);
+  }
+}
+
+/**
+ * Transform one block with BWT and append primary index with last column to buffer
+ * @param[in] block Pointer to the start of block
+ * @param[in] length Length of block
+ * */
+void BwtEncoder::TransformBlock(const uint8_t *block, const size_t &length) {
+  // Convert block to string of symbols for suffix sorting
+  std::vector<int32_t> str(block, block + length);
+  std::vector<int32_t> sa = this->SuffixArray(str, (MTF_SYMBOLS - 1));
+
+  // Reserve place for primary index, it is known only after last column is written
+  const size_t primary_pos = this->encoded_index;
+  this->encoded_index += BWT_INDEX_BYTES;
+  uint8_t *last_column = &this->encoded_buff[this->encoded_index];
+
+  // First row is the suffix of end marker, preceded by last symbol of block
+  uint32_t primary = 0;
+  last_column[0] = block[length - 1];
+  size_t out = 1;
+
+  // Every other row holds symbol preceding its suffix, row of whole block holds end marker
+  for (size_t i = 0; i < length; i++) {
+    if (sa[i] == 0) {
+      primary = static_cast<uint32_t>(i + 1);
+      continue;
+    }
+    last_column[out++] = block[sa[i] - 1];
+  }
+
+  // Write primary index before last column
+  const size_t end = this->encoded_index + length;
+  this->encoded_index = primary_pos;
+  this->AppendIndex(primary);
+  this->encoded_index = end;
+
+  // Skewed symbols of last column are turned to small values
+  this->MoveToFront(last_column, length);
+}
+
+/**
+ * Apply move-to-front on given part of buffer
+ * @param[out] data Data to be transformed in place
+ * @param[in] length Number of bytes to be transformed
+ * */
+void BwtEncoder::MoveToFront(uint8_t *data, const size_t &length) {
+  // List of symbols ordered by their last occurrence
+  uint8_t list[MTF_SYMBOLS];
+  for (uint16_t i = 0; i < MTF_SYMBOLS; i++) {
+    list[i] = static_cast<uint8_t>(i);
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t symbol = data[i];
+
+    // Find position of symbol in list
+    uint8_t pos = 0;
+    while (list[pos] != symbol) {
+      pos++;
+    }
+
+    // Move symbol to the front of list
+    memmove(&list[1], &list[0], pos);
+    list[0] = symbol;
+    data[i] = pos;
+  }
+}
+
+/**
+ * Transform whole buffer with BWT and MTF, block by block
+ * @param[in] block_size Size of one block, value from 1 to BWT_MAX_BLOCK_SIZE
+ * */
+void BwtEncoder::Encode(const uint32_t &block_size) {
+  assert(block_size > 0 && block_size <= BWT_MAX_BLOCK_SIZE);
+
+  // Every block adds only its primary index, and whole data the block size
+  const size_t blocks = (this->size + block_size - 1) / block_size;
+  this->encoded_buff = (uint8_t *)malloc(sizeof(uint8_t) * (this->size + (blocks + 1) * BWT_INDEX_BYTES));
+
+  // Invalid pointer
+  assert(this->encoded_buff != nullptr);
+
+  // Save block size, so decoder knows where blocks end
+  this->encoded_index = 0;
+  this->AppendIndex(block_size);
+
+  // Transform each block
+  for (size_t i = 0; i < this->size; i += block_size) {
+    const size_t length = ((this->size - i) < block_size) ? (this->size - i) : block_size;
+    TraceSpan span("bwt block", "block", {{"offset", i}, {"bytes", length}});
+    this->TransformBlock(&this->buffer[i], length);
+  }
+}
+
+/**
+ * Return pointer to transformed data buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & BwtEncoder::GetBuffer() {
+  return this->encoded_buff;
+}
+
+/**
+ * Return transformed data buffer size
+ * @returns Size of buffer
+ * */
+size_t & BwtEncoder::GetSize() {
+  return this->encoded_index;
+}
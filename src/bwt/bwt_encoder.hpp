@@ -0,0 +1,95 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: bwt_encoder.hpp
+ * Description: Contains definitions of BWT encoder class that is used to transform
+ * data with Burrows-Wheeler transform followed by move-to-front
+ * */
+#ifndef __BWT_ENCODER__
+#define __BWT_ENCODER__
+
+#include <cstdint>  // uint8_t, int32_t
+#include <cstring>  // memcpy, memmove
+#include <vector>   // vector
+#include <algorithm> // fill, copy
+#include <cassert>  // assert
+
+#include "bwt.hpp"
+#include "../stats/trace_recorder.hpp"
+
+/**
+ * Class that will transform data block by block with BWT and MTF
+ * */
+class BwtEncoder {
+private:
+  // Buffer with data to be transformed
+  const uint8_t *buffer;
+  // Size of data buffer
+  size_t size;
+
+  // Buffer holding transformed data
+  uint8_t *encoded_buff;
+  // Current index in transformed data buffer
+  size_t encoded_index;
+
+  /**
+   * Construct suffix array of given string with SA-IS algorithm in linear time
+   * @param[in] str String of symbols in range <0, upper>
+   * @param[in] upper Highest symbol that may occur in string
+   * @returns Suffix array of string
+   * */
+  std::vector<int32_t> SuffixArray(const std::vector<int32_t> &str, const int32_t &upper);
+
+  /**
+   * Append value to buffer as BWT_INDEX_BYTES bytes, most significant byte first
+   * @param[in] val Value to be added to buffer
+   * */
+  void AppendIndex(uint32_t val);
+
+  /**
+   * Transform one block with BWT and append primary index with last column to buffer
+   * @param[in] block Pointer to the start of block
+   * @param[in] length Length of block
+   * */
+  void TransformBlock(const uint8_t *block, const size_t &length);
+
+  /**
+   * Apply move-to-front on given part of buffer
+   * @param[out] data Data to be transformed in place
+   * @param[in] length Number of bytes to be transformed
+   * */
+  void MoveToFront(uint8_t *data, const size_t &length);
+
+public:
+  /**
+   * Constructor that will initialize values
+   * @param[in] buffer Buffer with data to be transformed
+   * @param[in] size Size of buffer
+   * */
+  BwtEncoder(const uint8_t *buffer, const size_t &size);
+
+  /**
+   * Deconstructor that will free allocated data
+   * */
+  ~BwtEncoder();
+
+  /**
+   * Transform whole buffer with BWT and MTF, block by block
+   * @param[in] block_size Size of one block, value from 1 to BWT_MAX_BLOCK_SIZE
+   * */
+  void Encode(const uint32_t &block_size);
+
+  /**
+   * Return pointer to transformed data buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return transformed data buffer size
+   * @returns Size of buffer
+   * */
+  size_t & GetSize();
+};
+
+#endif
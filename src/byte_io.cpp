@@ -0,0 +1,58 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: byte_io.cpp
+ * Description: Contains implementations of ByteIo class, that is used by all containers to write and read
+ * values of given number of bytes, most significant byte first
+ * */
+#include "byte_io.hpp"
+
+/**
+ * Write value as given number of bytes, most significant byte first
+ * @param[out] data Data, where value is written
+ * @param[in] val Value to be written
+ * @param[in] bytes Number of bytes
+ * */
+void ByteIo::WriteValue(uint8_t *data, const uint64_t &val, const uint8_t &bytes) {
+  for (uint8_t i = 0; i < bytes; i++) {
+    data[i] = ((val >> ((bytes - 1 - i) * 8)) & 0xFF);
+  }
+}
+
+/**
+ * Append value to buffer as given number of bytes, most significant byte first
+ * @param[out] buffer Buffer with enough space after index
+ * @param[in,out] index Position of first byte, moved behind value
+ * @param[in] val Value to be added to buffer
+ * @param[in] bytes Number of bytes
+ * */
+void ByteIo::AppendValue(uint8_t *buffer, uint64_t &index, const uint64_t &val, const uint8_t &bytes) {
+  WriteValue(&buffer[index], val, bytes);
+  index += bytes;
+}
+
+/**
+ * Append value to buffer as given number of bytes, most significant byte first
+ * @param[out] buffer Buffer where value will be added
+ * @param[in] val Value to be added to buffer
+ * @param[in] bytes Number of bytes
+ * */
+void ByteIo::AppendValue(std::vector<uint8_t> &buffer, const uint64_t &val, const uint8_t &bytes) {
+  buffer.resize(buffer.size() + bytes);
+  WriteValue(&buffer[buffer.size() - bytes], val, bytes);
+}
+
+/**
+ * Read value of given number of bytes from given position, most significant byte first
+ * @param[in] data Data holding value
+ * @param[in] position Position of first byte
+ * @param[in] bytes Number of bytes
+ * @returns Read value
+ * */
+uint64_t ByteIo::ReadValue(const uint8_t *data, const uint64_t &position, const uint8_t &bytes) {
+  uint64_t val = 0;
+  for (uint8_t i = 0; i < bytes; i++) {
+    val = (val << 8) | data[position + i];
+  }
+  return val;
+}
@@ -0,0 +1,54 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: byte_io.hpp
+ * Description: Contains definitions of ByteIo class, that is used by all containers to write and read
+ * values of given number of bytes, most significant byte first
+ * */
+#ifndef __BYTE_IO__
+#define __BYTE_IO__
+
+#include <cstdint>  // uint8_t, uint64_t
+#include <vector>   // vector
+
+/**
+ * Class with serialization of values shared by headers, indexes and trailers of all containers
+ * */
+class ByteIo {
+public:
+  /**
+   * Write value as given number of bytes, most significant byte first
+   * @param[out] data Data, where value is written
+   * @param[in] val Value to be written
+   * @param[in] bytes Number of bytes
+   * */
+  static void WriteValue(uint8_t *data, const uint64_t &val, const uint8_t &bytes);
+
+  /**
+   * Append value to buffer as given number of bytes, most significant byte first
+   * @param[out] buffer Buffer with enough space after index
+   * @param[in,out] index Position of first byte, moved behind value
+   * @param[in] val Value to be added to buffer
+   * @param[in] bytes Number of bytes
+   * */
+  static void AppendValue(uint8_t *buffer, uint64_t &index, const uint64_t &val, const uint8_t &bytes);
+
+  /**
+   * Append value to buffer as given number of bytes, most significant byte first
+   * @param[out] buffer Buffer where value will be added
+   * @param[in] val Value to be added to buffer
+   * @param[in] bytes Number of bytes
+   * */
+  static void AppendValue(std::vector<uint8_t> &buffer, const uint64_t &val, const uint8_t &bytes);
+
+  /**
+   * Read value of given number of bytes from given position, most significant byte first
+   * @param[in] data Data holding value
+   * @param[in] position Position of first byte
+   * @param[in] bytes Number of bytes
+   * @returns Read value
+   * */
+  static uint64_t ReadValue(const uint8_t *data, const uint64_t &position, const uint8_t &bytes);
+};
+
+#endif
@@ -0,0 +1,149 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: block_checksum.cpp
+ * Description: Contains implementations of BlockChecksum class, that is used to create checksum trailer
+ * of encoded data and to check encoded data against it without decoding them
+ * */
+#include "block_checksum.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor for BlockChecksum that will initialize values
+ * @param[in] buffer Data buffer holding data with trailer
+ * @param[in] size Size of data buffer
+ * */
+BlockChecksum::BlockChecksum(uint8_t * &buffer, const uint64_t &size) {
+  // Receive buffer
+  this->buffer = buffer;
+  this->size = size;
+
+  // Initialize trailer values
+  this->block_size = 0;
+  this->data_size = 0;
+  this->block_count = 0;
+}
+
+/**
+ * Deconstructor for BlockChecksum
+ * */
+BlockChecksum::~BlockChecksum() {
+  // Destroy pointer to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Create checksum trailer of given data
+ * @param[in] data Data to be checked
+ * @param[in] size Size of data
+ * @returns Trailer to be saved right after data
+ * */
+std::vector<uint8_t> BlockChecksum::CreateTrailer(const uint8_t *data, const uint64_t &size) {
+  const uint64_t block_count = (size + CHECKSUM_BLOCK_SIZE - 1) / CHECKSUM_BLOCK_SIZE;
+  std::vector<uint8_t> trailer;
+  trailer.reserve(block_count * CHECKSUM_VALUE_BYTES + CHECKSUM_TRAILER_SIZE);
+
+  // Checksum of each block
+  for (uint64_t offset = 0; offset < size; offset += CHECKSUM_BLOCK_SIZE) {
+    const uint64_t length = std::min<uint64_t>(CHECKSUM_BLOCK_SIZE, size - offset);
+    ByteIo::AppendValue(trailer, Crc32c::Compute(&data[offset], length), CHECKSUM_VALUE_BYTES);
+  }
+
+  // Block size and size of data, protected by checksum of whole trailer
+  ByteIo::AppendValue(trailer, CHECKSUM_BLOCK_SIZE, CHECKSUM_VALUE_BYTES);
+  ByteIo::AppendValue(trailer, size, CHECKSUM_SIZE_BYTES);
+  ByteIo::AppendValue(trailer, Crc32c::Compute(trailer.data(), trailer.size()), CHECKSUM_VALUE_BYTES);
+
+  // Magic bytes at the very end, so trailer can be found from end of file
+  trailer.insert(trailer.end(), CONTAINER_MAGIC, CONTAINER_MAGIC + sizeof(CONTAINER_MAGIC));
+  trailer.push_back(CONTAINER_CHECKSUM);
+  return trailer;
+}
+
+/**
+ * Return whether data end with magic bytes of checksum trailer
+ * @returns True when trailer is present, false otherwise
+ * */
+bool BlockChecksum::HasTrailer() {
+  return this->size >= CHECKSUM_TRAILER_SIZE &&
+    IsContainer(&this->buffer[this->size - CONTAINER_MAGIC_SIZE], CONTAINER_MAGIC_SIZE, CONTAINER_CHECKSUM);
+}
+
+/**
+ * Read trailer and check that it is not damaged
+ * @returns True when trailer is valid, false otherwise
+ * */
+bool BlockChecksum::ReadTrailer() {
+  if (!this->HasTrailer()) {
+    std::cerr << "Data do not contain checksums!" << std::endl;
+    return false;
+  }
+
+  // Block size and size of data are before checksum of trailer and magic bytes
+  const uint64_t end = this->size - CONTAINER_MAGIC_SIZE - CHECKSUM_VALUE_BYTES;
+  this->data_size = ByteIo::ReadValue(this->buffer, end - CHECKSUM_SIZE_BYTES, CHECKSUM_SIZE_BYTES);
+  this->block_size = ByteIo::ReadValue(this->buffer, end - CHECKSUM_SIZE_BYTES - CHECKSUM_VALUE_BYTES, CHECKSUM_VALUE_BYTES);
+
+  // Trailer needs to end exactly at the end of data
+  if (this->block_size == 0 || this->data_size > this->size) {
+    std::cerr << "Checksum trailer is damaged!" << std::endl;
+    return false;
+  }
+  this->block_count = (this->data_size + this->block_size - 1) / this->block_size;
+  if ((this->size - this->data_size) != (this->block_count * CHECKSUM_VALUE_BYTES + CHECKSUM_TRAILER_SIZE)) {
+    std::cerr << "Checksum trailer is damaged!" << std::endl;
+    return false;
+  }
+
+  // Checksum of trailer covers checksums of blocks, block size and size of data
+  if (Crc32c::Compute(&this->buffer[this->data_size], end - this->data_size) != ByteIo::ReadValue(this->buffer, end, CHECKSUM_VALUE_BYTES)) {
+    std::cerr << "Checksum trailer is damaged!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Check every block of data against its checksum
+ * @returns True when all blocks match, false otherwise
+ * */
+bool BlockChecksum::Verify() {
+  this->bad_blocks.clear();
+
+  for (uint64_t i = 0; i < this->block_count; i++) {
+    const uint64_t offset = i * this->block_size;
+    const uint64_t length = std::min<uint64_t>(this->block_size, this->data_size - offset);
+    const uint32_t expected = ByteIo::ReadValue(this->buffer, this->data_size + i * CHECKSUM_VALUE_BYTES, CHECKSUM_VALUE_BYTES);
+
+    if (Crc32c::Compute(&this->buffer[offset], length) != expected) {
+      this->bad_blocks.push_back(i);
+    }
+  }
+
+  return this->bad_blocks.empty();
+}
+
+/**
+ * Return size of data without trailer
+ * @returns Size of data
+ * */
+uint64_t BlockChecksum::GetDataSize() {
+  return this->data_size;
+}
+
+/**
+ * Return number of checked blocks
+ * @returns Number of blocks
+ * */
+uint64_t BlockChecksum::GetBlockCount() {
+  return this->block_count;
+}
+
+/**
+ * Return indexes of blocks, that do not match their checksum
+ * @returns Indexes of blocks
+ * */
+const std::vector<uint64_t> & BlockChecksum::GetBadBlocks() {
+  return this->bad_blocks;
+}
@@ -0,0 +1,97 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: block_checksum.hpp
+ * Description: Contains definitions of BlockChecksum class, that is used to create checksum trailer
+ * of encoded data and to check encoded data against it without decoding them
+ * */
+#ifndef __BLOCK_CHECKSUM__
+#define __BLOCK_CHECKSUM__
+
+#include <iostream> // cerr
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <vector>   // vector
+#include <algorithm> // min
+
+#include "checksum.hpp"
+#include "crc32c.hpp"
+#include "../container.hpp"
+
+/**
+ * Class that checks data against checksum trailer at their end, trailer consists of CRC32C of each
+ * block, block size, size of data, CRC32C of trailer and magic bytes
+ * */
+class BlockChecksum {
+private:
+  // Buffer that holds loaded data with trailer
+  uint8_t *buffer;
+  // Size of loaded data with trailer
+  uint64_t size;
+
+  // Values from trailer
+  uint32_t block_size;
+  uint64_t data_size;
+  uint64_t block_count;
+
+  // Indexes of blocks, that do not match their checksum
+  std::vector<uint64_t> bad_blocks;
+
+public:
+  /**
+   * Constructor for BlockChecksum that will initialize values
+   * @param[in] buffer Data buffer holding data with trailer
+   * @param[in] size Size of data buffer
+   * */
+  BlockChecksum(uint8_t * &buffer, const uint64_t &size);
+
+  /**
+   * Deconstructor for BlockChecksum
+   * */
+  ~BlockChecksum();
+
+  /**
+   * Create checksum trailer of given data
+   * @param[in] data Data to be checked
+   * @param[in] size Size of data
+   * @returns Trailer to be saved right after data
+   * */
+  static std::vector<uint8_t> CreateTrailer(const uint8_t *data, const uint64_t &size);
+
+  /**
+   * Return whether data end with magic bytes of checksum trailer
+   * @returns True when trailer is present, false otherwise
+   * */
+  bool HasTrailer();
+
+  /**
+   * Read trailer and check that it is not damaged
+   * @returns True when trailer is valid, false otherwise
+   * */
+  bool ReadTrailer();
+
+  /**
+   * Check every block of data against its checksum
+   * @returns True when all blocks match, false otherwise
+   * */
+  bool Verify();
+
+  /**
+   * Return size of data without trailer
+   * @returns Size of data
+   * */
+  uint64_t GetDataSize();
+
+  /**
+   * Return number of checked blocks
+   * @returns Number of blocks
+   * */
+  uint64_t GetBlockCount();
+
+  /**
+   * Return indexes of blocks, that do not match their checksum
+   * @returns Indexes of blocks
+   * */
+  const std::vector<uint64_t> & GetBadBlocks();
+};
+
+#endif
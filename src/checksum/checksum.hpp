@@ -0,0 +1,25 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: checksum.hpp
+ * Description: Contains definitions of constant data of checksum trailer, that is saved after
+ * encoded data and holds CRC32C of each block of them
+ * */
+#ifndef __CHECKSUM__
+#define __CHECKSUM__
+
+#include <cstdint>  // uint8_t, uint32_t
+
+// Number of bytes covered by one checksum, last block may be shorter
+constexpr uint32_t CHECKSUM_BLOCK_SIZE = 65536;
+
+// Number of bytes of checksum and of block size
+constexpr uint8_t CHECKSUM_VALUE_BYTES = 4;
+
+// Number of bytes of size of checked data
+constexpr uint8_t CHECKSUM_SIZE_BYTES = 8;
+
+// Size of trailer after checksums of blocks: block size, size of data, checksum of trailer and magic bytes
+constexpr uint8_t CHECKSUM_TRAILER_SIZE = 2 * CHECKSUM_VALUE_BYTES + CHECKSUM_SIZE_BYTES + 4;
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: crc32c.cpp
+ * Description: Contains implementations of Crc32c class, that is used to compute CRC32C (Castagnoli)
+ * of data, with SSE4.2 crc32 instruction when processor supports it
+ * */
+#include "crc32c.hpp"
+
+// Reversed Castagnoli polynomial
+constexpr uint32_t CRC32C_POLYNOMIAL = 0x82F63B78;
+
+/**
+ * Lookup tables for slicing-by-8, table k holds CRC of byte followed by k zero bytes
+ * */
+struct Crc32cTables {
+  uint32_t table[8][256];
+
+  constexpr Crc32cTables() : table() {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t crc = i;
+      for (uint8_t bit = 0; bit < 8; bit++) {
+        crc = (crc >> 1) ^ ((crc & 1) ? CRC32C_POLYNOMIAL : 0);
+      }
+      this->table[0][i] = crc;
+    }
+
+    for (uint32_t i = 0; i < 256; i++) {
+      for (uint8_t k = 1; k < 8; k++) {
+        const uint32_t previous = this->table[k - 1][i];
+        this->table[k][i] = (previous >> 8) ^ this->table[0][previous & 0xFF];
+      }
+    }
+  }
+};
+
+constexpr Crc32cTables CRC32C_TABLES;
+
+/**
+ * Update CRC by lookup tables, 8 bytes at once
+ * @param[in] crc Inverted CRC of previous data
+ * @param[in] data Data to be added
+ * @param[in] size Size of data
+ * @returns Inverted CRC
+ * */
+uint32_t Crc32c::UpdateTable(uint32_t crc, const uint8_t *data, size_t size) {
+  const auto &table = CRC32C_TABLES.table;
+
+  // 8 bytes at once, first 4 bytes are mixed with CRC
+  for (; size >= 8; size -= 8, data += 8) {
+    const uint32_t low = crc ^ (data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24));
+    crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+      table[3][data[4]] ^ table[2][data[5]] ^ table[1][data[6]] ^ table[0][data[7]];
+  }
+
+  // Remaining bytes
+  for (; size > 0; size--, data++) {
+    crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xFF];
+  }
+  return crc;
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+/**
+ * Update CRC by SSE4.2 crc32 instruction, 8 bytes at once
+ * @param[in] crc Inverted CRC of previous data
+ * @param[in] data Data to be added
+ * @param[in] size Size of data
+ * @returns Inverted CRC
+ * */
+__attribute__((target("sse4.2")))
+uint32_t Crc32c::UpdateHardware(uint32_t crc, const uint8_t *data, size_t size) {
+  uint64_t crc64 = crc;
+
+  // 8 bytes at once, crc32 instruction uses the same bit order as lookup tables
+  for (; size >= 8; size -= 8, data += 8) {
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+    crc64 = _mm_crc32_u64(crc64, value);
+  }
+  crc = static_cast<uint32_t>(crc64);
+
+  // Remaining bytes
+  for (; size > 0; size--, data++) {
+    crc = _mm_crc32_u8(crc, *data);
+  }
+  return crc;
+}
+#endif
+
+/**
+ * Return whether crc32 instruction is used
+ * @returns True when processor supports SSE4.2, false otherwise
+ * */
+bool Crc32c::IsHardware() {
+#if defined(__GNUC__) && defined(__x86_64__)
+  static const bool supported = __builtin_cpu_supports("sse4.2");
+  return supported;
+#else
+  return false;
+#endif
+}
+
+/**
+ * Compute CRC32C of data, continuing from CRC of data before them
+ * @param[in] data Data to be checked
+ * @param[in] size Size of data
+ * @param[in] crc CRC of previous data, 0 for start of data
+ * @returns CRC of all data
+ * */
+uint32_t Crc32c::Compute(const uint8_t *data, const size_t &size, const uint32_t &crc) {
+#if defined(__GNUC__) && defined(__x86_64__)
+  if (IsHardware()) {
+    return ~UpdateHardware(~crc, data, size);
+  }
+#endif
+  return ~UpdateTable(~crc, data, size);
+}
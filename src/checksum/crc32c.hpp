@@ -0,0 +1,62 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: crc32c.hpp
+ * Description: Contains definitions of Crc32c class, that is used to compute CRC32C (Castagnoli)
+ * of data, with SSE4.2 crc32 instruction when processor supports it
+ * */
+#ifndef __CRC32C__
+#define __CRC32C__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstring>  // memcpy
+#include <cstddef>  // size_t
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <nmmintrin.h> // _mm_crc32_u64, _mm_crc32_u8
+#endif
+
+/**
+ * Class that computes CRC32C, either by crc32 instruction 8 bytes at once,
+ * or by slicing-by-8 lookup tables on processors without SSE4.2
+ * */
+class Crc32c {
+private:
+  /**
+   * Update CRC by lookup tables, 8 bytes at once
+   * @param[in] crc Inverted CRC of previous data
+   * @param[in] data Data to be added
+   * @param[in] size Size of data
+   * @returns Inverted CRC
+   * */
+  static uint32_t UpdateTable(uint32_t crc, const uint8_t *data, size_t size);
+
+#if defined(__GNUC__) && defined(__x86_64__)
+  /**
+   * Update CRC by SSE4.2 crc32 instruction, 8 bytes at once
+   * @param[in] crc Inverted CRC of previous data
+   * @param[in] data Data to be added
+   * @param[in] size Size of data
+   * @returns Inverted CRC
+   * */
+  static uint32_t UpdateHardware(uint32_t crc, const uint8_t *data, size_t size);
+#endif
+
+public:
+  /**
+   * Compute CRC32C of data, continuing from CRC of data before them
+   * @param[in] data Data to be checked
+   * @param[in] size Size of data
+   * @param[in] crc CRC of previous data, 0 for start of data
+   * @returns CRC of all data
+   * */
+  static uint32_t Compute(const uint8_t *data, const size_t &size, const uint32_t &crc = 0);
+
+  /**
+   * Return whether crc32 instruction is used
+   * @returns True when processor supports SSE4.2, false otherwise
+   * */
+  static bool IsHardware();
+};
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: compression_level.hpp
+ * Description: Contains definitions of compression levels, each level is set of stages,
+ * that trade speed of compression for size of result
+ * */
+#ifndef __COMPRESSION_LEVEL__
+#define __COMPRESSION_LEVEL__
+
+#include <cstdint>  // uint8_t
+
+#include "tiles/tiles.hpp"
+#include "context/context.hpp"
+
+/**
+ * Strategy of one compression level
+ * @param input_preprocessing True to calculate difference of pixels before RLE
+ * @param adaptive_sequence_scanning True to choose the better of horizontal and vertical RLE scanning
+ * @param auto_select True to choose -m, -q and -b by estimate on sample of image
+ * @param tile_size Number of pixels in each direction of one tile, 0 to not split image into tiles
+ * @param tile_predictors Number of 2D predictors tried for each tile
+ * @param tile_pipelines Number of pipelines tried for each tile with each predictor
+ * @param context_models Number of models of context coder tried for each tile with each predictor
+ * */
+typedef struct CompressionLevel {
+  bool input_preprocessing;
+  bool adaptive_sequence_scanning;
+  bool auto_select;
+  uint32_t tile_size;
+  uint8_t tile_predictors;
+  uint8_t tile_pipelines;
+  uint8_t context_models;
+} CompressionLevel;
+
+// Number of compression levels, selected by -1 to -9
+constexpr uint8_t COMPRESSION_LEVEL_COUNT = 9;
+
+// Every level runs once with static huffman code, levels 1-3 code whole image by RLE, levels 4-9 search
+// 2D predictor of each tile with RLE pipelines and, from level 5, context coder, higher levels try more
+// context models, predictors and pipelines, containers take settings of given level, with tiles replaced by --auto
+constexpr CompressionLevel COMPRESSION_LEVELS[COMPRESSION_LEVEL_COUNT] = {
+  {false, false, false, 0, 0, 0, 0},
+  {true, false, false, 0, 0, 0, 0},
+  {true, true, true, 0, 0, 0, 0},
+  {true, true, true, 256, 1, 2, 0},
+  {true, true, true, 256, 1, 2, 1},
+  {true, true, true, 256, 1, 2, 2},
+  {true, true, true, 256, TILE_PREDICTOR_COUNT, 2, 2},
+  {true, true, true, 256, TILE_PREDICTOR_COUNT, 3, 2},
+  {true, true, true, 256, TILE_PREDICTOR_COUNT, TILE_PIPELINE_COUNT, CONTEXT_MODEL_COUNT}
+};
+
+#endif
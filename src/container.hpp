@@ -0,0 +1,56 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: container.hpp
+ * Description: Contains definitions of constant data shared by all containers, that hold
+ * more than encoded data of one image
+ * */
+#ifndef __CONTAINER__
+#define __CONTAINER__
+
+#include <cstdint>  // uint8_t, uint64_t
+
+// Every container starts with 4 magic bytes, first byte has padding bits set while huffman
+// bit is clear, which never happens in settings byte of single image, and last byte is type
+constexpr uint8_t CONTAINER_MAGIC[] = {0x87, 'H', 'G'};
+
+// Number of magic bytes, including type byte
+constexpr uint8_t CONTAINER_MAGIC_SIZE = 4;
+
+// Type byte of multi-frame container
+constexpr uint8_t CONTAINER_FRAMES = 'F';
+
+// Type byte of multi-image archive
+constexpr uint8_t CONTAINER_ARCHIVE = 'A';
+
+// Type byte of image with embedded preview
+constexpr uint8_t CONTAINER_PREVIEW = 'P';
+
+// Type byte of resolution progressive image
+constexpr uint8_t CONTAINER_PROGRESSIVE = 'R';
+
+// Type byte of image split into independently coded tiles
+constexpr uint8_t CONTAINER_TILES = 'T';
+
+// Type byte of single image with versioned header
+constexpr uint8_t CONTAINER_IMAGE = 'I';
+
+// Type byte of checksum trailer, which is saved at the end of data instead of at start
+constexpr uint8_t CONTAINER_CHECKSUM = 'C';
+
+/**
+ * Check if data start with magic bytes of container of given type
+ * @param[in] data Loaded data
+ * @param[in] size Size of data
+ * @param[in] type Type byte of container
+ * @returns True when data are container of given type, false otherwise
+ * */
+inline bool IsContainer(const uint8_t *data, const uint64_t &size, const uint8_t &type) {
+  return size >= CONTAINER_MAGIC_SIZE &&
+    data[0] == CONTAINER_MAGIC[0] &&
+    data[1] == CONTAINER_MAGIC[1] &&
+    data[2] == CONTAINER_MAGIC[2] &&
+    data[3] == type;
+}
+
+#endif
@@ -0,0 +1,39 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: context.hpp
+ * Description: Contains definitions for both context coder and decoder constant data
+ * */
+#ifndef __CONTEXT__
+#define __CONTEXT__
+
+#include <cstdint>  // uint8_t, uint16_t
+
+#include "../huffman/huffman.hpp"
+
+// Constants used both in ContextCoder and ContextDecoder
+
+// Number of contexts, context of pixel is number of bits of activity of its already coded neighbours,
+// so each context has its own code
+constexpr uint8_t CONTEXT_COUNT = 8;
+
+// Code of contexts saved in first byte, static huffman code of each context with its code lengths in header,
+// or Rice code of each context with only its parameter in header, which is better for small images
+constexpr uint8_t CONTEXT_CODE_HUFFMAN = 0;
+constexpr uint8_t CONTEXT_CODE_RICE = 1;
+
+// Models of activity of neighbours, from which context is computed, left (a), upper (b), upper left (c)
+// and upper right (d) neighbour, saved in second byte
+constexpr uint8_t CONTEXT_MODEL_BALANCED = 0; // a + b + c / 2
+constexpr uint8_t CONTEXT_MODEL_LEFT = 1;     // (3a + b) / 2
+constexpr uint8_t CONTEXT_MODEL_WIDE = 2;     // a + b + (c + d) / 2
+constexpr uint8_t CONTEXT_MODEL_SUM = 3;      // a + b + c + d
+constexpr uint8_t CONTEXT_MODEL_COUNT = 4;
+
+// Largest parameter of Rice code, value is split into quotient coded in unary and remainder of given number of bits
+constexpr uint8_t CONTEXT_RICE_MAX_PARAMETER = 7;
+
+// Quotient, from which value is saved as escape of this number of 1 bits followed by whole value, so code has at most 24 bits
+constexpr uint8_t CONTEXT_RICE_LIMIT = 16;
+
+#endif
@@ -0,0 +1,294 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: context_coder.cpp
+ * Description: Contains implementations of class ContextCoder, that is used to code differences of image
+ * by static canonical huffman code or Rice code chosen by context of each pixel
+ * */
+#include "context_coder.hpp"
+
+/**
+ * Constructor that will initialize values
+ * */
+ContextCoder::ContextCoder() {
+  this->buffer = nullptr;
+  this->size = 0;
+  this->accumulator = 0;
+  this->bits = 0;
+  memset(this->lasts, 0, sizeof(this->lasts));
+  memset(this->parameters, 0, sizeof(this->parameters));
+}
+
+/**
+ * Deconstructor that will free allocated values
+ * */
+ContextCoder::~ContextCoder() {
+  if (this->buffer) {
+    free(this->buffer);
+  }
+}
+
+/**
+ * Append bits to buffer from the most significant bit, whole bytes are moved from accumulator
+ * @param[in] value Bits to be added, in lower bits
+ * @param[in] length Number of bits, at most 24
+ * */
+void ContextCoder::AppendBits(const uint32_t &value, const uint8_t &length) {
+  this->accumulator = (this->accumulator << length) | value;
+  this->bits += length;
+  while (this->bits >= BITS_IN_BYTE) {
+    this->bits -= BITS_IN_BYTE;
+    this->buffer[this->size++] = static_cast<uint8_t>(this->accumulator >> this->bits);
+  }
+}
+
+/**
+ * Return number of bits of Rice code of value
+ * @param[in] value Mapped value
+ * @param[in] parameter Number of bits of remainder
+ * @returns Number of bits
+ * */
+uint8_t ContextCoder::RiceLength(const uint8_t &value, const uint8_t &parameter) {
+  const uint8_t quotient = (value >> parameter);
+  return (quotient < CONTEXT_RICE_LIMIT) ? (quotient + 1 + parameter) : (CONTEXT_RICE_LIMIT + BITS_IN_BYTE);
+}
+
+/**
+ * Map difference to value, that is small for differences close to 0 (0, -1, 1, -2 ... to 0, 1, 2, 3 ...)
+ * @param[in] difference Difference of pixel modulo 256
+ * @returns Mapped value
+ * */
+uint8_t ContextCoder::Map(const uint8_t &difference) {
+  return (difference < 128) ? (difference << 1) : (((256 - difference) << 1) - 1);
+}
+
+/**
+ * Map value back to difference
+ * @param[in] value Mapped value
+ * @returns Difference of pixel modulo 256
+ * */
+uint8_t ContextCoder::Unmap(const uint8_t &value) {
+  return (value & 1) ? static_cast<uint8_t>(256 - ((value + 1) >> 1)) : (value >> 1);
+}
+
+/**
+ * Return context of pixel from mapped values of its already coded neighbours
+ * @param[in] values Mapped values of image, already coded ones are read
+ * @param[in] x Column of pixel
+ * @param[in] y Row of pixel
+ * @param[in] width Width of image
+ * @param[in] model Model of activity of neighbours
+ * @returns Context from 0 to CONTEXT_COUNT - 1
+ * */
+uint8_t ContextCoder::GetContext(
+  const uint8_t *values,
+  const uint32_t &x,
+  const uint32_t &y,
+  const uint32_t &width,
+  const uint8_t &model
+) {
+  const size_t i = static_cast<size_t>(y) * width + x;
+  const uint32_t left = (x > 0) ? values[i - 1] : 0;
+  const uint32_t up = (y > 0) ? values[i - width] : 0;
+  const uint32_t up_left = (x > 0 && y > 0) ? values[i - width - 1] : 0;
+  const uint32_t up_right = (y > 0 && (x + 1) < width) ? values[i - width + 1] : 0;
+
+  uint32_t activity = 0;
+  switch (model) {
+    case CONTEXT_MODEL_BALANCED:
+      activity = (2 * (left + up) + up_left) >> 1;
+      break;
+    case CONTEXT_MODEL_LEFT:
+      activity = (3 * left + up) >> 1;
+      break;
+    case CONTEXT_MODEL_WIDE:
+      activity = (2 * (left + up) + up_left + up_right) >> 1;
+      break;
+    case CONTEXT_MODEL_SUM:
+      activity = left + up + up_left + up_right;
+      break;
+  }
+
+  // Number of bits of activity
+  uint8_t context = 0;
+  while (activity > 0 && context < (CONTEXT_COUNT - 1)) {
+    activity >>= 1;
+    context++;
+  }
+  return context;
+}
+
+/**
+ * Build huffman code and find the best Rice parameter of each used context
+ * @param[in] counts Number of occurences of each value in each context
+ * @param[out] code CONTEXT_CODE_HUFFMAN or CONTEXT_CODE_RICE, whichever gives smaller result
+ * @returns Size of result with given code, including header
+ * */
+uint64_t ContextCoder::BuildCodes(const std::vector<uint64_t> &counts, uint8_t &code) {
+  this->lengths.assign(CONTEXT_COUNT * N_VALUES, 0);
+  this->codes.assign(CONTEXT_COUNT * N_VALUES, 0);
+  memset(this->parameters, 0, sizeof(this->parameters));
+
+  // Header of huffman code has mask of used contexts, last value and code lengths of each used context
+  uint64_t huffman_size = 3;
+  uint64_t huffman_bits = 0;
+  uint64_t rice_bits = 0;
+  for (uint8_t context = 0; context < CONTEXT_COUNT; context++) {
+    const uint64_t *context_counts = &counts[context * N_VALUES];
+    this->lasts[context] = N_VALUES;
+    for (uint16_t i = 0; i < N_VALUES; i++) {
+      if (context_counts[i] > 0) {
+        this->lasts[context] = i;
+      }
+    }
+    if (this->lasts[context] == N_VALUES) {
+      continue;
+    }
+
+    StaticHuffmanCoder::BuildCode(context_counts, &this->lengths[context * N_VALUES], &this->codes[context * N_VALUES]);
+    huffman_size += 1 + this->lasts[context] / 2 + 1;
+    for (uint16_t i = 0; i <= this->lasts[context]; i++) {
+      huffman_bits += context_counts[i] * this->lengths[context * N_VALUES + i];
+    }
+
+    uint64_t best_bits = UINT64_MAX;
+    for (uint8_t parameter = 0; parameter <= CONTEXT_RICE_MAX_PARAMETER; parameter++) {
+      uint64_t parameter_bits = 0;
+      for (uint16_t i = 0; i <= this->lasts[context]; i++) {
+        parameter_bits += context_counts[i] * ContextCoder::RiceLength(i, parameter);
+      }
+      if (parameter_bits < best_bits) {
+        best_bits = parameter_bits;
+        this->parameters[context] = parameter;
+      }
+    }
+    rice_bits += best_bits;
+  }
+
+  // Header of Rice code has only parameter of each context
+  huffman_size += (huffman_bits + 7) / 8;
+  const uint64_t rice_size = 2 + CONTEXT_COUNT + (rice_bits + 7) / 8;
+  code = (rice_size < huffman_size) ? CONTEXT_CODE_RICE : CONTEXT_CODE_HUFFMAN;
+  return std::min(rice_size, huffman_size);
+}
+
+/**
+ * Code differences of image, header with codes of used contexts is followed by codes of pixels, model,
+ * static huffman code or Rice code of contexts are chosen by size of result, which is known from counts of values
+ * @param[in] differences Differences of pixels, row after row
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * @param[in] models Number of models tried, from 1 to CONTEXT_MODEL_COUNT
+ * */
+void ContextCoder::Encode(const uint8_t *differences, const uint32_t &width, const uint32_t &height, const uint8_t &models) {
+  const size_t pixels = static_cast<size_t>(width) * height;
+  std::vector<uint8_t> values(pixels);
+  for (size_t i = 0; i < pixels; i++) {
+    values[i] = ContextCoder::Map(differences[i]);
+  }
+
+  // Count values in each context of each model, and keep model with the smallest result
+  std::vector<uint8_t> contexts(pixels);
+  std::vector<uint8_t> best_contexts;
+  std::vector<uint64_t> counts;
+  std::vector<uint64_t> best_counts;
+  uint64_t best_size = UINT64_MAX;
+  uint8_t model = CONTEXT_MODEL_BALANCED;
+  uint8_t code = CONTEXT_CODE_HUFFMAN;
+  for (uint8_t i = 0; i < std::min(std::max<uint8_t>(models, 1), CONTEXT_MODEL_COUNT); i++) {
+    counts.assign(CONTEXT_COUNT * N_VALUES, 0);
+    for (uint32_t y = 0; y < height; y++) {
+      for (uint32_t x = 0; x < width; x++) {
+        const size_t j = static_cast<size_t>(y) * width + x;
+        contexts[j] = ContextCoder::GetContext(values.data(), x, y, width, i);
+        counts[contexts[j] * N_VALUES + values[j]]++;
+      }
+    }
+
+    uint8_t model_code;
+    const uint64_t size = this->BuildCodes(counts, model_code);
+    if (size < best_size) {
+      best_size = size;
+      model = i;
+      code = model_code;
+      best_contexts.swap(contexts);
+      best_counts.swap(counts);
+      contexts.resize(pixels);
+    }
+  }
+
+  // Codes of the best model, when other model was tried after it
+  if (model != (std::min(std::max<uint8_t>(models, 1), CONTEXT_MODEL_COUNT) - 1)) {
+    this->BuildCodes(best_counts, code);
+  }
+
+  // Size of result is known before coding
+  if (this->buffer) {
+    free(this->buffer);
+  }
+  this->buffer = (uint8_t *)malloc(sizeof(uint8_t) * (best_size + 1));
+  assert(this->buffer != nullptr);
+  this->size = 0;
+  this->accumulator = 0;
+  this->bits = 0;
+
+  // Code and model, followed by Rice parameter of each context, or mask of used contexts with last value
+  // and code lengths up to it of each used context
+  this->buffer[this->size++] = code;
+  this->buffer[this->size++] = model;
+  if (code == CONTEXT_CODE_RICE) {
+    memcpy(&this->buffer[this->size], this->parameters, CONTEXT_COUNT);
+    this->size += CONTEXT_COUNT;
+  } else {
+    uint8_t &mask = this->buffer[this->size++];
+    mask = 0;
+    for (uint8_t context = 0; context < CONTEXT_COUNT; context++) {
+      if (this->lasts[context] == N_VALUES) {
+        continue;
+      }
+      const uint8_t *context_lengths = &this->lengths[context * N_VALUES];
+      mask |= (1 << context);
+      this->buffer[this->size++] = this->lasts[context];
+      for (uint16_t i = 0; i <= this->lasts[context]; i += 2) {
+        this->buffer[this->size++] = (context_lengths[i] << 4) | ((i + 1 <= this->lasts[context]) ? context_lengths[i + 1] : 0);
+      }
+    }
+  }
+
+  // Rice code is quotient in unary ended by 0 bit followed by remainder, or escape followed by whole value
+  for (size_t i = 0; i < pixels; i++) {
+    if (code == CONTEXT_CODE_HUFFMAN) {
+      const size_t index = best_contexts[i] * N_VALUES + values[i];
+      this->AppendBits(this->codes[index], this->lengths[index]);
+      continue;
+    }
+
+    const uint8_t parameter = this->parameters[best_contexts[i]];
+    const uint8_t quotient = (values[i] >> parameter);
+    if (quotient < CONTEXT_RICE_LIMIT) {
+      this->AppendBits(((1U << quotient) - 1) << 1, quotient + 1);
+      this->AppendBits(values[i] & ((1U << parameter) - 1), parameter);
+    } else {
+      this->AppendBits((((1U << CONTEXT_RICE_LIMIT) - 1) << BITS_IN_BYTE) | values[i], CONTEXT_RICE_LIMIT + BITS_IN_BYTE);
+    }
+  }
+  if (this->bits > 0) {
+    this->buffer[this->size++] = static_cast<uint8_t>(this->accumulator << (BITS_IN_BYTE - this->bits));
+  }
+}
+
+/**
+ * Return pointer to encoded data buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & ContextCoder::GetBuffer() {
+  return this->buffer;
+}
+
+/**
+ * Return size of encoded data
+ * @returns Size of buffer
+ * */
+uint64_t ContextCoder::GetSize() {
+  return this->size;
+}
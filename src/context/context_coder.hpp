@@ -0,0 +1,120 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: context_coder.hpp
+ * Description: Contains definitions of class ContextCoder, that is used to code differences of image
+ * by static canonical huffman code or Rice code chosen by context of each pixel
+ * */
+#ifndef __CONTEXT_CODER__
+#define __CONTEXT_CODER__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <vector>   // vector
+
+#include "context.hpp"
+#include "../huffman/static_huffman_coder.hpp"
+
+/**
+ * Class that will code differences of image, each difference is mapped to small value, when it is
+ * close to 0, and coded by code of its context, so differences in smooth areas get shorter codes
+ * than in textured ones
+ * */
+class ContextCoder {
+private:
+  // Encoded data with header
+  uint8_t *buffer;
+  uint64_t size;
+
+  // Bits, that were not written into buffer yet
+  uint64_t accumulator;
+  uint8_t bits;
+
+  // Huffman code lengths and codes, the last coded value and Rice parameter of each context
+  std::vector<uint8_t> lengths;
+  std::vector<uint16_t> codes;
+  uint16_t lasts[CONTEXT_COUNT];
+  uint8_t parameters[CONTEXT_COUNT];
+
+  /**
+   * Build huffman code and find the best Rice parameter of each used context
+   * @param[in] counts Number of occurences of each value in each context
+   * @param[out] code CONTEXT_CODE_HUFFMAN or CONTEXT_CODE_RICE, whichever gives smaller result
+   * @returns Size of result with given code, including header
+   * */
+  uint64_t BuildCodes(const std::vector<uint64_t> &counts, uint8_t &code);
+
+  /**
+   * Append bits to buffer from the most significant bit, whole bytes are moved from accumulator
+   * @param[in] value Bits to be added, in lower bits
+   * @param[in] length Number of bits, at most 24
+   * */
+  void AppendBits(const uint32_t &value, const uint8_t &length);
+
+  /**
+   * Return number of bits of Rice code of value
+   * @param[in] value Mapped value
+   * @param[in] parameter Number of bits of remainder
+   * @returns Number of bits
+   * */
+  static uint8_t RiceLength(const uint8_t &value, const uint8_t &parameter);
+
+public:
+  /**
+   * Constructor that will initialize values
+   * */
+  ContextCoder();
+
+  /**
+   * Deconstructor that will free allocated values
+   * */
+  ~ContextCoder();
+
+  /**
+   * Map difference to value, that is small for differences close to 0 (0, -1, 1, -2 ... to 0, 1, 2, 3 ...)
+   * @param[in] difference Difference of pixel modulo 256
+   * @returns Mapped value
+   * */
+  static uint8_t Map(const uint8_t &difference);
+
+  /**
+   * Map value back to difference
+   * @param[in] value Mapped value
+   * @returns Difference of pixel modulo 256
+   * */
+  static uint8_t Unmap(const uint8_t &value);
+
+  /**
+   * Return context of pixel from mapped values of its already coded neighbours
+   * @param[in] values Mapped values of image, already coded ones are read
+   * @param[in] x Column of pixel
+   * @param[in] y Row of pixel
+   * @param[in] width Width of image
+   * @param[in] model Model of activity of neighbours
+   * @returns Context from 0 to CONTEXT_COUNT - 1
+   * */
+  static uint8_t GetContext(const uint8_t *values, const uint32_t &x, const uint32_t &y, const uint32_t &width, const uint8_t &model);
+
+  /**
+   * Code differences of image, header with codes of used contexts is followed by codes of pixels, model,
+   * static huffman code or Rice code of contexts are chosen by size of result, which is known from counts of values
+   * @param[in] differences Differences of pixels, row after row
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * @param[in] models Number of models tried, from 1 to CONTEXT_MODEL_COUNT
+   * */
+  void Encode(const uint8_t *differences, const uint32_t &width, const uint32_t &height, const uint8_t &models = 1);
+
+  /**
+   * Return pointer to encoded data buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return size of encoded data
+   * @returns Size of buffer
+   * */
+  uint64_t GetSize();
+};
+
+#endif
@@ -0,0 +1,213 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: context_decoder.cpp
+ * Description: Contains implementations of class ContextDecoder, that is used to decode differences of image
+ * coded by static canonical huffman code or Rice code chosen by context of each pixel
+ * */
+#include "context_decoder.hpp"
+
+/**
+ * Constructor that will initialize values
+ * */
+ContextDecoder::ContextDecoder() {
+  this->buffer = nullptr;
+  this->size = 0;
+  this->model = CONTEXT_MODEL_BALANCED;
+  this->code = CONTEXT_CODE_HUFFMAN;
+  memset(this->parameters, 0, sizeof(this->parameters));
+  this->encoded = nullptr;
+  this->encoded_size = 0;
+  this->read_index = 0;
+  this->accumulator = 0;
+  this->bits = 0;
+}
+
+/**
+ * Deconstructor that will free allocated values
+ * */
+ContextDecoder::~ContextDecoder() {
+  if (this->buffer) {
+    free(this->buffer);
+  }
+}
+
+/**
+ * Read header with model and code of contexts
+ * @param[in] data Header followed by codes of pixels
+ * @param[in] size Size of data
+ * @returns Size of header, 0 when header is not valid
+ * */
+uint64_t ContextDecoder::ReadHeader(const uint8_t *data, const uint64_t &size) {
+  if (size < 2 || data[0] > CONTEXT_CODE_RICE || data[1] >= CONTEXT_MODEL_COUNT) {
+    return 0;
+  }
+  this->code = data[0];
+  this->model = data[1];
+  uint64_t position = 2;
+
+  // Rice parameter of each context
+  if (this->code == CONTEXT_CODE_RICE) {
+    if ((size - position) < CONTEXT_COUNT) {
+      return 0;
+    }
+    for (uint8_t context = 0; context < CONTEXT_COUNT; context++) {
+      this->parameters[context] = data[position++];
+      if (this->parameters[context] > CONTEXT_RICE_MAX_PARAMETER) {
+        return 0;
+      }
+    }
+    return position;
+  }
+
+  // Code lengths of used contexts, tables of unused contexts stay empty
+  if (position >= size) {
+    return 0;
+  }
+  this->tables.assign(static_cast<size_t>(CONTEXT_COUNT) << STATIC_HUFFMAN_MAX_LENGTH, 0);
+  const uint8_t mask = data[position++];
+  for (uint8_t context = 0; context < CONTEXT_COUNT; context++) {
+    if ((mask & (1 << context)) == 0) {
+      continue;
+    }
+
+    if (position >= size) {
+      return 0;
+    }
+    const uint16_t last = data[position++];
+    if ((size - position) < static_cast<uint64_t>(last / 2 + 1)) {
+      return 0;
+    }
+
+    uint8_t lengths[N_VALUES] = {0};
+    for (uint16_t i = 0; i <= last; i += 2) {
+      lengths[i] = (data[position] >> 4);
+      if (i + 1 <= last) {
+        lengths[i + 1] = (data[position] & 0x0F);
+      }
+      position++;
+    }
+    if (!StaticHuffmanDecoder::BuildTable(lengths, &this->tables[static_cast<size_t>(context) << STATIC_HUFFMAN_MAX_LENGTH])) {
+      return 0;
+    }
+  }
+  return position;
+}
+
+/**
+ * Return next bits without reading them, at the end of data missing bits are read as zeros
+ * @param[in] length Number of bits, at most 24
+ * @returns Bits in lower bits of value
+ * */
+uint32_t ContextDecoder::PeekBits(const uint8_t &length) {
+  while (this->bits <= 56 && this->read_index < this->encoded_size) {
+    this->accumulator = (this->accumulator << BITS_IN_BYTE) | this->encoded[this->read_index++];
+    this->bits += BITS_IN_BYTE;
+  }
+  const uint64_t mask = (1ULL << length) - 1;
+  return (this->bits >= length)
+    ? ((this->accumulator >> (this->bits - length)) & mask)
+    : ((this->accumulator << (length - this->bits)) & mask);
+}
+
+/**
+ * Decode value of pixel in given context
+ * @param[in] context Context of pixel
+ * @param[out] value Mapped value
+ * @returns True when code is valid and whole in data, false otherwise
+ * */
+bool ContextDecoder::DecodeValue(const uint8_t &context, uint8_t &value) {
+  if (this->code == CONTEXT_CODE_HUFFMAN) {
+    const uint16_t entry = this->tables[(static_cast<size_t>(context) << STATIC_HUFFMAN_MAX_LENGTH) + this->PeekBits(STATIC_HUFFMAN_MAX_LENGTH)];
+    const uint8_t length = (entry & 0x0F);
+    if (length == 0 || length > this->bits) {
+      return false;
+    }
+    value = static_cast<uint8_t>(entry >> 4);
+    this->bits -= length;
+    return true;
+  }
+
+  // Quotient is number of 1 bits before 0 bit, escape of CONTEXT_RICE_LIMIT 1 bits is followed by whole value
+  const uint8_t parameter = this->parameters[context];
+  const uint32_t prefix = this->PeekBits(CONTEXT_RICE_LIMIT);
+  uint8_t quotient = 0;
+  while (quotient < CONTEXT_RICE_LIMIT && (prefix & (1U << (CONTEXT_RICE_LIMIT - 1 - quotient)))) {
+    quotient++;
+  }
+  const uint8_t length = (quotient < CONTEXT_RICE_LIMIT) ? (quotient + 1 + parameter) : (CONTEXT_RICE_LIMIT + BITS_IN_BYTE);
+  if (length > this->bits) {
+    return false;
+  }
+  const uint32_t rest = this->PeekBits(length);
+  value = (quotient < CONTEXT_RICE_LIMIT)
+    ? static_cast<uint8_t>((quotient << parameter) | (rest & ((1U << parameter) - 1)))
+    : static_cast<uint8_t>(rest & 0xFF);
+  this->bits -= length;
+  return true;
+}
+
+/**
+ * Decode differences of image
+ * @param[in] data Header with codes of used contexts followed by codes of pixels
+ * @param[in] size Size of data
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * @returns True when data were decoded, false otherwise
+ * */
+bool ContextDecoder::Decode(const uint8_t *data, const uint64_t &size, const uint32_t &width, const uint32_t &height) {
+  const uint64_t header_size = this->ReadHeader(data, size);
+  if (header_size == 0) {
+    std::cerr << "Invalid header of context code" << std::endl;
+    return false;
+  }
+
+  // Every pixel has at least one bit
+  const uint64_t pixels = static_cast<uint64_t>(width) * height;
+  this->encoded = &data[header_size];
+  this->encoded_size = size - header_size;
+  this->read_index = 0;
+  this->accumulator = 0;
+  this->bits = 0;
+  if (pixels > this->encoded_size * BITS_IN_BYTE) {
+    std::cerr << "Number of pixels does not match size of context code" << std::endl;
+    return false;
+  }
+
+  if (this->buffer) {
+    free(this->buffer);
+  }
+  this->buffer = (uint8_t *)malloc(sizeof(uint8_t) * (pixels + 1));
+  assert(this->buffer != nullptr);
+  this->size = 0;
+
+  // Context is computed from mapped values of already decoded pixels
+  std::vector<uint8_t> values(pixels);
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      if (!this->DecodeValue(ContextCoder::GetContext(values.data(), x, y, width, this->model), values[this->size])) {
+        std::cerr << "Invalid code in context code" << std::endl;
+        return false;
+      }
+      this->buffer[this->size] = ContextCoder::Unmap(values[this->size]);
+      this->size++;
+    }
+  }
+  return true;
+}
+
+/**
+ * Return pointer to decoded differences
+ * @returns Pointer to buffer
+ * */
+uint8_t * & ContextDecoder::GetBuffer() {
+  return this->buffer;
+}
+
+/**
+ * Return size of decoded differences
+ * @returns Size of buffer
+ * */
+uint64_t ContextDecoder::GetSize() {
+  return this->size;
+}
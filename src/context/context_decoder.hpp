@@ -0,0 +1,99 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: context_decoder.hpp
+ * Description: Contains definitions of class ContextDecoder, that is used to decode differences of image
+ * coded by static canonical huffman code or Rice code chosen by context of each pixel
+ * */
+#ifndef __CONTEXT_DECODER__
+#define __CONTEXT_DECODER__
+
+#include <cstdint>  // uint8_t, uint16_t, uint32_t, uint64_t
+#include <vector>   // vector
+
+#include "context.hpp"
+#include "context_coder.hpp"
+#include "../huffman/static_huffman_decoder.hpp"
+
+/**
+ * Class that will decode differences of image coded by ContextCoder, context of each pixel is
+ * computed from already decoded pixels the same way as by coder
+ * */
+class ContextDecoder {
+private:
+  // Decoded differences
+  uint8_t *buffer;
+  uint64_t size;
+
+  // Model of activity of neighbours, code of contexts, lookup table of each context with value and code length for each possible next
+  // STATIC_HUFFMAN_MAX_LENGTH bits, or Rice parameter of each context
+  uint8_t model;
+  uint8_t code;
+  std::vector<uint16_t> tables;
+  uint8_t parameters[CONTEXT_COUNT];
+
+  // Encoded pixels, position of next byte and bits, that were read from data and not decoded yet
+  const uint8_t *encoded;
+  uint64_t encoded_size;
+  uint64_t read_index;
+  uint64_t accumulator;
+  uint8_t bits;
+
+  /**
+   * Read header with model and code of contexts
+   * @param[in] data Header followed by codes of pixels
+   * @param[in] size Size of data
+   * @returns Size of header, 0 when header is not valid
+   * */
+  uint64_t ReadHeader(const uint8_t *data, const uint64_t &size);
+
+  /**
+   * Return next bits without reading them, at the end of data missing bits are read as zeros
+   * @param[in] length Number of bits, at most 24
+   * @returns Bits in lower bits of value
+   * */
+  uint32_t PeekBits(const uint8_t &length);
+
+  /**
+   * Decode value of pixel in given context
+   * @param[in] context Context of pixel
+   * @param[out] value Mapped value
+   * @returns True when code is valid and whole in data, false otherwise
+   * */
+  bool DecodeValue(const uint8_t &context, uint8_t &value);
+
+public:
+  /**
+   * Constructor that will initialize values
+   * */
+  ContextDecoder();
+
+  /**
+   * Deconstructor that will free allocated values
+   * */
+  ~ContextDecoder();
+
+  /**
+   * Decode differences of image
+   * @param[in] data Header with codes of used contexts followed by codes of pixels
+   * @param[in] size Size of data
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * @returns True when data were decoded, false otherwise
+   * */
+  bool Decode(const uint8_t *data, const uint64_t &size, const uint32_t &width, const uint32_t &height);
+
+  /**
+   * Return pointer to decoded differences
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return size of decoded differences
+   * @returns Size of buffer
+   * */
+  uint64_t GetSize();
+};
+
+#endif
@@ -29,23 +29,45 @@ DataWorker::~DataWorker() {
 ******************************************************************************/
 
 /**
- * Calculate difference of pixels than save them to class buffer
+ * Calculate difference of pixels and save them back to buffer, when maximum error is given
+ * differences are quantized, so each reconstructed pixel differs at most by maximum error
+ * @param[out] buffer Containing image, from which we will calculate differences and store them back here
+ * @param[in] size Size of buffer
+ * @param[in] max_error Maximum error of each pixel, 0 for lossless
  * */
-void DataWorker::Preprocess() {
+void DataWorker::Preprocess(uint8_t * &buffer, const size_t &size, const uint8_t &max_error) {
+  // Quantize differences against already reconstructed pixels, so errors do not accumulate
+  if (max_error > 0) {
+    const int32_t step = (2 * max_error + 1);
+    int32_t prediction = 0;
+
+    for (size_t i = 0; i < size; i++) {
+      const int32_t error = buffer[i] - prediction;
+
+      // Round difference to the nearest multiple of step
+      const int32_t quantized = (error >= 0) ? ((error + max_error) / step) : -((max_error - error) / step);
+      buffer[i] = static_cast<uint8_t>(quantized);
+
+      // Reconstruct pixel the same way as decoder will
+      prediction = std::min(std::max(prediction + quantized * step, 0), 0xFF);
+    }
+    return;
+  }
+
   // Allocate temporaly buffer for difference of pixels
-  uint8_t *diff_pixels = (uint8_t *)malloc(sizeof(uint8_t) * this->buff_size);
+  uint8_t *diff_pixels = (uint8_t *)malloc(sizeof(uint8_t) * size);
 
   // Copy first value
-  diff_pixels[0] = this->buffer[0];
+  diff_pixels[0] = buffer[0];
 
-  for (size_t i = 1; i < this->buff_size; i++) {
+  for (size_t i = 1; i < size; i++) {
     // When first value is higher than second, calculate overflow
-    diff_pixels[i] = (this->buffer[i] - this->buffer[(i - 1)]);
+    diff_pixels[i] = (buffer[i] - buffer[(i - 1)]);
   }
 
   // When buffer was allocated, copy values to buffer
-  if (this->buffer) {
-    memcpy(this->buffer, diff_pixels, this->buff_size);
+  if (buffer) {
+    memcpy(buffer, diff_pixels, size);
   }
 
   // Free temporal buffer
@@ -56,8 +78,21 @@ void DataWorker::Preprocess() {
  * Calculate original image back from pixels differencial
  * @param[out] buffer Containing data, from which we will calculate result and store him back here
  * @param[in] size Size of buffer
+ * @param[in] max_error Maximum error used in Preprocess, 0 for lossless
  * */
-void DataWorker::Depreprocess(uint8_t * &buffer, const size_t &size) {
+void DataWorker::Depreprocess(uint8_t * &buffer, const size_t &size, const uint8_t &max_error) {
+  // Dequantize differences, reconstructed pixels are kept in range of 8 bits
+  if (max_error > 0) {
+    const int32_t step = (2 * max_error + 1);
+    int32_t prediction = 0;
+
+    for (size_t i = 0; i < size; i++) {
+      prediction = std::min(std::max(prediction + static_cast<int8_t>(buffer[i]) * step, 0), 0xFF);
+      buffer[i] = static_cast<uint8_t>(prediction);
+    }
+    return;
+  }
+
   // Allocate temporal buffer for original image
   uint8_t *orig_image = (uint8_t *)malloc(sizeof(uint8_t) * size);
 
@@ -84,6 +119,7 @@ void DataWorker::Depreprocess(uint8_t * &buffer, const size_t &size) {
  * @returns True when we succesfully loaded file into buffer, false otherwise
  * */
 bool DataWorker::LoadRawImage(std::string &filename, const uint32_t &width, uint32_t &height) {
+  TraceSpan span("load raw image", "io");
   // File pointer
   FILE *file;
   uint64_t result;
@@ -120,6 +156,7 @@ bool DataWorker::LoadRawImage(std::string &filename, const uint32_t &width, uint
 
   // Copy file into buffer
   result = fread(this->buffer, BYTE_SIZE, this->buff_size, file);
+  span.AddArg("bytes", result);
 
   // Check if given file is not smaller than id needs to be
   if (result != this->buff_size) {
@@ -135,9 +172,11 @@ bool DataWorker::LoadRawImage(std::string &filename, const uint32_t &width, uint
 /**
  * Load encoded data from given file
  * @param[in] filename Name of file to be loaded
+ * @param[in] max_size Maximum number of bytes loaded from start of file
  * @returns True when we successfully loaded file into buffer, false otherwise
  * */
-bool DataWorker::LoadEncodedData(std::string &filename) {
+bool DataWorker::LoadEncodedData(std::string &filename, const uint64_t &max_size) {
+  TraceSpan span("load encoded data", "io");
   // Pointer to open file
   FILE *file;
   uint64_t result;
@@ -157,8 +196,8 @@ bool DataWorker::LoadEncodedData(std::string &filename) {
     return false;
   }
 
-  // Get file position, in bytes
-  this->buff_size = ftell(file);
+  // Get file position, in bytes, only start of file when it is bigger than maximum size
+  this->buff_size = std::min<uint64_t>(ftell(file), max_size);
 
   // Move pointer to the start of file
   if (fseek(file, 0, SEEK_SET)) {
@@ -166,11 +205,17 @@ bool DataWorker::LoadEncodedData(std::string &filename) {
     return false;
   }
 
+  // Free previously loaded data
+  if (this->buffer != nullptr) {
+    free(this->buffer);
+  }
+
   // Allocate memory
   this->buffer = (uint8_t *)malloc(sizeof(uint8_t) * this->buff_size);
 
   // Copy file into buffer
   result = fread(this->buffer, BYTE_SIZE, this->buff_size, file);
+  span.AddArg("bytes", result);
 
   // Check if given file is not smaller than it needs to be
   if (result != this->buff_size) {
@@ -188,18 +233,13 @@ bool DataWorker::LoadEncodedData(std::string &filename) {
  * @param[in] filename Name of file the data will be written to
  * @param[in] buffer Buffer that will be written into file
  * @param[in] size Number of bytes to be written into file
- * @param[in] decompress_model When true, call Depreprocess on buffer, before writting data to file
  * */
 bool DataWorker::WriteRawImage(
   std::string &filename,
   uint8_t * &buffer,
-  const size_t &size,
-  const bool &decompress_model
+  const size_t &size
 ) {
-  // Calculate back original image from pixel differencial
-  if (decompress_model) {
-    this->Depreprocess(buffer, size);
-  }
+  TraceSpan span("write raw image", "io", {{"bytes", size}});
 
   // Open file for binary writting
   FILE *file = fopen(filename.c_str(), "wb");
@@ -226,20 +266,84 @@ bool DataWorker::WriteRawImage(
   return true;
 }
 
+/**
+ * Compare image with RAW image from file, file is read in blocks so it is never loaded whole
+ * @param[in] filename Name of file with RAW image
+ * @param[in] buffer Image to be compared
+ * @param[in] size Size of image
+ * @param[in] max_error Maximum difference of each pixel, 0 for the same image
+ * @param[out] mismatch Position of first byte that differs, or size of shorter of them
+ * @returns True when file holds the same image, false otherwise
+ * */
+bool DataWorker::CompareRawImage(
+  const std::string &filename,
+  const uint8_t *buffer,
+  const uint64_t &size,
+  const uint8_t &max_error,
+  uint64_t &mismatch
+) {
+  TraceSpan span("compare raw image", "io", {{"bytes", size}});
+
+  // Open file for binary reading
+  std::FILE *file = fopen(filename.c_str(), "rb");
+  mismatch = 0;
+
+  // File is not open
+  if (file == nullptr) {
+    std::cerr << "Failed to open file " << filename << std::endl;
+    return false;
+  }
+
+  // Compare block after block, until image or file ends
+  std::vector<uint8_t> block(COMPARE_BLOCK_SIZE);
+  while (true) {
+    const size_t read = std::fread(block.data(), sizeof(uint8_t), block.size(), file);
+    const size_t compared = std::min<uint64_t>(read, size - mismatch);
+
+    // Find first byte of block, that differs by more than maximum error
+    if (memcmp(block.data(), &buffer[mismatch], compared) != 0) {
+      for (size_t i = 0; i < compared; i++) {
+        if (std::abs(block[i] - buffer[mismatch + i]) > max_error) {
+          mismatch += i;
+          std::fclose(file);
+          return false;
+        }
+      }
+    }
+    mismatch += compared;
+
+    // File is longer than image, or image is longer than file
+    if (compared < read || (read < block.size() && mismatch < size)) {
+      std::fclose(file);
+      return false;
+    }
+
+    // Both ended at the same byte
+    if (read < block.size()) {
+      break;
+    }
+  }
+
+  std::fclose(file);
+  return true;
+}
+
 /**
  * Write encoded data into specified file
  * @param[in] filename Name of file the data will be written to
- * @param[in] settings Byte containing metadata to be written as first byte before buffer
- * @param[in] buffer Buffer that will be written after settings byte into file
+ * @param[in] buffer Buffer with header and encoded data that will be written into file
  * @param[in] size Number of bytes to be written into file
+ * @param[in] trailer Bytes written right after buffer
  * @returns True when successfuly written into file
  * */
 bool DataWorker::WriteEncodedData(
   std::string &filename,
-  const uint8_t &settings,
   uint8_t * &buffer,
-  const uint64_t &size
+  const uint64_t &size,
+  const std::vector<uint8_t> &trailer
 ) {
+  TraceSpan span("write encoded data", "io", {{"bytes", size + trailer.size()}});
+
   // Open file for binary writting
   std::FILE *file = fopen(filename.c_str(), "wb");
   uint64_t result;
@@ -249,15 +353,16 @@ bool DataWorker::WriteEncodedData(
     return false;
   }
 
-  // Write settings
-  std::fwrite(&settings, sizeof(uint8_t), 1, file);
-
-  // After settings write data
+  // Write header and data, followed by trailer
   result = std::fwrite(buffer, sizeof(uint8_t), size, file);
+  if (!trailer.empty()) {
+    result += std::fwrite(trailer.data(), sizeof(uint8_t), trailer.size(), file);
+  }
   
   // Failed to write all data to file
-  if (result != size)
+  if (result != (size + trailer.size()))
   {
+    std::fclose(file);
     return false;
   }
   // Close file
@@ -265,6 +370,14 @@ bool DataWorker::WriteEncodedData(
   return true;
 }
 
+/**
+ * Drop end of loaded data, so only given number of bytes from start is used
+ * @param[in] size New size of data, when bigger than current size, nothing happens
+ * */
+void DataWorker::Truncate(const uint64_t &size) {
+  this->buff_size = std::min(this->buff_size, size);
+}
+
 /**
  * Return pointer to class buffer
  * @returns Pointer to buffer
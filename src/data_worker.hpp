@@ -12,9 +12,23 @@
 #include <string.h>
 #include <iostream>
 #include <cstdint>
+#include <vector>
+#include <algorithm> // min, max
+#include <cstdlib>   // abs
+
+#include "stats/trace_recorder.hpp"
 
 constexpr int BYTE_SIZE = 1;
 
+// Number of bytes of RAW image read at once, when image is compared with file
+constexpr size_t COMPARE_BLOCK_SIZE = 1 << 20;
+
+// Bit in settings byte, representing that residuals were quantized, followed by byte with maximum error
+constexpr uint8_t NEAR_LOSSLESS_SETTINGS_BIT = 0x40;
+
+// Highest allowed maximum error of pixel
+constexpr uint8_t NEAR_LOSSLESS_MAX_ERROR = 0xFF;
+
 /**
  * Class will load data from file or write data to file
  * */
@@ -37,16 +51,21 @@ public:
   virtual ~DataWorker ();
 
   /**
-   * Calculate difference of pixels than save them to class buffer
+   * Calculate difference of pixels and save them back to buffer, when maximum error is given
+   * differences are quantized, so each reconstructed pixel differs at most by maximum error
+   * @param[out] buffer Containing image, from which we will calculate differences and store them back here
+   * @param[in] size Size of buffer
+   * @param[in] max_error Maximum error of each pixel, 0 for lossless
    * */
-  void Preprocess();
+  static void Preprocess(uint8_t * &buffer, const size_t &size, const uint8_t &max_error);
 
   /**
    * Calculate original image back from pixels differencial
    * @param[out] buffer Containing data, from which we will calculate result and store him back here
    * @param[in] size Size of buffer
+   * @param[in] max_error Maximum error used in Preprocess, 0 for lossless
    * */
-  void Depreprocess(uint8_t * &buffer, const size_t &size);
+  static void Depreprocess(uint8_t * &buffer, const size_t &size, const uint8_t &max_error);
 
   /**
    * Load raw image into buffer and calculate height from width and file size
@@ -60,39 +79,61 @@ public:
   /**
    * Load encoded data from given file
    * @param[in] filename Name of file to be loaded
+   * @param[in] max_size Maximum number of bytes loaded from start of file
    * @returns True when we successfully loaded file into buffer, false otherwise
    * */
-  bool LoadEncodedData(std::string &filename);
+  bool LoadEncodedData(std::string &filename, const uint64_t &max_size = UINT64_MAX);
 
   /**
    * Write RAW image data into specified file
    * @param[in] filename Name of file the data will be written to
    * @param[in] buffer Buffer that will be written into file
    * @param[in] size Number of bytes to be written into file
-   * @param[in] decompress_model When true, call Depreprocess on buffer, before writting data to file
    * */
   bool WriteRawImage(
     std::string &filename,
     uint8_t * &buffer,
-    const size_t &size,
-    const bool &decompress_model
+    const size_t &size
+  );
+
+  /**
+   * Compare image with RAW image from file, file is read in blocks so it is never loaded whole
+   * @param[in] filename Name of file with RAW image
+   * @param[in] buffer Image to be compared
+   * @param[in] size Size of image
+   * @param[in] max_error Maximum difference of each pixel, 0 for the same image
+   * @param[out] mismatch Position of first byte that differs, or size of shorter of them
+   * @returns True when file holds the same image, false otherwise
+   * */
+  static bool CompareRawImage(
+    const std::string &filename,
+    const uint8_t *buffer,
+    const uint64_t &size,
+    const uint8_t &max_error,
+    uint64_t &mismatch
   );
 
   /**
    * Write encoded data into specified file
    * @param[in] filename Name of file the data will be written to
-   * @param[in] settings Byte containing metadata to be written as first byte before buffer
-   * @param[in] buffer Buffer that will be written after settings byte into file
+   * @param[in] buffer Buffer with header and encoded data that will be written into file
    * @param[in] size Number of bytes to be written into file
+   * @param[in] trailer Bytes written right after buffer
    * @returns True when successfuly written into file
    * */
   bool WriteEncodedData(
     std::string &filename,
-    const uint8_t &settings,
     uint8_t * &buffer,
-    const uint64_t &size
+    const uint64_t &size,
+    const std::vector<uint8_t> &trailer = {}
   );
 
+  /**
+   * Drop end of loaded data, so only given number of bytes from start is used
+   * @param[in] size New size of data, when bigger than current size, nothing happens
+   * */
+  void Truncate(const uint64_t &size);
+
   /**
    * Return pointer to class buffer
    * @returns Pointer to buffer
@@ -0,0 +1,37 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: frames.hpp
+ * Description: Contains definitions of constant data for both frames compressor and decompressor
+ * */
+#ifndef __FRAMES__
+#define __FRAMES__
+
+#include <cstdint>  // uint8_t, uint32_t
+
+// Constants used both in FramesCompressor and FramesDecompressor
+
+// Types of frames saved in frame index
+// Frame coded on its own
+constexpr uint8_t FRAME_KEY = 0;
+// Frame coded as difference from previous frame
+constexpr uint8_t FRAME_DELTA_PREVIOUS = 1;
+// Frame coded as difference from last key frame
+constexpr uint8_t FRAME_DELTA_KEY = 2;
+
+// Default number of frames between two key frames
+constexpr uint32_t FRAMES_DEFAULT_KEY_INTERVAL = 16;
+
+// Number of bytes of width, height, frame count and key interval
+constexpr uint8_t FRAMES_VALUE_BYTES = 4;
+
+// Size of header, magic bytes followed by width, height, frame count and key interval
+constexpr uint8_t FRAMES_HEADER_SIZE = 4 + 4 * FRAMES_VALUE_BYTES;
+
+// Number of bytes of offset and size of frame in index
+constexpr uint8_t FRAMES_OFFSET_BYTES = 8;
+
+// Size of one entry in frame index, offset, size and type of frame
+constexpr uint8_t FRAMES_INDEX_ENTRY_SIZE = 2 * FRAMES_OFFSET_BYTES + 1;
+
+#endif
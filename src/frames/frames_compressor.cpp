@@ -0,0 +1,174 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: frames_compressor.cpp
+ * Description: Contains implementations of frames compressor class that is used to compress
+ * sequence of same sized frames, coding frames as difference from reference frame
+ * */
+#include "frames_compressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor that will initialize values
+ * @param[in] buffer Buffer with all frames after each other
+ * @param[in] width Width of frame
+ * @param[in] height Height of frame
+ * @param[in] frame_count Number of frames in buffer
+ * */
+FramesCompressor::FramesCompressor(
+  const uint8_t *buffer,
+  const uint32_t &width,
+  const uint32_t &height,
+  const uint32_t &frame_count
+) {
+  // Set frames which we will be compressing
+  this->buffer = buffer;
+  this->width = width;
+  this->height = height;
+  this->frame_count = frame_count;
+
+  // Set container data
+  this->encoded_buff = nullptr;
+  this->encoded_index = 0;
+}
+
+/**
+ * Deconstructor that will free allocated data
+ * */
+FramesCompressor::~FramesCompressor() {
+  // When buffer was allocated, free him
+  if (this->encoded_buff) {
+    free(this->encoded_buff);
+  }
+
+  // Remove pointer pointing to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Calculate difference of frame and reference frame, 16 pixels at once when SSE2 is available
+ * @param[in] frame Frame to be coded
+ * @param[in] reference Reference frame
+ * @param[out] residual Resulting difference
+ * @param[in] size Number of pixels of frame
+ * */
+void FramesCompressor::SubtractFrame(
+  const uint8_t *frame,
+  const uint8_t *reference,
+  uint8_t *residual,
+  const size_t &size
+) {
+  size_t i = 0;
+
+#ifdef __SSE2__
+  // Subtract 16 pixels at once, overflow wraps the same way as in scalar code
+  for (; (i + 16) <= size; i += 16) {
+    const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&frame[i]));
+    const __m128i reference_pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&reference[i]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&residual[i]), _mm_sub_epi8(pixels, reference_pixels));
+  }
+#endif
+
+  // Remaining pixels
+  for (; i < size; i++) {
+    residual[i] = (frame[i] - reference[i]);
+  }
+}
+
+/**
+ * Compress all frames, every key_interval-th frame is coded on its own and others as difference
+ * @param[in] settings Settings of compression pipeline, used for each frame
+ * @param[in] key_interval Number of frames between two key frames, 1 for key frames only
+ * @param[in] key_reference True to code frames as difference from last key frame, otherwise from previous frame
+ * */
+void FramesCompressor::Compress(
+  const CodecSettings &settings,
+  const uint32_t &key_interval,
+  const bool &key_reference
+) {
+  const size_t frame_size = static_cast<size_t>(this->width) * this->height;
+  const uint32_t interval = (key_interval == 0) ? 1 : key_interval;
+
+  // Encoded data and type of each frame
+  std::vector<ImageCodec> codecs(this->frame_count);
+  std::vector<uint8_t> types(this->frame_count);
+  uint64_t data_size = 0;
+
+  // Difference of frame and its reference
+  uint8_t *residual = (uint8_t *)malloc(sizeof(uint8_t) * (frame_size + 1));
+
+  // Invalid pointer
+  assert(residual != nullptr);
+
+  const uint8_t *key_frame = this->buffer;
+  for (uint32_t i = 0; i < this->frame_count; i++) {
+    const uint8_t *frame = &this->buffer[i * frame_size];
+    TraceSpan span("frame", "block", {{"index", i}});
+
+    // Key frame, compress frame as it is
+    if ((i % interval) == 0) {
+      types[i] = FRAME_KEY;
+      key_frame = frame;
+      codecs[i].Compress(frame, this->width, this->height, settings, false);
+    // Compress difference from reference frame
+    } else {
+      types[i] = key_reference ? FRAME_DELTA_KEY : FRAME_DELTA_PREVIOUS;
+      this->SubtractFrame(frame, key_reference ? key_frame : (frame - frame_size), residual, frame_size);
+      codecs[i].Compress(residual, this->width, this->height, settings, false);
+    }
+
+    data_size += codecs[i].GetSize();
+    span.AddArg("bytes", codecs[i].GetSize());
+  }
+
+  free(residual);
+
+  // Allocate buffer for header, index and data of all frames
+  const uint64_t index_size = static_cast<uint64_t>(this->frame_count) * FRAMES_INDEX_ENTRY_SIZE;
+  this->encoded_buff = (uint8_t *)malloc(sizeof(uint8_t) * (FRAMES_HEADER_SIZE + index_size + data_size));
+
+  // Invalid pointer
+  assert(this->encoded_buff != nullptr);
+
+  // Magic bytes of container
+  memcpy(this->encoded_buff, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC));
+  this->encoded_index = sizeof(CONTAINER_MAGIC);
+  this->encoded_buff[this->encoded_index++] = CONTAINER_FRAMES;
+
+  // Size of frames, their count and key interval
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->width, FRAMES_VALUE_BYTES);
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->height, FRAMES_VALUE_BYTES);
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->frame_count, FRAMES_VALUE_BYTES);
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, interval, FRAMES_VALUE_BYTES);
+
+  // Frame index, offsets are counted from the end of index
+  uint64_t offset = 0;
+  for (uint32_t i = 0; i < this->frame_count; i++) {
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, offset, FRAMES_OFFSET_BYTES);
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, codecs[i].GetSize(), FRAMES_OFFSET_BYTES);
+    this->encoded_buff[this->encoded_index++] = types[i];
+    offset += codecs[i].GetSize();
+  }
+
+  // Encoded data of frames
+  for (uint32_t i = 0; i < this->frame_count; i++) {
+    memcpy(&this->encoded_buff[this->encoded_index], codecs[i].GetBuffer(), codecs[i].GetSize());
+    this->encoded_index += codecs[i].GetSize();
+  }
+}
+
+/**
+ * Return pointer to container buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & FramesCompressor::GetBuffer() {
+  return this->encoded_buff;
+}
+
+/**
+ * Return container buffer size
+ * @returns Size of buffer
+ * */
+uint64_t & FramesCompressor::GetSize() {
+  return this->encoded_index;
+}
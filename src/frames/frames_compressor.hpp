@@ -0,0 +1,84 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: frames_compressor.hpp
+ * Description: Contains definitions of frames compressor class that is used to compress
+ * sequence of same sized frames, coding frames as difference from reference frame
+ * */
+#ifndef __FRAMES_COMPRESSOR__
+#define __FRAMES_COMPRESSOR__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstring>  // memcpy
+#include <vector>   // vector
+#include <cassert>  // assert
+
+#ifdef __SSE2__
+#include <emmintrin.h> // _mm_sub_epi8
+#endif
+
+#include "frames.hpp"
+#include "../container.hpp"
+#include "../image_codec.hpp"
+
+/**
+ * Class that will compress frames into multi-frame container with frame index
+ * */
+class FramesCompressor {
+private:
+  // Buffer with all frames after each other
+  const uint8_t *buffer;
+  uint32_t width;
+  uint32_t height;
+  uint32_t frame_count;
+
+  // Resulting container
+  uint8_t *encoded_buff;
+  uint64_t encoded_index;
+
+  /**
+   * Calculate difference of frame and reference frame, 16 pixels at once when SSE2 is available
+   * @param[in] frame Frame to be coded
+   * @param[in] reference Reference frame
+   * @param[out] residual Resulting difference
+   * @param[in] size Number of pixels of frame
+   * */
+  void SubtractFrame(const uint8_t *frame, const uint8_t *reference, uint8_t *residual, const size_t &size);
+
+public:
+  /**
+   * Constructor that will initialize values
+   * @param[in] buffer Buffer with all frames after each other
+   * @param[in] width Width of frame
+   * @param[in] height Height of frame
+   * @param[in] frame_count Number of frames in buffer
+   * */
+  FramesCompressor(const uint8_t *buffer, const uint32_t &width, const uint32_t &height, const uint32_t &frame_count);
+
+  /**
+   * Deconstructor that will free allocated data
+   * */
+  ~FramesCompressor();
+
+  /**
+   * Compress all frames, every key_interval-th frame is coded on its own and others as difference
+   * @param[in] settings Settings of compression pipeline, used for each frame
+   * @param[in] key_interval Number of frames between two key frames, 1 for key frames only
+   * @param[in] key_reference True to code frames as difference from last key frame, otherwise from previous frame
+   * */
+  void Compress(const CodecSettings &settings, const uint32_t &key_interval, const bool &key_reference);
+
+  /**
+   * Return pointer to container buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return container buffer size
+   * @returns Size of buffer
+   * */
+  uint64_t & GetSize();
+};
+
+#endif
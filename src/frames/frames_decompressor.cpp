@@ -0,0 +1,254 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: frames_decompressor.cpp
+ * Description: Contains implementations of frames decompressor class that is used to decompress
+ * multi-frame container created by FramesCompressor
+ * */
+#include "frames_decompressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor for FramesDecompressor that will initialize values
+ * @param[in] buffer Data buffer holding container
+ * @param[in] size Size of data buffer
+ * */
+FramesDecompressor::FramesDecompressor(uint8_t * &buffer, const uint64_t &size) {
+  // Receive buffer
+  this->buffer = buffer;
+  this->size = size;
+
+  // Initialize header values
+  this->width = 0;
+  this->height = 0;
+  this->frame_count = 0;
+  this->key_interval = 0;
+  this->data_start = 0;
+
+  // Initialize decompressed data buffer
+  this->dec_buffer = nullptr;
+  this->dec_buffer_index = 0;
+}
+
+/**
+ * Deconstructor for FramesDecompressor that will free allocated data
+ * */
+FramesDecompressor::~FramesDecompressor() {
+  // Free allocated decompressed data buffer, when one was allocated
+  if (this->dec_buffer != nullptr) {
+    free(this->dec_buffer);
+  }
+
+  // Destroy pointer to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Add reference frame to decoded difference, 16 pixels at once when SSE2 is available
+ * @param[out] frame Decoded difference, that will be replaced by frame
+ * @param[in] reference Reference frame
+ * @param[in] size Number of pixels of frame
+ * */
+void FramesDecompressor::AddFrame(uint8_t *frame, const uint8_t *reference, const size_t &size) {
+  size_t i = 0;
+
+#ifdef __SSE2__
+  // Add 16 pixels at once, overflow wraps the same way as in scalar code
+  for (; (i + 16) <= size; i += 16) {
+    const __m128i residual = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&frame[i]));
+    const __m128i reference_pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&reference[i]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&frame[i]), _mm_add_epi8(residual, reference_pixels));
+  }
+#endif
+
+  // Remaining pixels
+  for (; i < size; i++) {
+    frame[i] += reference[i];
+  }
+}
+
+/**
+ * Return type of frame from frame index
+ * @param[in] frame Index of frame
+ * @returns Type of frame
+ * */
+uint8_t FramesDecompressor::FrameType(const uint32_t &frame) {
+  return this->buffer[FRAMES_HEADER_SIZE + static_cast<uint64_t>(frame) * FRAMES_INDEX_ENTRY_SIZE + 2 * FRAMES_OFFSET_BYTES];
+}
+
+/**
+ * Decompress one frame from frame index, reference frame needs to be already decompressed
+ * @param[in] frame Index of frame
+ * @param[out] output Place where decompressed frame will be written
+ * @param[in] reference Reference frame, ignored for key frames
+ * @returns True when frame was decompressed, false otherwise
+ * */
+bool FramesDecompressor::DecodeFrame(const uint32_t &frame, uint8_t *output, const uint8_t *reference) {
+  const size_t frame_size = static_cast<size_t>(this->width) * this->height;
+  const uint64_t entry = FRAMES_HEADER_SIZE + static_cast<uint64_t>(frame) * FRAMES_INDEX_ENTRY_SIZE;
+  const uint64_t offset = this->data_start + ByteIo::ReadValue(this->buffer, entry, FRAMES_OFFSET_BYTES);
+  const uint64_t length = ByteIo::ReadValue(this->buffer, entry + FRAMES_OFFSET_BYTES, FRAMES_OFFSET_BYTES);
+
+  // Encoded data of frame are outside of container
+  if (offset > this->size || length > (this->size - offset)) {
+    std::cerr << "Frame " << frame << " is outside of container!" << std::endl;
+    return false;
+  }
+
+  // Decompress frame on its own
+  TraceSpan span("frame decode", "block", {{"index", frame}, {"bytes", length}});
+  ImageCodec codec;
+  if (!codec.Decompress(&this->buffer[offset], length) || codec.GetSize() != frame_size) {
+    std::cerr << "Failed to decompress frame " << frame << "!" << std::endl;
+    return false;
+  }
+  memcpy(output, codec.GetBuffer(), frame_size);
+
+  // Difference frame, add reference frame
+  if (this->FrameType(frame) != FRAME_KEY) {
+    this->AddFrame(output, reference, frame_size);
+  }
+
+  return true;
+}
+
+/**
+ * Read header of container and check frame index
+ * @returns True when container is valid, false otherwise
+ * */
+bool FramesDecompressor::ReadHeader() {
+  // Check magic bytes and size of header
+  if (!IsContainer(this->buffer, this->size, CONTAINER_FRAMES) || this->size < FRAMES_HEADER_SIZE) {
+    std::cerr << "Data are not multi-frame container!" << std::endl;
+    return false;
+  }
+
+  // Load size of frames, their count and key interval
+  this->width = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE, FRAMES_VALUE_BYTES);
+  this->height = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE + FRAMES_VALUE_BYTES, FRAMES_VALUE_BYTES);
+  this->frame_count = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE + 2 * FRAMES_VALUE_BYTES, FRAMES_VALUE_BYTES);
+  this->key_interval = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE + 3 * FRAMES_VALUE_BYTES, FRAMES_VALUE_BYTES);
+
+  // Check that whole frame index is present
+  this->data_start = FRAMES_HEADER_SIZE + static_cast<uint64_t>(this->frame_count) * FRAMES_INDEX_ENTRY_SIZE;
+  if (this->data_start > this->size) {
+    std::cerr << "Container does not contain whole frame index!" << std::endl;
+    return false;
+  }
+
+  // First frame always needs to be key frame
+  if (this->frame_count > 0 && this->FrameType(0) != FRAME_KEY) {
+    std::cerr << "First frame is not key frame!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Decompress all frames after each other
+ * @returns True when decompression was successfull, false otherwise
+ * */
+bool FramesDecompressor::Decompress() {
+  const size_t frame_size = static_cast<size_t>(this->width) * this->height;
+
+  // Allocate memory for all frames
+  this->dec_buffer_index = static_cast<uint64_t>(this->frame_count) * frame_size;
+  this->dec_buffer = (uint8_t *)malloc(sizeof(uint8_t) * (this->dec_buffer_index + 1));
+
+  // Invalid allocation
+  assert(this->dec_buffer != nullptr);
+
+  // Decompress frames in order, so reference frames are always decompressed before use
+  const uint8_t *key_frame = this->dec_buffer;
+  for (uint32_t i = 0; i < this->frame_count; i++) {
+    uint8_t *frame = &this->dec_buffer[i * frame_size];
+    const uint8_t type = this->FrameType(i);
+
+    if (!this->DecodeFrame(i, frame, (type == FRAME_DELTA_KEY) ? key_frame : (frame - frame_size))) {
+      return false;
+    }
+
+    // Remember last key frame
+    if (type == FRAME_KEY) {
+      key_frame = frame;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Decompress one frame, only frames from the closest previous key frame are decompressed
+ * @param[in] frame Index of frame
+ * @returns True when decompression was successfull, false otherwise
+ * */
+bool FramesDecompressor::DecompressFrame(const uint32_t &frame) {
+  const size_t frame_size = static_cast<size_t>(this->width) * this->height;
+
+  // Frame does not exist
+  if (frame >= this->frame_count) {
+    std::cerr << "Container has only " << this->frame_count << " frames!" << std::endl;
+    return false;
+  }
+
+  // Find the closest previous key frame through frame index
+  uint32_t key = frame;
+  while (this->FrameType(key) != FRAME_KEY) {
+    key--;
+  }
+
+  // Buffers for key frame, previous frame and current frame
+  this->dec_buffer = (uint8_t *)malloc(sizeof(uint8_t) * (3 * frame_size + 1));
+
+  // Invalid allocation
+  assert(this->dec_buffer != nullptr);
+
+  uint8_t *key_frame = this->dec_buffer;
+  uint8_t *previous = &this->dec_buffer[frame_size];
+  uint8_t *current = &this->dec_buffer[2 * frame_size];
+
+  // Decompress key frame
+  if (!this->DecodeFrame(key, key_frame, nullptr)) {
+    return false;
+  }
+  memcpy(previous, key_frame, frame_size);
+
+  // Decompress frames up to the requested one, frame coded from key frame needs no frames between
+  const bool from_key = (this->FrameType(frame) == FRAME_DELTA_KEY);
+  for (uint32_t i = (from_key ? frame : (key + 1)); i <= frame && i > key; i++) {
+    if (!this->DecodeFrame(i, current, (this->FrameType(i) == FRAME_DELTA_KEY) ? key_frame : previous)) {
+      return false;
+    }
+    std::swap(previous, current);
+  }
+
+  // Requested frame is now in previous buffer, move it to the start of buffer
+  memmove(this->dec_buffer, previous, frame_size);
+  this->dec_buffer_index = frame_size;
+  return true;
+}
+
+/**
+ * Return number of frames in container
+ * @returns Number of frames
+ * */
+uint32_t FramesDecompressor::GetFrameCount() {
+  return this->frame_count;
+}
+
+/**
+ * Return pointer to decompressed data buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & FramesDecompressor::GetBuffer() {
+  return this->dec_buffer;
+}
+
+/**
+ * Return decompressed data buffer size
+ * @returns Size of buffer
+ * */
+uint64_t FramesDecompressor::GetSize() {
+  return this->dec_buffer_index;
+}
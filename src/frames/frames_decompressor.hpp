@@ -0,0 +1,123 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: frames_decompressor.hpp
+ * Description: Contains definitions of frames decompressor class that is used to decompress
+ * multi-frame container created by FramesCompressor
+ * */
+#ifndef __FRAMES_DECOMPRESSOR__
+#define __FRAMES_DECOMPRESSOR__
+
+#include <iostream> // cerr
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstring>  // memcpy
+#include <cassert>  // assert
+
+#ifdef __SSE2__
+#include <emmintrin.h> // _mm_add_epi8
+#endif
+
+#include "frames.hpp"
+#include "../container.hpp"
+#include "../image_codec.hpp"
+
+/**
+ * Class used for decompressing frames from multi-frame container
+ * */
+class FramesDecompressor {
+private:
+  // Buffer that holds loaded container
+  uint8_t *buffer;
+  // Size of loaded container
+  uint64_t size;
+
+  // Size of frames, their count and key interval
+  uint32_t width;
+  uint32_t height;
+  uint32_t frame_count;
+  uint32_t key_interval;
+
+  // Start of encoded data of frames, right after frame index
+  uint64_t data_start;
+
+  // Buffer for holding decompressed frames
+  uint8_t *dec_buffer;
+  // Size of decompressed frames
+  uint64_t dec_buffer_index;
+
+  /**
+   * Add reference frame to decoded difference, 16 pixels at once when SSE2 is available
+   * @param[out] frame Decoded difference, that will be replaced by frame
+   * @param[in] reference Reference frame
+   * @param[in] size Number of pixels of frame
+   * */
+  void AddFrame(uint8_t *frame, const uint8_t *reference, const size_t &size);
+
+  /**
+   * Decompress one frame from frame index, reference frame needs to be already decompressed
+   * @param[in] frame Index of frame
+   * @param[out] output Place where decompressed frame will be written
+   * @param[in] reference Reference frame, ignored for key frames
+   * @returns True when frame was decompressed, false otherwise
+   * */
+  bool DecodeFrame(const uint32_t &frame, uint8_t *output, const uint8_t *reference);
+
+  /**
+   * Return type of frame from frame index
+   * @param[in] frame Index of frame
+   * @returns Type of frame
+   * */
+  uint8_t FrameType(const uint32_t &frame);
+
+public:
+  /**
+   * Constructor for FramesDecompressor that will initialize values
+   * @param[in] buffer Data buffer holding container
+   * @param[in] size Size of data buffer
+   * */
+  FramesDecompressor(uint8_t * &buffer, const uint64_t &size);
+
+  /**
+   * Deconstructor for FramesDecompressor that will free allocated data
+   * */
+  ~FramesDecompressor();
+
+  /**
+   * Read header of container and check frame index
+   * @returns True when container is valid, false otherwise
+   * */
+  bool ReadHeader();
+
+  /**
+   * Decompress all frames after each other
+   * @returns True when decompression was successfull, false otherwise
+   * */
+  bool Decompress();
+
+  /**
+   * Decompress one frame, only frames from the closest previous key frame are decompressed
+   * @param[in] frame Index of frame
+   * @returns True when decompression was successfull, false otherwise
+   * */
+  bool DecompressFrame(const uint32_t &frame);
+
+  /**
+   * Return number of frames in container
+   * @returns Number of frames
+   * */
+  uint32_t GetFrameCount();
+
+  /**
+   * Return pointer to decompressed data buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return decompressed data buffer size
+   * @returns Size of buffer
+   * */
+  uint64_t GetSize();
+};
+
+#endif
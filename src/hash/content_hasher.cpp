@@ -0,0 +1,126 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: content_hasher.cpp
+ * Description: Contains implementations of ContentHasher class, that is used to compute fast
+ * 128 bit hash of raw data, so identical images can be found without comparing them
+ * */
+#include "content_hasher.hpp"
+
+// Primes used by XXH3
+constexpr uint64_t HASH_PRIME32_1 = 0x9E3779B1ULL;
+constexpr uint64_t HASH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t HASH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+
+// Values mixed with data, with accumulators before scrambling and before both merges
+constexpr uint64_t HASH_SECRET[4][HASH_LANES] = {
+  {0xBE4BA423396CFEB8ULL, 0x1CAD21F72C81017CULL, 0xDB979083E96DD4DEULL, 0x1F67B3B7A4A44072ULL,
+   0x78E5C0CC4EE679CBULL, 0x2172FFCC7DD05A82ULL, 0x8E2443F7744608B8ULL, 0x4C263A81E69035E0ULL},
+  {0xCB00C391BB52283CULL, 0xA32E531B8B65D088ULL, 0x4EF90DA297486471ULL, 0xD8ACDEA946EF1938ULL,
+   0x3F349CE33F76FAA8ULL, 0x1D4F0BC7C7BBDCF9ULL, 0x3159B4CD4BE0518AULL, 0x647378D9C97E9FC8ULL},
+  {0xC3EBD33483ACC5EAULL, 0xEB6313FAFFA081C5ULL, 0x49DAF0B751DD0D17ULL, 0x9E68D429265516D3ULL,
+   0xFCA1477D58BE162BULL, 0xCE31D07AD1B8F88FULL, 0x280416958F3ACB45ULL, 0x7E404BBBCAFBD7AFULL},
+  {0x81DAD2F0FA9BF1DAULL, 0x3CA3DCEC0DFC0E56ULL, 0x5FCEA7DB0E7F5CE5ULL, 0xA2C2B87B0C3A2DB2ULL,
+   0xF11D95A32B01A6CBULL, 0x4F0F2D29AE3C9DF6ULL, 0x9A5C7B36F79A5CE1ULL, 0x8BC66E3A1C24F2A5ULL}
+};
+
+/**
+ * Accumulate one stripe into accumulators
+ * @param[in,out] acc Accumulators
+ * @param[in] stripe Stripe of 64 bytes
+ * */
+void ContentHasher::Accumulate(uint64_t *acc, const uint8_t *stripe) {
+#ifdef __SSE2__
+  // Two lanes at once, low 32 bits of mixed value are multiplied by its high 32 bits
+  for (uint8_t i = 0; i < HASH_LANES; i += 2) {
+    const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&stripe[i * 8]));
+    const __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&HASH_SECRET[0][i]));
+    const __m128i mixed = _mm_xor_si128(data, key);
+    const __m128i product = _mm_mul_epu32(mixed, _mm_shuffle_epi32(mixed, _MM_SHUFFLE(0, 3, 0, 1)));
+    const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+
+    __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&acc[i]));
+    lanes = _mm_add_epi64(lanes, _mm_add_epi64(product, swapped));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&acc[i]), lanes);
+  }
+#else
+  for (uint8_t i = 0; i < HASH_LANES; i++) {
+    uint64_t data;
+    memcpy(&data, &stripe[i * 8], sizeof(data));
+    const uint64_t mixed = data ^ HASH_SECRET[0][i];
+
+    // Data are also added to neighbour lane, so no input is lost by multiplication by zero
+    acc[i ^ 1] += data;
+    acc[i] += (mixed & 0xFFFFFFFF) * (mixed >> 32);
+  }
+#endif
+}
+
+/**
+ * Scramble accumulators after block of stripes, so high bits affect low bits
+ * @param[in,out] acc Accumulators
+ * */
+void ContentHasher::Scramble(uint64_t *acc) {
+  for (uint8_t i = 0; i < HASH_LANES; i++) {
+    acc[i] ^= (acc[i] >> 47);
+    acc[i] ^= HASH_SECRET[1][i];
+    acc[i] *= HASH_PRIME32_1;
+  }
+}
+
+/**
+ * Merge accumulators into one 64 bit value
+ * @param[in] acc Accumulators
+ * @param[in] secret Values mixed with accumulators
+ * @param[in] size Size of hashed data
+ * @returns Merged value
+ * */
+uint64_t ContentHasher::Merge(const uint64_t *acc, const uint64_t *secret, const uint64_t &size) {
+  uint64_t result = size * HASH_PRIME64_1;
+
+  // Fold 128 bit product of each pair of lanes
+  for (uint8_t i = 0; i < HASH_LANES; i += 2) {
+    const unsigned __int128 product =
+      static_cast<unsigned __int128>(acc[i] ^ secret[i]) * (acc[i + 1] ^ secret[i + 1]);
+    result += static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+  }
+
+  // Avalanche
+  result ^= (result >> 37);
+  result *= HASH_PRIME64_2;
+  result ^= (result >> 32);
+  return result;
+}
+
+/**
+ * Compute hash of given data
+ * @param[in] data Data to be hashed
+ * @param[in] size Size of data
+ * @returns Hash of data
+ * */
+ContentHash ContentHasher::Hash(const uint8_t *data, const size_t &size) {
+  uint64_t acc[HASH_LANES] = {
+    HASH_PRIME32_1, HASH_PRIME64_1, HASH_PRIME64_2, HASH_PRIME64_1 ^ HASH_PRIME64_2,
+    HASH_PRIME64_2 + HASH_PRIME32_1, HASH_PRIME64_1 * 3, HASH_PRIME64_2 * 5, HASH_PRIME32_1 * 7
+  };
+
+  // Full stripes, scrambled after each block
+  const size_t stripes = size / HASH_STRIPE_SIZE;
+  for (size_t i = 0; i < stripes; i++) {
+    Accumulate(acc, &data[i * HASH_STRIPE_SIZE]);
+    if ((i + 1) % HASH_STRIPES_PER_BLOCK == 0) {
+      Scramble(acc);
+    }
+  }
+
+  // Remaining bytes are padded by zeros into last stripe
+  const size_t remaining = size % HASH_STRIPE_SIZE;
+  if (remaining > 0) {
+    uint8_t stripe[HASH_STRIPE_SIZE];
+    memset(stripe, 0, HASH_STRIPE_SIZE);
+    memcpy(stripe, &data[stripes * HASH_STRIPE_SIZE], remaining);
+    Accumulate(acc, stripe);
+  }
+
+  return {Merge(acc, HASH_SECRET[2], size), Merge(acc, HASH_SECRET[3], ~static_cast<uint64_t>(size))};
+}
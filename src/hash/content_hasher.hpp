@@ -0,0 +1,87 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: content_hasher.hpp
+ * Description: Contains definitions of ContentHasher class, that is used to compute fast
+ * 128 bit hash of raw data, so identical images can be found without comparing them
+ * */
+#ifndef __CONTENT_HASHER__
+#define __CONTENT_HASHER__
+
+#include <cstdint>  // uint8_t, uint64_t
+#include <cstring>  // memcpy, memset
+#include <cstddef>  // size_t
+
+#ifdef __SSE2__
+#include <emmintrin.h> // _mm_mul_epu32, _mm_add_epi64
+#endif
+
+// Number of 64 bit accumulators, that together process one stripe
+constexpr uint8_t HASH_LANES = 8;
+// Number of bytes of one stripe
+constexpr uint8_t HASH_STRIPE_SIZE = HASH_LANES * 8;
+// Number of stripes, after which accumulators are scrambled
+constexpr uint8_t HASH_STRIPES_PER_BLOCK = 16;
+
+/**
+ * Result of hashing, two independent 64 bit halves
+ * @param low First half of hash
+ * @param high Second half of hash
+ * */
+typedef struct ContentHash {
+  uint64_t low;
+  uint64_t high;
+
+  bool operator==(const ContentHash &other) const {
+    return low == other.low && high == other.high;
+  }
+} ContentHash;
+
+/**
+ * Class that computes hash of data with XXH3 like algorithm, stripes of 64 bytes are
+ * accumulated into 8 lanes, with SSE2 two lanes at once
+ * */
+class ContentHasher {
+private:
+  /**
+   * Accumulate one stripe into accumulators
+   * @param[in,out] acc Accumulators
+   * @param[in] stripe Stripe of 64 bytes
+   * */
+  static void Accumulate(uint64_t *acc, const uint8_t *stripe);
+
+  /**
+   * Scramble accumulators after block of stripes, so high bits affect low bits
+   * @param[in,out] acc Accumulators
+   * */
+  static void Scramble(uint64_t *acc);
+
+  /**
+   * Merge accumulators into one 64 bit value
+   * @param[in] acc Accumulators
+   * @param[in] secret Values mixed with accumulators
+   * @param[in] size Size of hashed data
+   * @returns Merged value
+   * */
+  static uint64_t Merge(const uint64_t *acc, const uint64_t *secret, const uint64_t &size);
+
+public:
+  /**
+   * Compute hash of given data
+   * @param[in] data Data to be hashed
+   * @param[in] size Size of data
+   * @returns Hash of data
+   * */
+  static ContentHash Hash(const uint8_t *data, const size_t &size);
+};
+
+/**
+ * Hash functor, so ContentHash can be used as key of unordered containers
+ * */
+struct ContentHashKey {
+  size_t operator()(const ContentHash &hash) const {
+    return static_cast<size_t>(hash.low);
+  }
+};
+
+#endif
@@ -12,6 +12,8 @@
 #include <stdlib.h>   // malloc
 #include <vector>     // vector
 #include <iostream>   // cerr
+#include <algorithm>  // max
+#include <cassert>    // assert
 
 // Maximum number of values
 constexpr uint16_t N_VALUES = 256;
@@ -23,6 +25,14 @@ constexpr uint8_t BITS_IN_BYTE = 8;
 constexpr uint8_t PADDING_BITS_MASK = 0x07;
 // When given bit is set, do huffman decoding, otherwise only copy data to output buffer
 constexpr uint8_t SETTINGS_BIT_CHECK = 0x08;
+// Together with SETTINGS_BIT_CHECK, data are coded by static canonical huffman code instead of adaptive one
+constexpr uint8_t STATIC_HUFFMAN_SETTINGS_BIT = 0x80;
+// Longest code of static huffman code, so symbol is decoded by one lookup into table of 2^12 entries
+constexpr uint8_t STATIC_HUFFMAN_MAX_LENGTH = 12;
+// Number of bytes of number of coded symbols
+constexpr uint8_t STATIC_HUFFMAN_COUNT_BYTES = 8;
+// Size of static huffman header, code length of each value in 4 bits followed by number of symbols
+constexpr uint16_t STATIC_HUFFMAN_HEADER_SIZE = N_VALUES / 2 + STATIC_HUFFMAN_COUNT_BYTES;
 
 /**
  * Represent Node structure for holding huffman data
@@ -42,5 +52,21 @@ typedef struct Node {
   uint8_t val;
 } Node;
 
+/**
+ * Counters of huffman coder, reported by --stats
+ * @param symbols Number of coded symbols
+ * @param nyt_count Number of symbols coded as NYT code followed by literal byte
+ * @param swap_count Number of swapped nodes while updating tree, training included
+ * @param max_depth Depth of the deepest leaf of tree after coding, longest code of static huffman code
+ * @param code_bits Number of bits of all codes and literal bytes, without header
+ * */
+typedef struct HuffmanStats {
+  uint64_t symbols;
+  uint64_t nyt_count;
+  uint64_t swap_count;
+  uint32_t max_depth;
+  uint64_t code_bits;
+} HuffmanStats;
+
 
 #endif
\ No newline at end of file
@@ -17,6 +17,7 @@ HuffmanCoder::HuffmanCoder() {
     this->byte_index = 0;
     this->bit_index = 0;
     this->buffer = nullptr;
+    this->stats = {0, 0, 0, 0, 0};
 
     // Allocate buffer for 512 bytes
     this->ReallocateBuffer();
@@ -73,6 +74,11 @@ void HuffmanCoder::ReallocateBuffer() {
         {
             memcpy(tmp, this->buffer, (this->byte_index + 1));
             free(this->buffer);
+            AllocCounters::Reallocation(this->byte_index + 1);
+        }
+        else
+        {
+            AllocCounters::Allocation();
         }
 
         // Increase allocation size
@@ -257,7 +263,7 @@ Node* HuffmanCoder::FindHighestBlockNode(Node *node) {
     uint64_t i = 0;
 
     // Insert root and start searching from root
-    queue.push_back(this->root);
+    AllocCounters::PushBack(queue, this->root, ALLOC_QUEUE);
 
     // Traverse tree, until we went through all the nodes
     while (i < queue.size()) {
@@ -272,12 +278,12 @@ Node* HuffmanCoder::FindHighestBlockNode(Node *node) {
 
         // When right node exist, add it to the queue
         if (tmp->right != nullptr) {
-            queue.push_back(tmp->right);
+            AllocCounters::PushBack(queue, tmp->right, ALLOC_QUEUE);
         }
 
         // When left node exist, add it to the queue
         if (tmp->left != nullptr) {
-            queue.push_back(tmp->left);
+            AllocCounters::PushBack(queue, tmp->left, ALLOC_QUEUE);
         }
         
         // Increment queue index
@@ -386,6 +392,51 @@ void HuffmanCoder::CompareWithRLE(uint8_t * &buffer, const size_t &size, uint8_t
     settings |= SETTINGS_BIT_CHECK;
 }
 
+/**
+ * Update weights of nodes from given node up to the root, swapping nodes to keep sibling property
+ * @param[in] node Node whose weight is incremented first
+ * */
+void HuffmanCoder::UpdateTree(Node *node) {
+    while (true) {
+        // Get node of highest index with the same weight, when no is found, we will return node
+        Node *highest_node = this->FindHighestBlockNode(node);
+
+        // Swap with highest numbered block
+        if (highest_node != node && highest_node != node->parent) {
+            this->SwapNodes(highest_node, node);
+            this->stats.swap_count++;
+        }
+
+        // Increment weight
+        node->weight++;
+
+        // When we reached root node, stop updating tree
+        if (this->root == node) {
+            break;
+        }
+
+        // Move to parent
+        node = node->parent;
+    }
+}
+
+/**
+ * Update tree with given symbols without writing any bits, decoder needs to be trained with the same symbols
+ * @param[in] buffer Buffer containing training symbols
+ * @param[in] size Size of buffer in bytes
+ * */
+void HuffmanCoder::Train(const uint8_t *buffer, const size_t &size) {
+    for (size_t i = 0; i < size; i++) {
+        // First appearance of symbol, add it after NYT node
+        Node *node = this->FindSymbol(buffer[i]);
+        if (node == nullptr) {
+            node = this->AddSymbol(buffer[i]);
+        }
+
+        this->UpdateTree(node);
+    }
+}
+
 /**
  * Encode RLE data to huffman code
  * @param[in] buffer Buffer containing RLE data
@@ -404,6 +455,8 @@ void HuffmanCoder::Encode(uint8_t * &buffer, const size_t &size, uint8_t &settin
             // Add path to NYT to buffer
             this->FindPathToRoot(this->NYT, path);
             this->AddBits(path);
+            this->stats.nyt_count++;
+            this->stats.code_bits += path.size() + BITS_IN_BYTE;
 
             // Add symbol, returned node is old NYT
             node = this->AddSymbol(buffer[i]);
@@ -415,30 +468,15 @@ void HuffmanCoder::Encode(uint8_t * &buffer, const size_t &size, uint8_t &settin
             // Add path to symbol to buffer
             this->FindPathToRoot(node, path);
             this->AddBits(path);
+            this->stats.code_bits += path.size();
         }
 
-        while (true) {
-            // Get node of highest index with the same weight, when no is found, we will return node
-            Node *highest_node = this->FindHighestBlockNode(node);
-
-            // Swap with highest numbered block
-            if (highest_node != node && highest_node != node->parent) {
-                this->SwapNodes(highest_node, node);
-            }
-            
-            // Increment weight
-            node->weight++;
-
-            // When we reached root node, stop updating tree
-            if (this->root == node) {
-                break;
-            }
-
-            // Move to parent
-            node = node->parent;
-        }
+        // Update tree
+        this->UpdateTree(node);
     }
 
+    this->stats.symbols += size;
+
     // Compare encoded data with RLE, when huffman increased size, use RLE only
     this->CompareWithRLE(buffer, size, settings);
 }
@@ -461,4 +499,29 @@ uint64_t HuffmanCoder::GetSize() {
     }
   
     return (this->byte_index + 1);
-}
\ No newline at end of file
+}
+
+/**
+ * Return depth of the deepest leaf below given node
+ * @param[in] node Node from which depth is measured
+ * @returns Number of edges to the deepest leaf
+ * */
+uint32_t HuffmanCoder::TreeDepth(Node *node) {
+    if (node->left == nullptr && node->right == nullptr)
+    {
+        return 0;
+    }
+
+    // Node always has both children, NYT node is the only leaf without value
+    return 1 + std::max(this->TreeDepth(node->left), this->TreeDepth(node->right));
+}
+
+/**
+ * Return counters of coded symbols and tree
+ * @returns Counters of coder
+ * */
+HuffmanStats HuffmanCoder::GetStats() {
+    HuffmanStats stats = this->stats;
+    stats.max_depth = this->TreeDepth(this->root);
+    return stats;
+}
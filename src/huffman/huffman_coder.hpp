@@ -12,6 +12,7 @@
 #include <algorithm> // cout
 
 #include "huffman.hpp"
+#include "../stats/alloc_counters.hpp"
 
 /**
  * Class that will encode data to huffman code
@@ -29,6 +30,9 @@ private:
   uint64_t byte_index;
   uint8_t bit_index;
 
+  // Counters reported by --stats
+  HuffmanStats stats;
+
   /**
    * When about 20 bytes are remaining of buffer, increase buffer
    * */
@@ -85,6 +89,12 @@ private:
    * */
   Node* FindHighestBlockNode(Node *node);
 
+  /**
+   * Update weights of nodes from given node up to the root, swapping nodes to keep sibling property
+   * @param[in] node Node whose weight is incremented first
+   * */
+  void UpdateTree(Node *node);
+
   /**
    * Swap position of two nodes with its children
    * @param[in] node1 Node1 that will be swapped with node2
@@ -98,6 +108,13 @@ private:
    * */
   void FreeNode(Node *node);
 
+  /**
+   * Return depth of the deepest leaf below given node
+   * @param[in] node Node from which depth is measured
+   * @returns Number of edges to the deepest leaf
+   * */
+  uint32_t TreeDepth(Node *node);
+
   /**
    * Compare if compressed data are lower than RLE, when not copy RLE back to buffer, and add
    * settings that will tell us if data are huffman or RLE
@@ -115,6 +132,13 @@ public:
    * */
   ~HuffmanCoder();
 
+  /**
+   * Update tree with given symbols without writing any bits, decoder needs to be trained with the same symbols
+   * @param[in] buffer Buffer containing training symbols
+   * @param[in] size Size of buffer in bytes
+   * */
+  void Train(const uint8_t *buffer, const size_t &size);
+
   /**
    * Encode RLE data to huffman code
    * @param[in] buffer Buffer containing RLE data
@@ -133,6 +157,12 @@ public:
    * Return size of buffer based on bit index
    * */
   uint64_t GetSize();
+
+  /**
+   * Return counters of coded symbols and tree
+   * @returns Counters of coder
+   * */
+  HuffmanStats GetStats();
 };
 
 #endif
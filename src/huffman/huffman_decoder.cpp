@@ -20,6 +20,15 @@ HuffmanDecoder::HuffmanDecoder() {
     this->alloc = 0;
     this->buffer = nullptr;
 
+    // Allocate memory for 256 possible values of leaf nodes
+    this->leaf_nodes = (Node **)malloc(sizeof(Node *) * N_VALUES);
+
+    // Set each to nullptr
+    for (uint16_t i = 0; i < N_VALUES; i++)
+    {
+        this->leaf_nodes[i] = nullptr;
+    }
+
     // Initialize starting node of the tree
     this->InitTree();
 }
@@ -34,6 +43,12 @@ HuffmanDecoder::~HuffmanDecoder() {
         free(this->buffer);
     }
 
+    // When array of leaf pointers was allocated, free him
+    if (this->leaf_nodes)
+    {
+        free(this->leaf_nodes);
+    }
+
     // When tree was allocated, free tree recursively
     if (this->root)
     {
@@ -47,29 +62,47 @@ HuffmanDecoder::~HuffmanDecoder() {
 void HuffmanDecoder::ReallocateBuffer() {
     // When about 20 bytes are left, expand buffer
     if (this->alloc <= (this->write_byte_index + 20)) {
-        // Allocate new buffer
-        uint8_t *tmp = (uint8_t *)malloc(sizeof(uint8_t) * (this->alloc + ALLOC_SIZE));
-
-        // Clear buffer
-        memset(tmp, 0, (this->alloc + ALLOC_SIZE));
+        // Double size of buffer, so decoding of unknown size copies every byte only few times
+        this->Reserve(std::max<uint64_t>(2 * this->alloc, this->alloc + ALLOC_SIZE));
+    }
+}
 
-        // When buffer was allocated, copy data to tmp buffer and free buffer
-        if (this->buffer != nullptr)
-        {
-            // Copy data to buffer
-            memcpy(tmp, this->buffer, this->write_byte_index);
-            free(this->buffer);
-        }
+/**
+ * Allocate buffer for given number of decoded bytes, so it does not need to be increased while decoding
+ * @param[in] size Expected number of decoded bytes
+ * */
+void HuffmanDecoder::Reserve(const uint64_t &size) {
+    // Keep the same space after last byte, as when buffer is increased
+    const uint64_t alloc = size + 21;
+    if (alloc <= this->alloc) {
+        return;
+    }
 
-        // Increase allocation size
-        this->alloc += ALLOC_SIZE;
+    // Allocate new buffer
+    uint8_t *tmp = (uint8_t *)malloc(sizeof(uint8_t) * alloc);
 
-        // Set buffer
-        this->buffer = tmp;
+    // Invalid allocation
+    assert(tmp != nullptr);
 
-        // Clear pointer to allocated memory
-        tmp = nullptr;
+    // When buffer was allocated, copy data to tmp buffer and free buffer
+    if (this->buffer != nullptr)
+    {
+        // Copy data to buffer
+        memcpy(tmp, this->buffer, this->write_byte_index);
+        free(this->buffer);
+        AllocCounters::Reallocation(this->write_byte_index);
+    }
+    else
+    {
+        AllocCounters::Allocation();
     }
+
+    // Clear rest of buffer
+    memset(&tmp[this->write_byte_index], 0, (alloc - this->write_byte_index));
+
+    // Set buffer and allocation size
+    this->buffer = tmp;
+    this->alloc = alloc;
 }
 
 /**
@@ -162,7 +195,10 @@ bool HuffmanDecoder::NextBit(uint8_t * &buffer, const uint64_t &size, bool &end_
  * @returns True when we reached padding bits, false otherwise
  * */
 bool HuffmanDecoder::IsEnd(const uint64_t &size, const uint8_t &padding_bits) {
-    return ((this->read_bit_index + padding_bits) == 9 && (size == (this->read_byte_index + 1)));
+    // End is one bit after last valid bit, so symbol of last valid bit is still added to buffer
+    // With one padding bit this position is at the start of byte after the last one
+    const uint64_t read_bits = (this->read_byte_index * BITS_IN_BYTE) + this->read_bit_index;
+    return (read_bits == ((size * BITS_IN_BYTE) - padding_bits + 1));
 }
 
 /**
@@ -205,14 +241,14 @@ Node* HuffmanDecoder::GenNode() {
  * @returns Return pointer to the old NYT node
  * */
 Node* HuffmanDecoder::AddSymbol(const uint8_t & symbol) {
-    // Add symbol to buffer
-    this->AddSymbolToBuffer(symbol);
-
     // Create new value node
     this->NYT->right = GenNode();
     this->NYT->right->val = symbol;
     this->NYT->right->index = (this->NYT->index - 1);
 
+    // Add value to search index
+    this->leaf_nodes[symbol] = this->NYT->right;
+
     // Create new NYT node
     this->NYT->left = GenNode();
     this->NYT->left->index = (this->NYT->index - 2);
@@ -245,7 +281,7 @@ Node* HuffmanDecoder::FindHighestBlockNode(Node *node) {
     uint64_t i = 0;
 
     // Insert root and start searching from root
-    queue.push_back(this->root);
+    AllocCounters::PushBack(queue, this->root, ALLOC_QUEUE);
 
     // Traverse tree, until we went through all the nodes
     while (i < queue.size()) {
@@ -260,12 +296,12 @@ Node* HuffmanDecoder::FindHighestBlockNode(Node *node) {
 
         // When right node exist, add it to the queue
         if (tmp->right != nullptr) {
-            queue.push_back(tmp->right);
+            AllocCounters::PushBack(queue, tmp->right, ALLOC_QUEUE);
         }
 
         // When left node value exist, add it to the queue
         if (tmp->left != nullptr) {
-            queue.push_back(tmp->left);
+            AllocCounters::PushBack(queue, tmp->left, ALLOC_QUEUE);
         }
         
         // Increment queue index
@@ -359,13 +395,58 @@ void HuffmanDecoder::FreeNode(Node *node) {
     }
 }
 
+/**
+ * Update weights of nodes from given node up to the root, swapping nodes to keep sibling property
+ * @param[in] node Node whose weight is incremented first
+ * */
+void HuffmanDecoder::UpdateTree(Node *node) {
+    while (true) {
+        // Get node of highest index with the same weight, when no is found, we will return node
+        Node *highest_node = this->FindHighestBlockNode(node);
+
+        // Swap with highest numbered block
+        if (highest_node != node && highest_node != node->parent) {
+            this->SwapNodes(highest_node, node);
+        }
+
+        // Increment weight
+        node->weight++;
+
+        // When we reached root node, stop updating tree
+        if (this->root == node) {
+            break;
+        }
+
+        // Move to parent
+        node = node->parent;
+    }
+}
+
+/**
+ * Update tree with given symbols without decoding any bits, coder needs to be trained with the same symbols
+ * @param[in] buffer Buffer containing training symbols
+ * @param[in] size Size of buffer in bytes
+ * */
+void HuffmanDecoder::Train(const uint8_t *buffer, const size_t &size) {
+    for (size_t i = 0; i < size; i++) {
+        // First appearance of symbol, add it after NYT node
+        Node *node = this->leaf_nodes[buffer[i]];
+        if (node == nullptr) {
+            node = this->AddSymbol(buffer[i]);
+        }
+
+        this->UpdateTree(node);
+    }
+}
+
 /**
  * Decode huffman encoded data
+ * @param[in] settings Settings byte, saved before encoded data
  * @param[in] buffer Buffer containing huffman encoded values
  * @param[in] size Size of data in buffer
  * @returns True when decode was successfull, false otherwise
  * */
-bool HuffmanDecoder::Decode(uint8_t * & buffer, const uint64_t &size) {
+bool HuffmanDecoder::Decode(const uint8_t &settings, uint8_t * & buffer, const uint64_t &size) {
     // Start node pointer at root
     Node *node = this->root;
     
@@ -378,22 +459,26 @@ bool HuffmanDecoder::Decode(uint8_t * & buffer, const uint64_t &size) {
     // Number of padding bits in data
     uint8_t padding_bits;
 
-    // First value of buffer are settings
+    // Settings byte
     // first 3 bits represent number of padding bits
     // When 4th bit is set, we are using huffman, otherwise we are copying buffer to output
-    if (size > 1 && (buffer[0] & SETTINGS_BIT_CHECK)) {
-        padding_bits = (buffer[0] & PADDING_BITS_MASK);
-        this->read_byte_index++;
+    if (size > 0 && (settings & SETTINGS_BIT_CHECK)) {
+        padding_bits = (settings & PADDING_BITS_MASK);
     // Data are encoded using only RLE, copy buffer
     } else {
+        // Free buffer reserved for decoded data
+        if (this->buffer != nullptr) {
+            free(this->buffer);
+        }
+
         // Allocate buffer
-        this->buffer = (uint8_t *)malloc(sizeof(uint8_t) * (size - 1));
+        this->buffer = (uint8_t *)malloc(sizeof(uint8_t) * (size + 1));
 
         // Copy data to buffer
-        memcpy(this->buffer, &buffer[1], (size - 1));
+        memcpy(this->buffer, buffer, size);
 
         // Set resulting size
-        this->write_byte_index = (size - 1);
+        this->write_byte_index = size;
         return true;
     }
     
@@ -453,33 +538,16 @@ bool HuffmanDecoder::Decode(uint8_t * & buffer, const uint64_t &size) {
             }
 
             // Add symbol to buffer and to tree
+            this->AddSymbolToBuffer(symbol);
             node = this->AddSymbol(symbol);
         // Not NYT, Add value from node to buffer
         } else {
             this->AddSymbolToBuffer(node->val);
         }
 
-        // Update tree
-        while (true) {
-            // Get node of highest index with the same weight, when no is found, we will return node
-            Node *highest_node = this->FindHighestBlockNode(node);
-
-            // Swap with highest numbered block
-            if (highest_node != node && highest_node != node->parent) {
-                this->SwapNodes(highest_node, node);
-            }
-            
-            // Increment weight
-            node->weight++;
-
-            // When we reached root node, stop updating tree
-            if (this->root == node) {
-                break;
-            }
-
-            // Move to parent
-            node = node->parent;
-        }
+        // Update tree and continue decoding from root
+        this->UpdateTree(node);
+        node = this->root;
     }
 
     return true;
@@ -9,6 +9,7 @@
 #define __HUFFMAN__DECODER__
 
 #include "huffman.hpp"
+#include "../stats/alloc_counters.hpp"
 
 /**
  * Class that will decode huffman encoded data
@@ -27,6 +28,7 @@ private:
   // Tree pointers
   Node *root;
   Node *NYT;
+  Node **leaf_nodes;
 
   /**
    * When about 20 bytes are remaining of buffer, increase buffer
@@ -96,6 +98,12 @@ private:
    * */
   bool IsExternalNode(Node *node);
 
+  /**
+   * Update weights of nodes from given node up to the root, swapping nodes to keep sibling property
+   * @param[in] node Node whose weight is incremented first
+   * */
+  void UpdateTree(Node *node);
+
   /**
    * Swap position of two nodes with its children
    * @param[in] node1 Node1 that will be swapped with node2
@@ -120,13 +128,27 @@ public:
    * */
   ~HuffmanDecoder();
 
+  /**
+   * Update tree with given symbols without decoding any bits, coder needs to be trained with the same symbols
+   * @param[in] buffer Buffer containing training symbols
+   * @param[in] size Size of buffer in bytes
+   * */
+  void Train(const uint8_t *buffer, const size_t &size);
+
+  /**
+   * Allocate buffer for given number of decoded bytes, so it does not need to be increased while decoding
+   * @param[in] size Expected number of decoded bytes
+   * */
+  void Reserve(const uint64_t &size);
+
   /**
    * Decode huffman encoded data
+   * @param[in] settings Settings byte, saved before encoded data
    * @param[in] buffer Buffer containing huffman encoded values
    * @param[in] size Size of data in buffer
    * @returns True when decode was successfull, false otherwise
    * */
-  bool Decode(uint8_t * & buffer, const uint64_t &size);
+  bool Decode(const uint8_t &settings, uint8_t * & buffer, const uint64_t &size);
 
   /**
    * Return pointer to compressed data buffer
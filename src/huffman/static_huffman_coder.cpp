@@ -0,0 +1,246 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: static_huffman_coder.cpp
+ * Description: Contains implementations of class StaticHuffmanCoder, that is used to encode
+ * data into static canonical huffman code, which is faster than adaptive huffman code
+ * */
+#include "static_huffman_coder.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor that will initialize values
+ * */
+StaticHuffmanCoder::StaticHuffmanCoder() {
+  this->buffer = nullptr;
+  this->size = 0;
+  this->stats = {0, 0, 0, 0, 0};
+  memset(this->lengths, 0, sizeof(this->lengths));
+  memset(this->codes, 0, sizeof(this->codes));
+}
+
+/**
+ * Deconstructor that will free allocated values
+ * */
+StaticHuffmanCoder::~StaticHuffmanCoder() {
+  if (this->buffer) {
+    free(this->buffer);
+  }
+}
+
+/**
+ * Compute huffman code lengths from counts of values
+ * @param[in] counts Number of occurences of each value
+ * @param[out] lengths Code length of each value, 0 for values that are not in data
+ * */
+void StaticHuffmanCoder::BuildLengths(const uint64_t *counts, uint8_t *lengths) {
+  // Leaves are first N_VALUES nodes, inner nodes are added after them, so parent has always higher index
+  std::vector<int32_t> parents(2 * N_VALUES, -1);
+  std::priority_queue<std::pair<uint64_t, int32_t>, std::vector<std::pair<uint64_t, int32_t>>, std::greater<>> queue;
+  for (uint16_t i = 0; i < N_VALUES; i++) {
+    if (counts[i] > 0) {
+      queue.push({counts[i], i});
+    }
+  }
+
+  // Only one value, it still needs one bit long code
+  if (queue.size() == 1) {
+    lengths[queue.top().second] = 1;
+    return;
+  }
+
+  // Merge two lightest nodes, until only root is left
+  int32_t next_node = N_VALUES;
+  while (queue.size() > 1) {
+    const std::pair<uint64_t, int32_t> first = queue.top();
+    queue.pop();
+    const std::pair<uint64_t, int32_t> second = queue.top();
+    queue.pop();
+
+    parents[first.second] = next_node;
+    parents[second.second] = next_node;
+    queue.push({first.first + second.first, next_node++});
+  }
+
+  // Depth of inner nodes from root down, length of code is depth of leaf
+  std::vector<uint8_t> depths(next_node, 0);
+  for (int32_t i = (next_node - 2); i >= N_VALUES; i--) {
+    depths[i] = depths[parents[i]] + 1;
+  }
+  for (uint16_t i = 0; i < N_VALUES; i++) {
+    if (counts[i] > 0) {
+      lengths[i] = depths[parents[i]] + 1;
+    }
+  }
+}
+
+/**
+ * Shorten codes longer than STATIC_HUFFMAN_MAX_LENGTH, codes of other rare values are made longer,
+ * so code is still prefix code
+ * @param[in] counts Number of occurences of each value
+ * @param[in,out] lengths Code length of each value
+ * */
+void StaticHuffmanCoder::LimitLengths(const uint64_t *counts, uint8_t *lengths) {
+  // Sum of 2^-length of all codes in units of 2^-STATIC_HUFFMAN_MAX_LENGTH, prefix code needs at most 1
+  constexpr uint32_t kraft_limit = (1 << STATIC_HUFFMAN_MAX_LENGTH);
+  uint32_t kraft = 0;
+  for (uint16_t i = 0; i < N_VALUES; i++) {
+    if (lengths[i] > STATIC_HUFFMAN_MAX_LENGTH) {
+      lengths[i] = STATIC_HUFFMAN_MAX_LENGTH;
+    }
+    if (lengths[i] > 0) {
+      kraft += (kraft_limit >> lengths[i]);
+    }
+  }
+
+  // Lengthen the longest code, that can be lengthened, of the rarest value, until sum fits
+  while (kraft > kraft_limit) {
+    int32_t selected = -1;
+    for (uint16_t i = 0; i < N_VALUES; i++) {
+      if (lengths[i] == 0 || lengths[i] >= STATIC_HUFFMAN_MAX_LENGTH) {
+        continue;
+      }
+      if (selected < 0 || lengths[i] > lengths[selected] ||
+        (lengths[i] == lengths[selected] && counts[i] < counts[selected]))
+      {
+        selected = i;
+      }
+    }
+
+    lengths[selected]++;
+    kraft -= (kraft_limit >> lengths[selected]);
+  }
+}
+
+/**
+ * Assign canonical codes to values from their code lengths, shorter codes first and codes of
+ * the same length in order of values
+ * @param[in] lengths Code length of each value, 0 for values without code
+ * @param[out] codes Code of each value
+ * */
+void StaticHuffmanCoder::AssignCodes(const uint8_t *lengths, uint16_t *codes) {
+  // Number of codes of each length
+  uint16_t length_counts[STATIC_HUFFMAN_MAX_LENGTH + 1] = {0};
+  for (uint16_t i = 0; i < N_VALUES; i++) {
+    length_counts[lengths[i]]++;
+  }
+  length_counts[0] = 0;
+
+  // First code of each length
+  uint16_t next_codes[STATIC_HUFFMAN_MAX_LENGTH + 1] = {0};
+  uint16_t code = 0;
+  for (uint8_t length = 1; length <= STATIC_HUFFMAN_MAX_LENGTH; length++) {
+    code = (code + length_counts[length - 1]) << 1;
+    next_codes[length] = code;
+  }
+
+  for (uint16_t i = 0; i < N_VALUES; i++) {
+    codes[i] = (lengths[i] > 0) ? next_codes[lengths[i]]++ : 0;
+  }
+}
+
+/**
+ * Build canonical code with codes of at most STATIC_HUFFMAN_MAX_LENGTH bits from counts of values
+ * @param[in] counts Number of occurences of each value, at least one value needs to occur
+ * @param[out] lengths Code length of each value, 0 for values that are not in data
+ * @param[out] codes Code of each value
+ * */
+void StaticHuffmanCoder::BuildCode(const uint64_t *counts, uint8_t *lengths, uint16_t *codes) {
+  memset(lengths, 0, sizeof(uint8_t) * N_VALUES);
+  StaticHuffmanCoder::BuildLengths(counts, lengths);
+  StaticHuffmanCoder::LimitLengths(counts, lengths);
+  StaticHuffmanCoder::AssignCodes(lengths, codes);
+}
+
+/**
+ * Encode RLE data to static huffman code, when it does not reduce size data are copied
+ * @param[in] buffer Buffer containing RLE data
+ * @param[in] size Size of buffer in bytes
+ * @param[out] settings Byte containing metadata
+ * */
+void StaticHuffmanCoder::Encode(const uint8_t *buffer, const size_t &size, uint8_t &settings) {
+  settings = 0;
+
+  // Count values in first pass
+  uint64_t counts[N_VALUES] = {0};
+  for (size_t i = 0; i < size; i++) {
+    counts[buffer[i]]++;
+  }
+  if (size > 0) {
+    StaticHuffmanCoder::BuildCode(counts, this->lengths, this->codes);
+  }
+
+  // Length of codes is known from counts before coding
+  this->stats = {size, 0, 0, 0, 0};
+  for (uint16_t i = 0; i < N_VALUES; i++) {
+    this->stats.max_depth = std::max<uint32_t>(this->stats.max_depth, this->lengths[i]);
+    this->stats.code_bits += counts[i] * this->lengths[i];
+  }
+
+  // Codes have at most STATIC_HUFFMAN_MAX_LENGTH bits
+  if (this->buffer) {
+    free(this->buffer);
+  }
+  const uint64_t alloc = STATIC_HUFFMAN_HEADER_SIZE + (static_cast<uint64_t>(size) * STATIC_HUFFMAN_MAX_LENGTH + 7) / 8 + 1;
+  this->buffer = (uint8_t *)malloc(sizeof(uint8_t) * std::max<uint64_t>(alloc, size + 1));
+  assert(this->buffer != nullptr);
+  this->size = 0;
+
+  // Header with code lengths, two lengths in each byte, and number of symbols
+  for (uint16_t i = 0; i < N_VALUES; i += 2) {
+    this->buffer[this->size++] = (this->lengths[i] << 4) | this->lengths[i + 1];
+  }
+  ByteIo::AppendValue(this->buffer, this->size, size, STATIC_HUFFMAN_COUNT_BYTES);
+
+  // Codes are written from the most significant bit, whole bytes are moved from accumulator
+  uint64_t accumulator = 0;
+  uint8_t bits = 0;
+  for (size_t i = 0; i < size; i++) {
+    accumulator = (accumulator << this->lengths[buffer[i]]) | this->codes[buffer[i]];
+    bits += this->lengths[buffer[i]];
+    while (bits >= BITS_IN_BYTE) {
+      bits -= BITS_IN_BYTE;
+      this->buffer[this->size++] = static_cast<uint8_t>(accumulator >> bits);
+    }
+  }
+  if (bits > 0) {
+    this->buffer[this->size++] = static_cast<uint8_t>(accumulator << (BITS_IN_BYTE - bits));
+  }
+
+  // When huffman increased size, copy RLE back into buffer
+  if (size == 0 || this->size > size) {
+    if (size > 0) {
+      memcpy(this->buffer, buffer, size);
+    }
+    this->size = size;
+    return;
+  }
+
+  // Otherwise, calculate padding bits and set setting bits
+  settings = ((bits == 0) ? 0 : (BITS_IN_BYTE - bits));
+  settings |= (SETTINGS_BIT_CHECK | STATIC_HUFFMAN_SETTINGS_BIT);
+}
+
+/**
+ * Return pointer to encoded data buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & StaticHuffmanCoder::GetBuffer() {
+  return this->buffer;
+}
+
+/**
+ * Return size of encoded data
+ * @returns Size of buffer
+ * */
+uint64_t StaticHuffmanCoder::GetSize() {
+  return this->size;
+}
+
+/**
+ * Return counters of coded symbols and code, static code has no NYT codes and swaps
+ * @returns Counters of coder
+ * */
+HuffmanStats StaticHuffmanCoder::GetStats() {
+  return this->stats;
+}
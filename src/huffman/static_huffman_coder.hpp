@@ -0,0 +1,103 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: static_huffman_coder.hpp
+ * Description: Contains definitions of class StaticHuffmanCoder, that is used to encode
+ * data into static canonical huffman code, which is faster than adaptive huffman code
+ * */
+#ifndef __STATIC_HUFFMAN_CODER__
+#define __STATIC_HUFFMAN_CODER__
+
+#include <queue>      // priority_queue
+#include <functional> // greater
+#include <utility>    // pair
+
+#include "huffman.hpp"
+
+/**
+ * Class that will encode data to static canonical huffman code, code lengths are computed from
+ * counts of all symbols in first pass and saved before data, so decoder builds the same code
+ * */
+class StaticHuffmanCoder {
+private:
+  // Encoded data with header
+  uint8_t *buffer;
+  uint64_t size;
+
+  // Code length and canonical code of each value, 0 length for values that are not in data
+  uint8_t lengths[N_VALUES];
+  uint16_t codes[N_VALUES];
+
+  // Counters reported by --stats
+  HuffmanStats stats;
+
+  /**
+   * Compute huffman code lengths from counts of values
+   * @param[in] counts Number of occurences of each value
+   * @param[out] lengths Code length of each value, 0 for values that are not in data
+   * */
+  static void BuildLengths(const uint64_t *counts, uint8_t *lengths);
+
+  /**
+   * Shorten codes longer than STATIC_HUFFMAN_MAX_LENGTH, codes of other rare values are made longer,
+   * so code is still prefix code
+   * @param[in] counts Number of occurences of each value
+   * @param[in,out] lengths Code length of each value
+   * */
+  static void LimitLengths(const uint64_t *counts, uint8_t *lengths);
+
+public:
+  /**
+   * Constructor that will initialize values
+   * */
+  StaticHuffmanCoder();
+
+  /**
+   * Deconstructor that will free allocated values
+   * */
+  ~StaticHuffmanCoder();
+
+  /**
+   * Assign canonical codes to values from their code lengths, shorter codes first and codes of
+   * the same length in order of values
+   * @param[in] lengths Code length of each value, 0 for values without code
+   * @param[out] codes Code of each value
+   * */
+  static void AssignCodes(const uint8_t *lengths, uint16_t *codes);
+
+  /**
+   * Build canonical code with codes of at most STATIC_HUFFMAN_MAX_LENGTH bits from counts of values
+   * @param[in] counts Number of occurences of each value, at least one value needs to occur
+   * @param[out] lengths Code length of each value, 0 for values that are not in data
+   * @param[out] codes Code of each value
+   * */
+  static void BuildCode(const uint64_t *counts, uint8_t *lengths, uint16_t *codes);
+
+  /**
+   * Encode RLE data to static huffman code, when it does not reduce size data are copied
+   * @param[in] buffer Buffer containing RLE data
+   * @param[in] size Size of buffer in bytes
+   * @param[out] settings Byte containing metadata
+   * */
+  void Encode(const uint8_t *buffer, const size_t &size, uint8_t &settings);
+
+  /**
+   * Return pointer to encoded data buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return size of encoded data
+   * @returns Size of buffer
+   * */
+  uint64_t GetSize();
+
+  /**
+   * Return counters of coded symbols and code, static code has no NYT codes and swaps
+   * @returns Counters of coder
+   * */
+  HuffmanStats GetStats();
+};
+
+#endif
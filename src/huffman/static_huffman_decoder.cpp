@@ -0,0 +1,156 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: static_huffman_decoder.cpp
+ * Description: Contains implementations of class StaticHuffmanDecoder, that is used to decode
+ * data coded by static canonical huffman code
+ * */
+#include "static_huffman_decoder.hpp"
+
+/**
+ * Constructor that will initialize values
+ * */
+StaticHuffmanDecoder::StaticHuffmanDecoder() {
+  this->buffer = nullptr;
+  this->size = 0;
+  memset(this->table, 0, sizeof(this->table));
+}
+
+/**
+ * Deconstructor that will free allocated values
+ * */
+StaticHuffmanDecoder::~StaticHuffmanDecoder() {
+  if (this->buffer) {
+    free(this->buffer);
+  }
+}
+
+/**
+ * Read code lengths from header and fill lookup table
+ * @param[in] data Header with code lengths
+ * @returns True when code lengths form prefix code, false otherwise
+ * */
+bool StaticHuffmanDecoder::BuildTable(const uint8_t *data) {
+  uint8_t lengths[N_VALUES];
+  for (uint16_t i = 0; i < N_VALUES; i += 2) {
+    lengths[i] = (data[i / 2] >> 4);
+    lengths[i + 1] = (data[i / 2] & 0x0F);
+  }
+  return StaticHuffmanDecoder::BuildTable(lengths, this->table);
+}
+
+/**
+ * Fill lookup table of canonical code from code lengths
+ * @param[in] lengths Code length of each value, 0 for values without code
+ * @param[out] table Value and code length for each possible next STATIC_HUFFMAN_MAX_LENGTH bits
+ * @returns True when code lengths form prefix code, false otherwise
+ * */
+bool StaticHuffmanDecoder::BuildTable(const uint8_t *lengths, uint16_t *table) {
+  uint32_t kraft = 0;
+  for (uint16_t i = 0; i < N_VALUES; i++) {
+    if (lengths[i] > STATIC_HUFFMAN_MAX_LENGTH) {
+      return false;
+    }
+    if (lengths[i] > 0) {
+      kraft += ((1 << STATIC_HUFFMAN_MAX_LENGTH) >> lengths[i]);
+    }
+  }
+
+  // Codes would overlap
+  if (kraft > (1 << STATIC_HUFFMAN_MAX_LENGTH)) {
+    return false;
+  }
+
+  // Every bit sequence starting with code points to its value, entries without code stay 0
+  uint16_t codes[N_VALUES];
+  StaticHuffmanCoder::AssignCodes(lengths, codes);
+  memset(table, 0, sizeof(uint16_t) << STATIC_HUFFMAN_MAX_LENGTH);
+  for (uint16_t i = 0; i < N_VALUES; i++) {
+    if (lengths[i] == 0) {
+      continue;
+    }
+    const uint8_t free_bits = STATIC_HUFFMAN_MAX_LENGTH - lengths[i];
+    const uint32_t first = (static_cast<uint32_t>(codes[i]) << free_bits);
+    for (uint32_t j = 0; j < (1U << free_bits); j++) {
+      table[first + j] = (i << 4) | lengths[i];
+    }
+  }
+  return true;
+}
+
+/**
+ * Decode static huffman code
+ * @param[in] settings Settings byte with number of padding bits
+ * @param[in] data Header with code lengths followed by encoded data
+ * @param[in] size Size of data
+ * @returns True when data were decoded, false otherwise
+ * */
+bool StaticHuffmanDecoder::Decode(const uint8_t &settings, const uint8_t *data, const uint64_t &size) {
+  if (size < STATIC_HUFFMAN_HEADER_SIZE || !this->BuildTable(data)) {
+    std::cerr << "Invalid header of static huffman code" << std::endl;
+    return false;
+  }
+
+  // Number of symbols, every symbol has at least one bit
+  uint64_t count = 0;
+  for (uint8_t i = 0; i < STATIC_HUFFMAN_COUNT_BYTES; i++) {
+    count = (count << 8) | data[N_VALUES / 2 + i];
+  }
+  const uint64_t data_size = size - STATIC_HUFFMAN_HEADER_SIZE;
+  const uint64_t bits_available = data_size * BITS_IN_BYTE;
+  const uint8_t padding_bits = (settings & PADDING_BITS_MASK);
+  if (bits_available < padding_bits || count > (bits_available - padding_bits)) {
+    std::cerr << "Number of symbols does not match size of static huffman code" << std::endl;
+    return false;
+  }
+
+  if (this->buffer) {
+    free(this->buffer);
+  }
+  this->buffer = (uint8_t *)malloc(sizeof(uint8_t) * (count + 1));
+  assert(this->buffer != nullptr);
+  this->size = 0;
+
+  // Bits are read from the most significant bit, accumulator is refilled by whole bytes
+  const uint8_t *encoded = &data[STATIC_HUFFMAN_HEADER_SIZE];
+  uint64_t read_index = 0;
+  uint64_t accumulator = 0;
+  uint8_t bits = 0;
+  while (this->size < count) {
+    while (bits <= 56 && read_index < data_size) {
+      accumulator = (accumulator << BITS_IN_BYTE) | encoded[read_index++];
+      bits += BITS_IN_BYTE;
+    }
+
+    // At the end of data, missing bits are read as zeros
+    const uint16_t peek = (bits >= STATIC_HUFFMAN_MAX_LENGTH)
+      ? ((accumulator >> (bits - STATIC_HUFFMAN_MAX_LENGTH)) & ((1 << STATIC_HUFFMAN_MAX_LENGTH) - 1))
+      : ((accumulator << (STATIC_HUFFMAN_MAX_LENGTH - bits)) & ((1 << STATIC_HUFFMAN_MAX_LENGTH) - 1));
+    const uint16_t entry = this->table[peek];
+    const uint8_t length = (entry & 0x0F);
+    if (length == 0 || length > bits) {
+      std::cerr << "Invalid code in static huffman code" << std::endl;
+      return false;
+    }
+
+    this->buffer[this->size++] = static_cast<uint8_t>(entry >> 4);
+    bits -= length;
+  }
+  return true;
+}
+
+/**
+ * Return pointer to decoded data
+ * @returns Pointer to buffer
+ * */
+uint8_t * & StaticHuffmanDecoder::GetBuffer() {
+  return this->buffer;
+}
+
+/**
+ * Return size of decoded data
+ * @returns Size of buffer
+ * */
+uint64_t StaticHuffmanDecoder::GetSize() {
+  return this->size;
+}
@@ -0,0 +1,75 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: static_huffman_decoder.hpp
+ * Description: Contains definitions of class StaticHuffmanDecoder, that is used to decode
+ * data coded by static canonical huffman code
+ * */
+#ifndef __STATIC_HUFFMAN_DECODER__
+#define __STATIC_HUFFMAN_DECODER__
+
+#include "huffman.hpp"
+#include "static_huffman_coder.hpp"
+
+/**
+ * Class that will decode static canonical huffman code, each symbol is decoded by one lookup
+ * of next STATIC_HUFFMAN_MAX_LENGTH bits into table
+ * */
+class StaticHuffmanDecoder {
+private:
+  // Decoded data
+  uint8_t *buffer;
+  uint64_t size;
+
+  // Value and code length for each possible next STATIC_HUFFMAN_MAX_LENGTH bits, value is in upper bits
+  uint16_t table[1 << STATIC_HUFFMAN_MAX_LENGTH];
+
+  /**
+   * Read code lengths from header and fill lookup table
+   * @param[in] data Header with code lengths
+   * @returns True when code lengths form prefix code, false otherwise
+   * */
+  bool BuildTable(const uint8_t *data);
+
+public:
+  /**
+   * Fill lookup table of canonical code from code lengths
+   * @param[in] lengths Code length of each value, 0 for values without code
+   * @param[out] table Value and code length for each possible next STATIC_HUFFMAN_MAX_LENGTH bits
+   * @returns True when code lengths form prefix code, false otherwise
+   * */
+  static bool BuildTable(const uint8_t *lengths, uint16_t *table);
+
+  /**
+   * Constructor that will initialize values
+   * */
+  StaticHuffmanDecoder();
+
+  /**
+   * Deconstructor that will free allocated values
+   * */
+  ~StaticHuffmanDecoder();
+
+  /**
+   * Decode static huffman code
+   * @param[in] settings Settings byte with number of padding bits
+   * @param[in] data Header with code lengths followed by encoded data
+   * @param[in] size Size of data
+   * @returns True when data were decoded, false otherwise
+   * */
+  bool Decode(const uint8_t &settings, const uint8_t *data, const uint64_t &size);
+
+  /**
+   * Return pointer to decoded data
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return size of decoded data
+   * @returns Size of buffer
+   * */
+  uint64_t GetSize();
+};
+
+#endif
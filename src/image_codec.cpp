@@ -0,0 +1,493 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: image_codec.cpp
+ * Description: Contains implementations of ImageCodec class, that is used to run whole
+ * compression or decompression pipeline of one image in memory
+ * */
+#include "image_codec.hpp"
+
+/**
+ * Constructor for initialization of class variables
+ * */
+ImageCodec::ImageCodec() {
+  this->buffer = nullptr;
+  this->buff_size = 0;
+  this->stage_settings = 0;
+  this->input_preprocessing = false;
+  this->max_error = 0;
+  this->static_huffman = false;
+  this->width = 0;
+  this->height = 0;
+  this->rle_size = 0;
+  this->raw_pixels = nullptr;
+  this->stats = nullptr;
+  this->stage_bytes_in = 0;
+}
+
+/**
+ * Free all resources before destroying object
+ * */
+ImageCodec::~ImageCodec() {
+  if (this->buffer) {
+    free(this->buffer);
+  }
+}
+
+/**
+ * Replace buffer with copy of given data, with header before them
+ * @param[in] header Bytes to be saved before data
+ * @param[in] data Data to be copied
+ * @param[in] size Size of data
+ * */
+void ImageCodec::SetBuffer(const std::vector<uint8_t> &header, const uint8_t *data, const uint64_t &size) {
+  // Free previous result
+  if (this->buffer) {
+    free(this->buffer);
+  }
+
+  this->buff_size = header.size() + size;
+  this->buffer = (uint8_t *)malloc(sizeof(uint8_t) * (this->buff_size + 1));
+
+  // Invalid allocation
+  assert(this->buffer != nullptr);
+
+  // Copy header and data after it
+  if (!header.empty()) {
+    memcpy(this->buffer, header.data(), header.size());
+  }
+  if (size > 0) {
+    memcpy(&this->buffer[header.size()], data, size);
+  }
+}
+
+/**
+ * Start measuring of stage, for stats when they are set, otherwise as span of trace
+ * @param[in] name Name of stage
+ * @param[in] bytes_in Number of bytes given to stage
+ * */
+void ImageCodec::StartStage(const std::string &name, const uint64_t &bytes_in) {
+  if (this->stats != nullptr) {
+    this->stats->StartStage(name, bytes_in);
+  } else if (TraceRecorder::IsEnabled()) {
+    this->stage_name = name;
+    this->stage_bytes_in = bytes_in;
+    this->stage_start = std::chrono::steady_clock::now();
+  }
+}
+
+/**
+ * Stop measuring of stage started by the last StartStage
+ * @param[in] bytes_out Number of bytes produced by stage
+ * */
+void ImageCodec::EndStage(const uint64_t &bytes_out) {
+  if (this->stats != nullptr) {
+    this->stats->EndStage(bytes_out);
+  } else if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::AddSpan(this->stage_name, "stage", this->stage_start, std::chrono::steady_clock::now(),
+      {{"bytes_in", this->stage_bytes_in}, {"bytes_out", bytes_out}});
+  }
+}
+
+/**
+ * Run all stages before huffman coding, result are data for huffman without header
+ * @param[in] image Image data, that will not be modified
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * @param[in] settings Settings of compression pipeline
+ * @param[in] keep_image True to copy image, so it can be stored by Encode after it was freed, false when it stays valid until Encode
+ * */
+void ImageCodec::Transform(
+  const uint8_t *image,
+  const uint32_t &width,
+  const uint32_t &height,
+  const CodecSettings &settings,
+  const bool &keep_image
+) {
+  const size_t image_size = static_cast<size_t>(width) * height;
+
+  // Quantized residuals are always computed from prediction
+  const bool input_preprocessing = (settings.input_preprocessing || settings.max_error > 0);
+
+  // Preprocess copy of image, when argument -m or --max-error was set
+  uint8_t *preprocessed = nullptr;
+  if (input_preprocessing && image_size > 0) {
+    this->StartStage("preprocess", image_size);
+    preprocessed = (uint8_t *)malloc(sizeof(uint8_t) * image_size);
+    assert(preprocessed != nullptr);
+    memcpy(preprocessed, image, image_size);
+    DataWorker::Preprocess(preprocessed, image_size, settings.max_error);
+    this->EndStage(image_size);
+  }
+  const uint8_t *pixels = (preprocessed != nullptr) ? preprocessed : image;
+
+  // Initialize RLE compressor and quadtree compressor
+  RleCompressor rle_compressor(pixels, width, height);
+  QuadtreeCompressor quadtree_compressor(pixels, width, height);
+  this->StartStage(settings.quadtree_coding ? "quadtree" : "rle", image_size);
+
+  // When given argument -q, code uniform blocks with quadtree and rest of image with RLE
+  if (settings.quadtree_coding) {
+    quadtree_compressor.Compress(input_preprocessing);
+  // When given argument -a, do adaptive scanning
+  } else if (settings.adaptive_sequence_scanning) {
+    rle_compressor.AdaptiveScanning(width, height, input_preprocessing);
+  // Otherwise do normal horizontal scanning
+  } else {
+    rle_compressor.SequenceScanning(width, height, input_preprocessing);
+  }
+
+  // Data for BWT or huffman, either from quadtree or RLE
+  uint8_t *huffman_input = (settings.quadtree_coding) ? quadtree_compressor.GetBuffer() : rle_compressor.GetBuffer();
+  size_t huffman_input_size = (settings.quadtree_coding) ? quadtree_compressor.GetSize() : rle_compressor.GetSize();
+  this->EndStage(huffman_input_size);
+  if (this->stats != nullptr) {
+    this->stats->SetRuns(rle_compressor.GetRunCount());
+  }
+
+  // Initialize BWT encoder
+  BwtEncoder bwt_encoder(huffman_input, huffman_input_size);
+  this->rle_size = huffman_input_size;
+
+  // When given argument -b, transform RLE data with BWT and MTF
+  if (settings.bwt_transform) {
+    this->StartStage("bwt", huffman_input_size);
+    bwt_encoder.Encode(settings.bwt_block_size);
+    huffman_input = bwt_encoder.GetBuffer();
+    huffman_input_size = bwt_encoder.GetSize();
+    this->EndStage(huffman_input_size);
+  }
+
+  // Mark used stages, so decoder knows which stages to reverse
+  this->stage_settings = 0;
+  if (settings.bwt_transform) {
+    this->stage_settings |= BWT_SETTINGS_BIT;
+  }
+  if (settings.quadtree_coding) {
+    this->stage_settings |= QUADTREE_SETTINGS_BIT;
+  }
+  this->input_preprocessing = input_preprocessing;
+  this->max_error = settings.max_error;
+  this->static_huffman = settings.static_huffman;
+  this->width = width;
+  this->height = height;
+
+  // Save data for huffman
+  this->SetBuffer({}, huffman_input, huffman_input_size);
+
+  // Raw image is stored, when huffman does not reduce size below image size, image is copied
+  // only when it may be freed before Encode
+  this->raw_image.clear();
+  this->raw_pixels = image;
+  if (keep_image) {
+    this->raw_image.assign(image, image + image_size);
+    this->raw_pixels = this->raw_image.data();
+  }
+
+  if (preprocessed != nullptr) {
+    free(preprocessed);
+  }
+}
+
+/**
+ * Huffman code data from Transform, result is header followed by encoded data
+ * @param[in] model Symbols used to train huffman tree before coding, decoder needs the same symbols
+ * @param[in] versioned_header True to save versioned header before settings byte, containers save size of image themselves
+ * */
+void ImageCodec::Encode(const std::vector<uint8_t> &model, const bool &versioned_header) {
+  // Initialize huffman coder, trained by shared model when given
+  HuffmanCoder huffman_coder;
+  StaticHuffmanCoder static_huffman_coder;
+  uint8_t settings_byte = 0;
+  this->StartStage(this->static_huffman ? "static huffman" : "huffman", this->buff_size);
+
+  // Static huffman code is built from counts of values in one pass, without updating tree after each symbol
+  if (this->static_huffman) {
+    static_huffman_coder.Encode(this->buffer, this->buff_size, settings_byte);
+  } else {
+    huffman_coder.Train(model.data(), model.size());
+
+    // Do huffman encoding
+    // Huffman encoding, will compare RLE data length with huffman result length
+    // And when huffman is lower will return him
+    // Otherwise will return RLE and not use huffman
+    // Which will be saved in first byte, that will also contain number of padding bits
+    huffman_coder.Encode(this->buffer, this->buff_size, settings_byte);
+  }
+  uint8_t *encoded = this->static_huffman ? static_huffman_coder.GetBuffer() : huffman_coder.GetBuffer();
+  const uint64_t encoded_size = this->static_huffman ? static_huffman_coder.GetSize() : huffman_coder.GetSize();
+  this->EndStage(encoded_size);
+  if (this->stats != nullptr) {
+    this->stats->SetHuffman(this->static_huffman ? static_huffman_coder.GetStats() : huffman_coder.GetStats());
+  }
+
+  // Header starts with settings byte, with marked stages
+  std::vector<uint8_t> header = {static_cast<uint8_t>(settings_byte | this->stage_settings)};
+
+  // Mark quantized residuals in settings byte, and save maximum error after it
+  if (this->max_error > 0) {
+    header[0] |= NEAR_LOSSLESS_SETTINGS_BIT;
+    header.push_back(this->max_error);
+  }
+
+  // Stages in order in which decoder reverses them, with size of data each of them produces
+  const uint64_t image_size = static_cast<uint64_t>(this->width) * this->height;
+  ImageHeader image_header(this->width, this->height);
+  image_header.AddStage((settings_byte & STATIC_HUFFMAN_SETTINGS_BIT) ? STAGE_STATIC_HUFFMAN : STAGE_HUFFMAN, this->buff_size);
+  if (this->stage_settings & BWT_SETTINGS_BIT) {
+    image_header.AddStage(STAGE_BWT, this->rle_size);
+  }
+  image_header.AddStage((this->stage_settings & QUADTREE_SETTINGS_BIT) ? STAGE_QUADTREE : STAGE_RLE, image_size);
+  // Maximum error of prediction is 0 for lossless preprocessing
+  if (this->input_preprocessing) {
+    image_header.AddStage(STAGE_PREDICTION, image_size, {this->max_error});
+  }
+  ImageHeader stored_header(this->width, this->height);
+  stored_header.AddStage(STAGE_STORED, image_size);
+
+  // Versioned header is saved before settings byte
+  std::vector<uint8_t> full_header = versioned_header ? image_header.Write() : std::vector<uint8_t>();
+  std::vector<uint8_t> full_stored_header = versioned_header ? stored_header.Write() : std::vector<uint8_t>();
+
+  // Stages together with huffman did not reduce size, store raw image instead of encoded data
+  if ((full_header.size() + header.size() + encoded_size) > (full_stored_header.size() + 1 + image_size)) {
+    full_stored_header.push_back(STORED_SETTINGS_BIT);
+    this->SetBuffer(full_stored_header, this->raw_pixels, image_size);
+  // Save header and encoded data
+  } else {
+    full_header.insert(full_header.end(), header.begin(), header.end());
+    this->SetBuffer(full_header, encoded, encoded_size);
+  }
+
+  // Raw image is no longer needed
+  this->raw_image.clear();
+  this->raw_pixels = nullptr;
+}
+
+/**
+ * Compress image with given settings, result is header followed by encoded data
+ * @param[in] image Image data, that will not be modified
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * @param[in] settings Settings of compression pipeline
+ * @param[in] versioned_header True to save versioned header before settings byte, containers save size of image themselves
+ * */
+void ImageCodec::Compress(
+  const uint8_t *image,
+  const uint32_t &width,
+  const uint32_t &height,
+  const CodecSettings &settings,
+  const bool &versioned_header
+) {
+  this->Transform(image, width, height, settings, false);
+  this->Encode({}, versioned_header);
+}
+
+/**
+ * Decompress encoded data with header, result is image data, versioned header is optional
+ * @param[in] data Header followed by encoded data
+ * @param[in] size Size of data
+ * @param[in] model Symbols used to train huffman tree, the same as given to Encode
+ * @returns True when decompression was successfull, false otherwise
+ * */
+bool ImageCodec::Decompress(uint8_t *data, const uint64_t &size, const std::vector<uint8_t> &model) {
+  // Versioned header tells size of data of each stage, legacy data start right with settings byte
+  ImageHeader image_header;
+  if (IsContainer(data, size, CONTAINER_IMAGE)) {
+    if (!image_header.Read(data, size)) {
+      return false;
+    }
+    return this->Decompress(data + image_header.GetHeaderSize(), size - image_header.GetHeaderSize(), model, &image_header);
+  }
+  return this->Decompress(data, size, model, nullptr);
+}
+
+/**
+ * Decompress encoded data starting with settings byte, result is image data
+ * @param[in] data Settings byte followed by encoded data
+ * @param[in] size Size of data
+ * @param[in] model Symbols used to train huffman tree, the same as given to Encode
+ * @param[in] image_header Versioned header read before data, nullptr for legacy data
+ * @returns True when decompression was successfull, false otherwise
+ * */
+bool ImageCodec::Decompress(
+  uint8_t *data,
+  const uint64_t &size,
+  const std::vector<uint8_t> &model,
+  ImageHeader *image_header
+) {
+  // There needs to be at least settings byte
+  if (size == 0) {
+    std::cerr << "Missing settings byte" << std::endl;
+    return false;
+  }
+
+  // First byte of data are settings
+  const uint8_t settings = data[0];
+  this->max_error = 0;
+
+  // Raw image is stored after settings byte, padding bits are free when data are not huffman coded
+  if (!(settings & SETTINGS_BIT_CHECK) && (settings & STORED_SETTINGS_BIT)) {
+    this->SetBuffer({}, (data + 1), (size - 1));
+    return this->CheckStageSize(image_header, STAGE_STORED, this->buff_size);
+  }
+  size_t header_size = 1;
+  uint8_t max_error = 0;
+
+  // Residuals were quantized, maximum error follows settings byte
+  if (settings & NEAR_LOSSLESS_SETTINGS_BIT) {
+    if (size < 2) {
+      std::cerr << "Missing maximum error after settings byte" << std::endl;
+      return false;
+    }
+    max_error = data[header_size++];
+  }
+  this->max_error = max_error;
+
+  // Initialize huffman decoder, trained by shared model when given
+  HuffmanDecoder huffman_decoder;
+  StaticHuffmanDecoder static_huffman_decoder;
+  uint8_t *encoded_data = (data + header_size);
+  const bool static_huffman = ((settings & SETTINGS_BIT_CHECK) && (settings & STATIC_HUFFMAN_SETTINGS_BIT));
+
+  // Static huffman code saves number of symbols itself
+  this->StartStage(static_huffman ? "static huffman decode" : "huffman decode", size - header_size);
+  if (static_huffman) {
+    if (!static_huffman_decoder.Decode(settings, encoded_data, (size - header_size)) ||
+      !this->CheckStageSize(image_header, STAGE_STATIC_HUFFMAN, static_huffman_decoder.GetSize()))
+    {
+      return false;
+    }
+  } else {
+    huffman_decoder.Train(model.data(), model.size());
+
+    // Size of decoded data is known from versioned header, so buffer is allocated only once, untrusted size is bounded
+    // by the most symbols encoded data can hold and buffer grows normally beyond it
+    const StageDescriptor *huffman_stage = (image_header != nullptr) ? image_header->FindStage(STAGE_HUFFMAN) : nullptr;
+    if (huffman_stage != nullptr && (settings & SETTINGS_BIT_CHECK)) {
+      huffman_decoder.Reserve(std::min(huffman_stage->size, (size - header_size) * IMAGE_HEADER_MAX_EXPANSION));
+    }
+
+    // Do huffman decoding
+    // Check first byte, and when 4th bit is set, do huffman decoding and when not
+    // Just copy data to output buffer because we are only using RLE
+    if (!huffman_decoder.Decode(settings, encoded_data, (size - header_size)) ||
+      !this->CheckStageSize(image_header, STAGE_HUFFMAN, huffman_decoder.GetSize()))
+    {
+      return false;
+    }
+  }
+  uint8_t *decoded = static_huffman ? static_huffman_decoder.GetBuffer() : huffman_decoder.GetBuffer();
+  const uint64_t decoded_size = static_huffman ? static_huffman_decoder.GetSize() : huffman_decoder.GetSize();
+  this->EndStage(decoded_size);
+
+  // Initialize BWT decoder, RLE data are huffman decoded data, unless transformed by BWT
+  BwtDecoder bwt_decoder(decoded, decoded_size);
+  uint8_t *rle_input = decoded;
+  size_t rle_input_size = decoded_size;
+
+  // When BWT bit is set in settings byte, reverse BWT and MTF
+  if (settings & BWT_SETTINGS_BIT) {
+    this->StartStage("bwt decode", decoded_size);
+    if (!bwt_decoder.Decode()) {
+      std::cerr << "Failed to reverse BWT of given data, invalid data" << std::endl;
+      return false;
+    }
+    rle_input = bwt_decoder.GetBuffer();
+    rle_input_size = bwt_decoder.GetSize();
+    this->EndStage(rle_input_size);
+    if (!this->CheckStageSize(image_header, STAGE_BWT, rle_input_size)) {
+      return false;
+    }
+  }
+
+  // Initialize RLE decompressor and quadtree decompressor
+  RleDecompressor rle_decompressor(rle_input, rle_input_size);
+  QuadtreeDecompressor quadtree_decompressor(rle_input, rle_input_size);
+  bool convert_from_model = false;
+
+  // Decompress data, with quadtree when its bit is set in settings byte, otherwise with RLE
+  const bool quadtree_coded = (settings & QUADTREE_SETTINGS_BIT);
+  this->StartStage(quadtree_coded ? "quadtree decode" : "rle decode", rle_input_size);
+  if (!(quadtree_coded ? quadtree_decompressor.Decompress(convert_from_model) : rle_decompressor.Decompress(convert_from_model)))
+  {
+    std::cerr << "Failed to decompress given data, invalid data" << std::endl;
+    return false;
+  }
+
+  // Decompressed image
+  uint8_t * &image = quadtree_coded ? quadtree_decompressor.GetBuffer() : rle_decompressor.GetBuffer();
+  const size_t image_size = quadtree_coded ? quadtree_decompressor.GetSize() : rle_decompressor.GetSize();
+
+  // When `convert_from_model` is true, calculate original image from differences
+  if (convert_from_model && image_size > 0) {
+    DataWorker::Depreprocess(image, image_size, max_error);
+  }
+  this->EndStage(image_size);
+
+  // Decompressed image needs to have size from versioned header
+  if (!this->CheckStageSize(image_header, quadtree_coded ? STAGE_QUADTREE : STAGE_RLE, image_size)) {
+    return false;
+  }
+
+  // Save decompressed image
+  this->SetBuffer({}, image, image_size);
+  return true;
+}
+
+/**
+ * Check that stage produced the same number of bytes as is saved in versioned header
+ * @param[in] image_header Versioned header, nullptr for legacy data
+ * @param[in] id Identifier of stage
+ * @param[in] size Number of bytes produced by stage
+ * @returns True when sizes match or stage is not in header, false otherwise
+ * */
+bool ImageCodec::CheckStageSize(ImageHeader *image_header, const uint8_t &id, const uint64_t &size) {
+  const StageDescriptor *stage = (image_header != nullptr) ? image_header->FindStage(id) : nullptr;
+  if (stage != nullptr && stage->size != size) {
+    std::cerr << "Stage " << ImageHeader::StageName(id) << " decoded " << size << " bytes instead of "
+      << stage->size << " bytes from header, invalid data" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Return pointer to buffer with encoded data or decompressed image
+ * @returns Pointer to buffer
+ * */
+uint8_t * & ImageCodec::GetBuffer() {
+  return this->buffer;
+}
+
+/**
+ * Return buffer size
+ * @returns Size of buffer
+ * */
+const uint64_t & ImageCodec::GetSize() {
+  return this->buff_size;
+}
+
+/**
+ * Return raw image given to Transform, valid until Encode
+ * @returns Pointer to image, nullptr before Transform or after Encode
+ * */
+const uint8_t *ImageCodec::GetRawImage() {
+  return this->raw_pixels;
+}
+
+/**
+ * Return maximum error of each pixel of decompressed image, saved in its settings
+ * @returns Maximum error, 0 for lossless image
+ * */
+uint8_t ImageCodec::GetMaxError() {
+  return this->max_error;
+}
+
+/**
+ * Measure stages of Transform and Encode, with counters of RLE and huffman coding
+ * @param[in] stats Measured stages, nullptr to stop measuring
+ * */
+void ImageCodec::SetStats(CodecStats *stats) {
+  this->stats = stats;
+}
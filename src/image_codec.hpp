@@ -0,0 +1,220 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: image_codec.hpp
+ * Description: Contains definitions of ImageCodec class, that is used to run whole
+ * compression or decompression pipeline of one image in memory
+ * */
+#ifndef __IMAGE_CODEC__
+#define __IMAGE_CODEC__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstring>  // memcpy
+#include <vector>   // vector
+#include <iostream> // cerr
+#include <cassert>  // assert
+
+#include "data_worker.hpp"
+#include "image_header.hpp"
+#include "huffman/huffman_coder.hpp"
+#include "huffman/huffman_decoder.hpp"
+#include "huffman/static_huffman_coder.hpp"
+#include "huffman/static_huffman_decoder.hpp"
+#include "rle/rle_compressor.hpp"
+#include "rle/rle_decompressor.hpp"
+#include "bwt/bwt_encoder.hpp"
+#include "bwt/bwt_decoder.hpp"
+#include "quadtree/quadtree_compressor.hpp"
+#include "quadtree/quadtree_decompressor.hpp"
+#include "stats/codec_stats.hpp"
+#include "stats/trace_recorder.hpp"
+
+// Bit in settings byte, representing that raw pixels follow settings byte, it is one of padding bits, which
+// are used only together with SETTINGS_BIT_CHECK, so stored image never has SETTINGS_BIT_CHECK set
+constexpr uint8_t STORED_SETTINGS_BIT = 0x01;
+
+/**
+ * Settings of compression pipeline
+ * @param input_preprocessing True to calculate difference of pixels before RLE
+ * @param adaptive_sequence_scanning True to choose the better of horizontal and vertical RLE scanning
+ * @param quadtree_coding True to code uniform blocks with quadtree before RLE
+ * @param bwt_transform True to transform RLE data with BWT and MTF before huffman
+ * @param bwt_block_size Size of BWT block in bytes
+ * @param max_error Maximum error of each pixel, 0 for lossless
+ * @param static_huffman True to code data by static canonical huffman code instead of adaptive one, shared model is not used
+ * */
+typedef struct CodecSettings {
+  bool input_preprocessing;
+  bool adaptive_sequence_scanning;
+  bool quadtree_coding;
+  bool bwt_transform;
+  uint32_t bwt_block_size;
+  uint8_t max_error;
+  bool static_huffman;
+} CodecSettings;
+
+/**
+ * Class that will compress image into encoded data with header, or decompress them back
+ * */
+class ImageCodec {
+private:
+  // Buffer holding encoded data or decompressed image
+  uint8_t *buffer;
+  // Size of buffer
+  uint64_t buff_size;
+
+  // Settings bits of stages used by Transform, prediction of input, maximum error of each pixel and type of huffman code
+  uint8_t stage_settings;
+  bool input_preprocessing;
+  uint8_t max_error;
+  bool static_huffman;
+
+  // Size of image and size of data from RLE or quadtree, saved in versioned header
+  uint32_t width;
+  uint32_t height;
+  uint64_t rle_size;
+
+  // Raw image given to Transform, stored by Encode when coding does not reduce its size, with its copy
+  // when image may be freed before Encode
+  const uint8_t *raw_pixels;
+  std::vector<uint8_t> raw_image;
+
+  // Measured stages of compression, nullptr when they are not measured
+  CodecStats *stats;
+
+  // Stage, that is measured for stats or trace
+  std::string stage_name;
+  uint64_t stage_bytes_in;
+  std::chrono::steady_clock::time_point stage_start;
+
+  /**
+   * Start measuring of stage, for stats when they are set, otherwise as span of trace
+   * @param[in] name Name of stage
+   * @param[in] bytes_in Number of bytes given to stage
+   * */
+  void StartStage(const std::string &name, const uint64_t &bytes_in);
+
+  /**
+   * Stop measuring of stage started by the last StartStage
+   * @param[in] bytes_out Number of bytes produced by stage
+   * */
+  void EndStage(const uint64_t &bytes_out);
+
+  /**
+   * Replace buffer with copy of given data, with header before them
+   * @param[in] header Bytes to be saved before data
+   * @param[in] data Data to be copied
+   * @param[in] size Size of data
+   * */
+  void SetBuffer(const std::vector<uint8_t> &header, const uint8_t *data, const uint64_t &size);
+
+  /**
+   * Decompress encoded data starting with settings byte, result is image data
+   * @param[in] data Settings byte followed by encoded data
+   * @param[in] size Size of data
+   * @param[in] model Symbols used to train huffman tree, the same as given to Encode
+   * @param[in] image_header Versioned header read before data, nullptr for legacy data
+   * @returns True when decompression was successfull, false otherwise
+   * */
+  bool Decompress(uint8_t *data, const uint64_t &size, const std::vector<uint8_t> &model, ImageHeader *image_header);
+
+  /**
+   * Check that stage produced the same number of bytes as is saved in versioned header
+   * @param[in] image_header Versioned header, nullptr for legacy data
+   * @param[in] id Identifier of stage
+   * @param[in] size Number of bytes produced by stage
+   * @returns True when sizes match or stage is not in header, false otherwise
+   * */
+  bool CheckStageSize(ImageHeader *image_header, const uint8_t &id, const uint64_t &size);
+
+public:
+  /**
+   * Constructor
+   * */
+  ImageCodec();
+
+  /**
+   * Deconstructor that will free allocated data
+   * */
+  ~ImageCodec();
+
+  /**
+   * Run all stages before huffman coding, result are data for huffman without header
+   * @param[in] image Image data, that will not be modified
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * @param[in] settings Settings of compression pipeline
+   * @param[in] keep_image True to copy image, so it can be stored by Encode after it was freed, false when it stays valid until Encode
+   * */
+  void Transform(
+    const uint8_t *image,
+    const uint32_t &width,
+    const uint32_t &height,
+    const CodecSettings &settings,
+    const bool &keep_image = true
+  );
+
+  /**
+   * Huffman code data from Transform, result is header followed by encoded data
+   * @param[in] model Symbols used to train huffman tree before coding, decoder needs the same symbols
+   * @param[in] versioned_header True to save versioned header before settings byte, containers save size of image themselves
+   * */
+  void Encode(const std::vector<uint8_t> &model, const bool &versioned_header = true);
+
+  /**
+   * Compress image with given settings, result is header followed by encoded data
+   * @param[in] image Image data, that will not be modified
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * @param[in] settings Settings of compression pipeline
+   * @param[in] versioned_header True to save versioned header before settings byte, containers save size of image themselves
+   * */
+  void Compress(
+    const uint8_t *image,
+    const uint32_t &width,
+    const uint32_t &height,
+    const CodecSettings &settings,
+    const bool &versioned_header = true
+  );
+
+  /**
+   * Decompress encoded data with header, result is image data, versioned header is optional
+   * @param[in] data Header followed by encoded data
+   * @param[in] size Size of data
+   * @param[in] model Symbols used to train huffman tree, the same as given to Encode
+   * @returns True when decompression was successfull, false otherwise
+   * */
+  bool Decompress(uint8_t *data, const uint64_t &size, const std::vector<uint8_t> &model = {});
+
+  /**
+   * Return pointer to buffer with encoded data or decompressed image
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return buffer size
+   * @returns Size of buffer
+   * */
+  const uint64_t & GetSize();
+
+  /**
+   * Return raw image given to Transform, valid until Encode
+   * @returns Pointer to image, nullptr before Transform or after Encode
+   * */
+  const uint8_t *GetRawImage();
+
+  /**
+   * Return maximum error of each pixel of decompressed image, saved in its settings
+   * @returns Maximum error, 0 for lossless image
+   * */
+  uint8_t GetMaxError();
+
+  /**
+   * Measure stages of Transform and Encode, with counters of RLE and huffman coding
+   * @param[in] stats Measured stages, nullptr to stop measuring
+   * */
+  void SetStats(CodecStats *stats);
+};
+
+#endif
@@ -0,0 +1,213 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: image_header.cpp
+ * Description: Contains implementations of ImageHeader class, that is used to write and read versioned
+ * header of single image, with its size and list of stages with size of their decoded data
+ * */
+#include "image_header.hpp"
+#include "byte_io.hpp"
+
+/**
+ * Constructor of header of image with given size
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * */
+ImageHeader::ImageHeader(const uint32_t &width, const uint32_t &height) {
+  this->version = IMAGE_HEADER_VERSION;
+  this->header_size = 0;
+  this->width = width;
+  this->height = height;
+}
+
+/**
+ * Add descriptor of stage, stages are added in order in which they are reversed
+ * @param[in] id Identifier of stage
+ * @param[in] size Size of data produced by stage when decoding
+ * @param[in] params Parameters of stage
+ * */
+void ImageHeader::AddStage(const uint8_t &id, const uint64_t &size, const std::vector<uint8_t> &params) {
+  this->stages.push_back({id, size, params});
+}
+
+/**
+ * Create bytes of header
+ * @returns Header to be saved before encoded data
+ * */
+std::vector<uint8_t> ImageHeader::Write() {
+  std::vector<uint8_t> header(CONTAINER_MAGIC, CONTAINER_MAGIC + sizeof(CONTAINER_MAGIC));
+  header.push_back(CONTAINER_IMAGE);
+  header.push_back(this->version);
+
+  // Header size is filled in at the end
+  ByteIo::AppendValue(header, 0, IMAGE_HEADER_LENGTH_BYTES);
+  ByteIo::AppendValue(header, this->width, IMAGE_HEADER_VALUE_BYTES);
+  ByteIo::AppendValue(header, this->height, IMAGE_HEADER_VALUE_BYTES);
+
+  // Descriptors of stages, each with identifier, size of decoded data and its parameters
+  header.push_back(this->stages.size());
+  for (const StageDescriptor &stage : this->stages) {
+    header.push_back(stage.id);
+    ByteIo::AppendValue(header, stage.size, IMAGE_HEADER_SIZE_BYTES);
+    header.push_back(stage.params.size());
+    header.insert(header.end(), stage.params.begin(), stage.params.end());
+  }
+
+  // Save header size after version
+  this->header_size = header.size();
+  header[CONTAINER_MAGIC_SIZE + 1] = (this->header_size >> 8);
+  header[CONTAINER_MAGIC_SIZE + 2] = (this->header_size & 0xFF);
+  return header;
+}
+
+/**
+ * Return size of whole header from its start
+ * @param[in] data Data starting with header
+ * @param[in] size Size of data, at least IMAGE_HEADER_PREFIX_SIZE
+ * @returns Size of header, 0 when data do not start with header
+ * */
+uint16_t ImageHeader::ReadHeaderSize(const uint8_t *data, const uint64_t &size) {
+  if (!IsContainer(data, size, CONTAINER_IMAGE) || size < IMAGE_HEADER_PREFIX_SIZE) {
+    return 0;
+  }
+  return ByteIo::ReadValue(data, CONTAINER_MAGIC_SIZE + 1, IMAGE_HEADER_LENGTH_BYTES);
+}
+
+/**
+ * Read header from start of data
+ * @param[in] data Data starting with header
+ * @param[in] size Size of data
+ * @returns True when header is valid, false otherwise
+ * */
+bool ImageHeader::Read(const uint8_t *data, const uint64_t &size) {
+  this->header_size = ReadHeaderSize(data, size);
+  if (this->header_size == 0) {
+    std::cerr << "Data do not start with image header!" << std::endl;
+    return false;
+  }
+
+  // Headers of newer versions may have different layout
+  this->version = data[CONTAINER_MAGIC_SIZE];
+  if (this->version == 0 || this->version > IMAGE_HEADER_VERSION) {
+    std::cerr << "Unsupported version " << static_cast<uint32_t>(this->version) << " of image header!" << std::endl;
+    return false;
+  }
+
+  // Whole header needs to be present
+  uint64_t position = IMAGE_HEADER_PREFIX_SIZE;
+  if (this->header_size > size || this->header_size < (position + 2 * IMAGE_HEADER_VALUE_BYTES + 1)) {
+    std::cerr << "Image header is not complete!" << std::endl;
+    return false;
+  }
+
+  // Size of image and number of stages
+  this->width = ByteIo::ReadValue(data, position, IMAGE_HEADER_VALUE_BYTES);
+  this->height = ByteIo::ReadValue(data, position + IMAGE_HEADER_VALUE_BYTES, IMAGE_HEADER_VALUE_BYTES);
+  position += 2 * IMAGE_HEADER_VALUE_BYTES;
+  const uint8_t stage_count = data[position++];
+
+  // Descriptors of stages, none of them can reach behind header
+  this->stages.clear();
+  for (uint8_t i = 0; i < stage_count; i++) {
+    if ((position + 1 + IMAGE_HEADER_SIZE_BYTES + 1) > this->header_size) {
+      std::cerr << "Image header is not complete!" << std::endl;
+      return false;
+    }
+
+    StageDescriptor stage;
+    stage.id = data[position];
+    stage.size = ByteIo::ReadValue(data, position + 1, IMAGE_HEADER_SIZE_BYTES);
+    const uint8_t params_size = data[position + 1 + IMAGE_HEADER_SIZE_BYTES];
+    position += 1 + IMAGE_HEADER_SIZE_BYTES + 1;
+
+    if ((position + params_size) > this->header_size) {
+      std::cerr << "Image header is not complete!" << std::endl;
+      return false;
+    }
+    stage.params.assign(&data[position], &data[position + params_size]);
+    position += params_size;
+
+    this->stages.push_back(stage);
+  }
+
+  return true;
+}
+
+/**
+ * Return descriptor of stage with given identifier
+ * @param[in] id Identifier of stage
+ * @returns Pointer to descriptor, nullptr when stage was not used
+ * */
+const StageDescriptor * ImageHeader::FindStage(const uint8_t &id) {
+  for (const StageDescriptor &stage : this->stages) {
+    if (stage.id == id) {
+      return &stage;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * Return name of stage with given identifier
+ * @param[in] id Identifier of stage
+ * @returns Name of stage
+ * */
+std::string ImageHeader::StageName(const uint8_t &id) {
+  switch (id) {
+    case STAGE_HUFFMAN:
+      return "huffman";
+    case STAGE_STATIC_HUFFMAN:
+      return "static huffman";
+    case STAGE_BWT:
+      return "bwt+mtf";
+    case STAGE_RLE:
+      return "rle";
+    case STAGE_QUADTREE:
+      return "quadtree";
+    case STAGE_PREDICTION:
+      return "prediction";
+    case STAGE_STORED:
+      return "stored";
+  }
+  return "unknown";
+}
+
+/**
+ * Return version of header
+ * @returns Version
+ * */
+uint8_t ImageHeader::GetVersion() {
+  return this->version;
+}
+
+/**
+ * Return size of header in bytes
+ * @returns Size of header
+ * */
+uint16_t ImageHeader::GetHeaderSize() {
+  return this->header_size;
+}
+
+/**
+ * Return width of image
+ * @returns Width
+ * */
+uint32_t ImageHeader::GetWidth() {
+  return this->width;
+}
+
+/**
+ * Return height of image
+ * @returns Height
+ * */
+uint32_t ImageHeader::GetHeight() {
+  return this->height;
+}
+
+/**
+ * Return descriptors of all stages
+ * @returns Descriptors in order in which stages are reversed
+ * */
+const std::vector<StageDescriptor> & ImageHeader::GetStages() {
+  return this->stages;
+}
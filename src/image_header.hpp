@@ -0,0 +1,153 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: image_header.hpp
+ * Description: Contains definitions of ImageHeader class, that is used to write and read versioned
+ * header of single image, with its size and list of stages with size of their decoded data
+ * */
+#ifndef __IMAGE_HEADER__
+#define __IMAGE_HEADER__
+
+#include <iostream> // cerr
+#include <cstdint>  // uint8_t, uint16_t, uint32_t, uint64_t
+#include <vector>   // vector
+#include <string>   // string
+
+#include "container.hpp"
+
+// Version of header written by this program, newer versions are not read
+constexpr uint8_t IMAGE_HEADER_VERSION = 1;
+
+// Number of bytes of header size
+constexpr uint8_t IMAGE_HEADER_LENGTH_BYTES = 2;
+
+// Number of bytes of width and height
+constexpr uint8_t IMAGE_HEADER_VALUE_BYTES = 4;
+
+// Number of bytes of size of decoded data of stage
+constexpr uint8_t IMAGE_HEADER_SIZE_BYTES = 8;
+
+// Start of header, that is needed to know size of whole header: magic bytes, version and header size
+constexpr uint8_t IMAGE_HEADER_PREFIX_SIZE = CONTAINER_MAGIC_SIZE + 1 + IMAGE_HEADER_LENGTH_BYTES;
+
+// Highest ratio of size of huffman decoded data to size of encoded data, each symbol has code of at least one bit,
+// so buffer allocated in advance by damaged header is bounded by size of input
+constexpr uint64_t IMAGE_HEADER_MAX_EXPANSION = 8;
+
+// Identifiers of stages, in descriptor list they are saved in order in which they are reversed
+constexpr uint8_t STAGE_HUFFMAN = 'H';
+constexpr uint8_t STAGE_STATIC_HUFFMAN = 'C';
+constexpr uint8_t STAGE_BWT = 'B';
+constexpr uint8_t STAGE_RLE = 'R';
+constexpr uint8_t STAGE_QUADTREE = 'Q';
+constexpr uint8_t STAGE_PREDICTION = 'P';
+constexpr uint8_t STAGE_STORED = 'S';
+
+/**
+ * Descriptor of one stage of pipeline
+ * @param id Identifier of stage
+ * @param size Size of data produced by stage when decoding
+ * @param params Parameters of stage, for prediction maximum error of pixel
+ * */
+typedef struct StageDescriptor {
+  uint8_t id;
+  uint64_t size;
+  std::vector<uint8_t> params;
+} StageDescriptor;
+
+/**
+ * Class holding versioned header of single image, header consists of magic bytes, version,
+ * header size, width, height, number of stages and their descriptors
+ * */
+class ImageHeader {
+private:
+  uint8_t version;
+  uint16_t header_size;
+  uint32_t width;
+  uint32_t height;
+  std::vector<StageDescriptor> stages;
+
+public:
+  /**
+   * Constructor of header of image with given size
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * */
+  ImageHeader(const uint32_t &width = 0, const uint32_t &height = 0);
+
+  /**
+   * Add descriptor of stage, stages are added in order in which they are reversed
+   * @param[in] id Identifier of stage
+   * @param[in] size Size of data produced by stage when decoding
+   * @param[in] params Parameters of stage
+   * */
+  void AddStage(const uint8_t &id, const uint64_t &size, const std::vector<uint8_t> &params = {});
+
+  /**
+   * Create bytes of header
+   * @returns Header to be saved before encoded data
+   * */
+  std::vector<uint8_t> Write();
+
+  /**
+   * Return size of whole header from its start
+   * @param[in] data Data starting with header
+   * @param[in] size Size of data, at least IMAGE_HEADER_PREFIX_SIZE
+   * @returns Size of header, 0 when data do not start with header
+   * */
+  static uint16_t ReadHeaderSize(const uint8_t *data, const uint64_t &size);
+
+  /**
+   * Read header from start of data
+   * @param[in] data Data starting with header
+   * @param[in] size Size of data
+   * @returns True when header is valid, false otherwise
+   * */
+  bool Read(const uint8_t *data, const uint64_t &size);
+
+  /**
+   * Return descriptor of stage with given identifier
+   * @param[in] id Identifier of stage
+   * @returns Pointer to descriptor, nullptr when stage was not used
+   * */
+  const StageDescriptor * FindStage(const uint8_t &id);
+
+  /**
+   * Return name of stage with given identifier
+   * @param[in] id Identifier of stage
+   * @returns Name of stage
+   * */
+  static std::string StageName(const uint8_t &id);
+
+  /**
+   * Return version of header
+   * @returns Version
+   * */
+  uint8_t GetVersion();
+
+  /**
+   * Return size of header in bytes
+   * @returns Size of header
+   * */
+  uint16_t GetHeaderSize();
+
+  /**
+   * Return width of image
+   * @returns Width
+   * */
+  uint32_t GetWidth();
+
+  /**
+   * Return height of image
+   * @returns Height
+   * */
+  uint32_t GetHeight();
+
+  /**
+   * Return descriptors of all stages
+   * @returns Descriptors in order in which stages are reversed
+   * */
+  const std::vector<StageDescriptor> & GetStages();
+};
+
+#endif
@@ -0,0 +1,27 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: preview.hpp
+ * Description: Contains definitions of constant data for both preview compressor and decompressor
+ * */
+#ifndef __PREVIEW__
+#define __PREVIEW__
+
+#include <cstdint>  // uint8_t
+
+// Constants used both in PreviewCompressor and PreviewDecompressor
+
+// Default number of pixels in each direction, that are averaged into one pixel of preview
+constexpr uint8_t PREVIEW_DEFAULT_SCALE = 8;
+
+// Number of bytes of width and height of image and preview
+constexpr uint8_t PREVIEW_VALUE_BYTES = 4;
+
+// Number of bytes of size of encoded preview
+constexpr uint8_t PREVIEW_SIZE_BYTES = 8;
+
+// Size of header, magic bytes followed by width and height of image, scale,
+// width and height of preview and size of encoded preview
+constexpr uint8_t PREVIEW_HEADER_SIZE = 4 + 4 * PREVIEW_VALUE_BYTES + 1 + PREVIEW_SIZE_BYTES;
+
+#endif
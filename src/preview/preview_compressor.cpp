@@ -0,0 +1,142 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: preview_compressor.cpp
+ * Description: Contains implementations of preview compressor class that is used to compress
+ * image together with its downsampled preview, saved before image
+ * */
+#include "preview_compressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor that will initialize values
+ * @param[in] buffer Image data
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * */
+PreviewCompressor::PreviewCompressor(const uint8_t *buffer, const uint32_t &width, const uint32_t &height) {
+  // Set image which we will be compressing
+  this->buffer = buffer;
+  this->width = width;
+  this->height = height;
+
+  // Set container data
+  this->encoded_buff = nullptr;
+  this->encoded_index = 0;
+}
+
+/**
+ * Deconstructor that will free allocated data
+ * */
+PreviewCompressor::~PreviewCompressor() {
+  // When buffer was allocated, free him
+  if (this->encoded_buff) {
+    free(this->encoded_buff);
+  }
+
+  // Remove pointer pointing to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Downsample image by box filter, each pixel of preview is average of scale x scale block
+ * @param[in] scale Size of block
+ * @param[out] preview Resulting preview
+ * @param[in] preview_width Width of preview
+ * @param[in] preview_height Height of preview
+ * */
+void PreviewCompressor::BoxFilter(
+  const uint8_t &scale,
+  std::vector<uint8_t> &preview,
+  const uint32_t &preview_width,
+  const uint32_t &preview_height
+) {
+  preview.resize(static_cast<size_t>(preview_width) * preview_height);
+
+  // Sums of pixels of blocks in one row of blocks
+  std::vector<uint32_t> sums(preview_width);
+
+  for (uint32_t block_y = 0; block_y < preview_height; block_y++) {
+    // Blocks on the bottom edge may have less rows
+    const uint32_t start_y = block_y * scale;
+    const uint32_t rows = std::min<uint32_t>(scale, this->height - start_y);
+
+    // Sum rows of blocks, row after row so image is read in order
+    std::fill(sums.begin(), sums.end(), 0);
+    for (uint32_t y = start_y; y < (start_y + rows); y++) {
+      const uint8_t *row = &this->buffer[static_cast<size_t>(y) * this->width];
+      for (uint32_t x = 0; x < this->width; x++) {
+        sums[x / scale] += row[x];
+      }
+    }
+
+    // Average of each block, blocks on the right edge may have less columns
+    for (uint32_t block_x = 0; block_x < preview_width; block_x++) {
+      const uint32_t columns = std::min<uint32_t>(scale, this->width - block_x * scale);
+      const uint32_t count = rows * columns;
+      preview[static_cast<size_t>(block_y) * preview_width + block_x] = ((sums[block_x] + count / 2) / count);
+    }
+  }
+}
+
+/**
+ * Compress preview and image with the same settings, preview is saved first
+ * @param[in] settings Settings of compression pipeline
+ * @param[in] scale Number of pixels in each direction, that are averaged into one pixel of preview
+ * */
+void PreviewCompressor::Compress(const CodecSettings &settings, const uint8_t &scale) {
+  // Preview has rounded up size, so partial blocks on edges are also in preview
+  const uint32_t preview_width = (this->width + scale - 1) / scale;
+  const uint32_t preview_height = (this->height + scale - 1) / scale;
+
+  // Downsample and compress preview
+  std::vector<uint8_t> preview;
+  this->BoxFilter(scale, preview, preview_width, preview_height);
+  ImageCodec preview_codec;
+  preview_codec.Compress(preview.data(), preview_width, preview_height, settings, false);
+
+  // Compress image
+  ImageCodec image_codec;
+  image_codec.Compress(this->buffer, this->width, this->height, settings, false);
+
+  // Allocate buffer for header, preview and image
+  this->encoded_buff = (uint8_t *)malloc(sizeof(uint8_t) * (PREVIEW_HEADER_SIZE + preview_codec.GetSize() + image_codec.GetSize()));
+
+  // Invalid pointer
+  assert(this->encoded_buff != nullptr);
+
+  // Magic bytes of container
+  memcpy(this->encoded_buff, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC));
+  this->encoded_index = sizeof(CONTAINER_MAGIC);
+  this->encoded_buff[this->encoded_index++] = CONTAINER_PREVIEW;
+
+  // Size of image, scale, size of preview and size of encoded preview
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->width, PREVIEW_VALUE_BYTES);
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->height, PREVIEW_VALUE_BYTES);
+  this->encoded_buff[this->encoded_index++] = scale;
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, preview_width, PREVIEW_VALUE_BYTES);
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, preview_height, PREVIEW_VALUE_BYTES);
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, preview_codec.GetSize(), PREVIEW_SIZE_BYTES);
+
+  // Encoded preview, followed by encoded image
+  memcpy(&this->encoded_buff[this->encoded_index], preview_codec.GetBuffer(), preview_codec.GetSize());
+  this->encoded_index += preview_codec.GetSize();
+  memcpy(&this->encoded_buff[this->encoded_index], image_codec.GetBuffer(), image_codec.GetSize());
+  this->encoded_index += image_codec.GetSize();
+}
+
+/**
+ * Return pointer to container buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & PreviewCompressor::GetBuffer() {
+  return this->encoded_buff;
+}
+
+/**
+ * Return container buffer size
+ * @returns Size of buffer
+ * */
+uint64_t & PreviewCompressor::GetSize() {
+  return this->encoded_index;
+}
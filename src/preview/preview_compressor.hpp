@@ -0,0 +1,78 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: preview_compressor.hpp
+ * Description: Contains definitions of preview compressor class that is used to compress
+ * image together with its downsampled preview, saved before image
+ * */
+#ifndef __PREVIEW_COMPRESSOR__
+#define __PREVIEW_COMPRESSOR__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstring>  // memcpy
+#include <vector>   // vector
+#include <algorithm> // min, fill
+#include <cassert>  // assert
+
+#include "preview.hpp"
+#include "../container.hpp"
+#include "../image_codec.hpp"
+
+/**
+ * Class that will compress image with preview into one container
+ * */
+class PreviewCompressor {
+private:
+  // Image which we will be compressing
+  const uint8_t *buffer;
+  uint32_t width;
+  uint32_t height;
+
+  // Resulting container
+  uint8_t *encoded_buff;
+  uint64_t encoded_index;
+
+  /**
+   * Downsample image by box filter, each pixel of preview is average of scale x scale block
+   * @param[in] scale Size of block
+   * @param[out] preview Resulting preview
+   * @param[in] preview_width Width of preview
+   * @param[in] preview_height Height of preview
+   * */
+  void BoxFilter(const uint8_t &scale, std::vector<uint8_t> &preview, const uint32_t &preview_width, const uint32_t &preview_height);
+
+public:
+  /**
+   * Constructor that will initialize values
+   * @param[in] buffer Image data
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * */
+  PreviewCompressor(const uint8_t *buffer, const uint32_t &width, const uint32_t &height);
+
+  /**
+   * Deconstructor that will free allocated data
+   * */
+  ~PreviewCompressor();
+
+  /**
+   * Compress preview and image with the same settings, preview is saved first
+   * @param[in] settings Settings of compression pipeline
+   * @param[in] scale Number of pixels in each direction, that are averaged into one pixel of preview
+   * */
+  void Compress(const CodecSettings &settings, const uint8_t &scale);
+
+  /**
+   * Return pointer to container buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return container buffer size
+   * @returns Size of buffer
+   * */
+  uint64_t & GetSize();
+};
+
+#endif
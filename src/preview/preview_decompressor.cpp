@@ -0,0 +1,143 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: preview_decompressor.cpp
+ * Description: Contains implementations of preview decompressor class that is used to decompress
+ * either preview or image from container created by PreviewCompressor
+ * */
+#include "preview_decompressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor for PreviewDecompressor that will initialize values
+ * @param[in] buffer Data buffer holding container
+ * @param[in] size Size of data buffer
+ * */
+PreviewDecompressor::PreviewDecompressor(uint8_t * &buffer, const uint64_t &size) {
+  // Receive buffer
+  this->buffer = buffer;
+  this->size = size;
+
+  // Initialize header values
+  this->width = 0;
+  this->height = 0;
+  this->scale = 0;
+  this->preview_width = 0;
+  this->preview_height = 0;
+  this->preview_size = 0;
+}
+
+/**
+ * Deconstructor
+ * */
+PreviewDecompressor::~PreviewDecompressor() {
+  // Destroy pointer to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Read header of container, data of preview and image may be missing
+ * @returns True when header is valid, false otherwise
+ * */
+bool PreviewDecompressor::ReadHeader() {
+  // Check magic bytes and size of header
+  if (!IsContainer(this->buffer, this->size, CONTAINER_PREVIEW) || this->size < PREVIEW_HEADER_SIZE) {
+    std::cerr << "Data are not image with preview!" << std::endl;
+    return false;
+  }
+
+  // Load size of image, scale, size of preview and size of encoded preview
+  uint64_t position = CONTAINER_MAGIC_SIZE;
+  this->width = ByteIo::ReadValue(this->buffer, position, PREVIEW_VALUE_BYTES);
+  this->height = ByteIo::ReadValue(this->buffer, position + PREVIEW_VALUE_BYTES, PREVIEW_VALUE_BYTES);
+  position += 2 * PREVIEW_VALUE_BYTES;
+  this->scale = this->buffer[position++];
+  this->preview_width = ByteIo::ReadValue(this->buffer, position, PREVIEW_VALUE_BYTES);
+  this->preview_height = ByteIo::ReadValue(this->buffer, position + PREVIEW_VALUE_BYTES, PREVIEW_VALUE_BYTES);
+  position += 2 * PREVIEW_VALUE_BYTES;
+  this->preview_size = ByteIo::ReadValue(this->buffer, position, PREVIEW_SIZE_BYTES);
+
+  // Encoded preview can not be bigger than whole file
+  if (this->preview_size > (UINT64_MAX - PREVIEW_HEADER_SIZE)) {
+    std::cerr << "Invalid size of preview!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Return number of bytes from start of container, that are needed for decompressing preview
+ * @returns Size of header and encoded preview
+ * */
+uint64_t PreviewDecompressor::GetPreviewEnd() {
+  return PREVIEW_HEADER_SIZE + this->preview_size;
+}
+
+/**
+ * Decompress preview only, encoded image does not need to be loaded
+ * @returns True when decompression was successfull, false otherwise
+ * */
+bool PreviewDecompressor::DecompressPreview() {
+  // Preview needs to be loaded
+  if (this->GetPreviewEnd() > this->size) {
+    std::cerr << "Container does not contain whole preview!" << std::endl;
+    return false;
+  }
+
+  // Decompress preview and check its size
+  const uint64_t expected_size = static_cast<uint64_t>(this->preview_width) * this->preview_height;
+  if (!this->codec.Decompress(&this->buffer[PREVIEW_HEADER_SIZE], this->preview_size) || this->codec.GetSize() != expected_size) {
+    std::cerr << "Failed to decompress preview!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Decompress image, preview is skipped
+ * @returns True when decompression was successfull, false otherwise
+ * */
+bool PreviewDecompressor::Decompress() {
+  // Image follows preview
+  if (this->GetPreviewEnd() > this->size) {
+    std::cerr << "Container does not contain image!" << std::endl;
+    return false;
+  }
+
+  // Decompress image and check its size
+  const uint64_t expected_size = static_cast<uint64_t>(this->width) * this->height;
+  if (!this->codec.Decompress(&this->buffer[this->GetPreviewEnd()], this->size - this->GetPreviewEnd()) ||
+    this->codec.GetSize() != expected_size)
+  {
+    std::cerr << "Failed to decompress image!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Return pointer to decompressed preview or image
+ * @returns Pointer to buffer
+ * */
+uint8_t * & PreviewDecompressor::GetBuffer() {
+  return this->codec.GetBuffer();
+}
+
+/**
+ * Return size of decompressed preview or image
+ * @returns Size of buffer
+ * */
+uint64_t PreviewDecompressor::GetSize() {
+  return this->codec.GetSize();
+}
+
+/**
+ * Return maximum error of each pixel of decompressed preview or image, saved in its settings
+ * @returns Maximum error, 0 for lossless image
+ * */
+uint8_t PreviewDecompressor::GetMaxError() {
+  return this->codec.GetMaxError();
+}
@@ -0,0 +1,97 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: preview_decompressor.hpp
+ * Description: Contains definitions of preview decompressor class that is used to decompress
+ * either preview or image from container created by PreviewCompressor
+ * */
+#ifndef __PREVIEW_DECOMPRESSOR__
+#define __PREVIEW_DECOMPRESSOR__
+
+#include <iostream> // cerr
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+
+#include "preview.hpp"
+#include "../container.hpp"
+#include "../image_codec.hpp"
+
+/**
+ * Class used for decompressing preview or image from container
+ * */
+class PreviewDecompressor {
+private:
+  // Buffer that holds loaded container, or only its start with preview
+  uint8_t *buffer;
+  // Size of loaded data
+  uint64_t size;
+
+  // Size of image, scale and size of preview
+  uint32_t width;
+  uint32_t height;
+  uint8_t scale;
+  uint32_t preview_width;
+  uint32_t preview_height;
+
+  // Size of encoded preview
+  uint64_t preview_size;
+
+  // Codec holding decompressed preview or image
+  ImageCodec codec;
+
+public:
+  /**
+   * Constructor for PreviewDecompressor that will initialize values
+   * @param[in] buffer Data buffer holding container
+   * @param[in] size Size of data buffer
+   * */
+  PreviewDecompressor(uint8_t * &buffer, const uint64_t &size);
+
+  /**
+   * Deconstructor
+   * */
+  ~PreviewDecompressor();
+
+  /**
+   * Read header of container, data of preview and image may be missing
+   * @returns True when header is valid, false otherwise
+   * */
+  bool ReadHeader();
+
+  /**
+   * Return number of bytes from start of container, that are needed for decompressing preview
+   * @returns Size of header and encoded preview
+   * */
+  uint64_t GetPreviewEnd();
+
+  /**
+   * Decompress preview only, encoded image does not need to be loaded
+   * @returns True when decompression was successfull, false otherwise
+   * */
+  bool DecompressPreview();
+
+  /**
+   * Decompress image, preview is skipped
+   * @returns True when decompression was successfull, false otherwise
+   * */
+  bool Decompress();
+
+  /**
+   * Return pointer to decompressed preview or image
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return size of decompressed preview or image
+   * @returns Size of buffer
+   * */
+  uint64_t GetSize();
+
+  /**
+   * Return maximum error of each pixel of decompressed preview or image, saved in its settings
+   * @returns Maximum error, 0 for lossless image
+   * */
+  uint8_t GetMaxError();
+};
+
+#endif
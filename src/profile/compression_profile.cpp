@@ -0,0 +1,244 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: compression_profile.cpp
+ * Description: Contains implementations of CompressionProfile class, that holds Pareto-optimal modes
+ * of compression measured on corpus of images, saved to and loaded from text file
+ * */
+#include "compression_profile.hpp"
+
+/**
+ * Constructor of empty profile
+ * */
+CompressionProfile::CompressionProfile() {
+}
+
+/**
+ * Return name of scanning
+ * @param[in] scanning Scanning of RLE
+ * @returns Name of scanning
+ * */
+std::string CompressionProfile::GetScanningName(const uint8_t &scanning) {
+  switch (scanning) {
+    case PROFILE_SCANNING_HORIZONTAL:
+      return "horizontal";
+    case PROFILE_SCANNING_ADAPTIVE:
+      return "adaptive";
+    case PROFILE_SCANNING_QUADTREE:
+      return "quadtree";
+  }
+  return "unknown";
+}
+
+/**
+ * Parse one line of profile file into mode
+ * @param[in] line Line of profile file
+ * @param[in] version Version of profile file
+ * @param[out] entry Parsed mode
+ * @returns True when line is valid mode, false otherwise
+ * */
+bool CompressionProfile::ParseEntry(const std::string &line, const uint32_t &version, ProfileEntry &entry) {
+  std::stringstream sstream(line);
+  std::string predictor, scanning, huffman;
+  uint32_t bwt_transform;
+  sstream >> entry.tile_size >> predictor >> scanning >> bwt_transform >> huffman;
+
+  // Modes of version 1 were measured on one thread, negative number would wrap around in uint32_t
+  int64_t threads = 1;
+  if (version > 1) {
+    sstream >> threads;
+  }
+  sstream >> entry.ratio >> entry.compress_speed >> entry.decompress_speed;
+  if (sstream.fail() || bwt_transform > 1 || (huffman != "static" && huffman != "adaptive") || threads < 1 ||
+    threads > TILE_WORKERS_MAX_THREADS)
+  {
+    return false;
+  }
+  entry.threads = static_cast<uint32_t>(threads);
+  entry.bwt_transform = (bwt_transform == 1);
+  entry.static_huffman = (huffman == "static");
+
+  // Names are searched, so file stays readable
+  entry.predictor = TILE_PREDICTOR_LOWEST_ENTROPY + 1;
+  for (uint8_t i = 0; i <= TILE_PREDICTOR_LOWEST_ENTROPY; i++) {
+    if (TilePredictor::GetName(i) == predictor) {
+      entry.predictor = i;
+    }
+  }
+  entry.scanning = PROFILE_SCANNING_COUNT;
+  for (uint8_t i = 0; i < PROFILE_SCANNING_COUNT; i++) {
+    if (CompressionProfile::GetScanningName(i) == scanning) {
+      entry.scanning = i;
+    }
+  }
+
+  // Whole image can be coded only with difference from left pixel
+  if (entry.predictor > TILE_PREDICTOR_LOWEST_ENTROPY || entry.scanning == PROFILE_SCANNING_COUNT ||
+    (entry.tile_size == 0 && entry.predictor != TILE_PREDICTOR_NONE && entry.predictor != TILE_PREDICTOR_LEFT))
+  {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Keep only Pareto-optimal modes by ratio and speed of compression
+ * @param[in] candidates Measured modes
+ * @returns Modes from the fastest to the best ratio
+ * */
+std::vector<ProfileEntry> CompressionProfile::ParetoFront(const std::vector<ProfileEntry> &candidates) {
+  std::vector<ProfileEntry> sorted = candidates;
+  std::stable_sort(sorted.begin(), sorted.end(), [](const ProfileEntry &a, const ProfileEntry &b) {
+    return (a.compress_speed != b.compress_speed) ? (a.compress_speed > b.compress_speed) : (a.ratio > b.ratio);
+  });
+
+  // Slower mode is kept only when it has better ratio than all faster modes
+  std::vector<ProfileEntry> front;
+  for (const ProfileEntry &entry : sorted) {
+    if (front.empty() || entry.ratio > front.back().ratio) {
+      front.push_back(entry);
+    }
+  }
+  return front;
+}
+
+/**
+ * Set modes of profile, only Pareto-optimal of them are kept
+ * @param[in] candidates Measured modes
+ * */
+void CompressionProfile::SetEntries(const std::vector<ProfileEntry> &candidates) {
+  this->entries = CompressionProfile::ParetoFront(candidates);
+}
+
+/**
+ * Load profile from file
+ * @param[in] filename Name of profile file
+ * @returns True when file is valid profile with at least one mode, false otherwise
+ * */
+bool CompressionProfile::Load(const std::string &filename) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    std::cerr << "Failed to open profile " << filename << "!" << std::endl;
+    return false;
+  }
+
+  // First line holds magic word and version
+  std::string line, magic;
+  uint32_t version = 0;
+  std::getline(file, line);
+  std::stringstream sstream(line);
+  sstream >> magic >> version;
+  if (magic != PROFILE_MAGIC || version < 1 || version > PROFILE_VERSION) {
+    std::cerr << "File " << filename << " is not profile of version 1 to " << +PROFILE_VERSION << "!" << std::endl;
+    return false;
+  }
+
+  // Each other line is one mode, empty lines and comments are skipped
+  std::vector<ProfileEntry> candidates;
+  uint64_t line_number = 1;
+  while (std::getline(file, line)) {
+    line_number++;
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    ProfileEntry entry;
+    if (!CompressionProfile::ParseEntry(line, version, entry)) {
+      std::cerr << "Invalid mode on line " << line_number << " of profile " << filename << "!" << std::endl;
+      return false;
+    }
+    candidates.push_back(entry);
+  }
+
+  if (candidates.empty()) {
+    std::cerr << "Profile " << filename << " does not contain any mode!" << std::endl;
+    return false;
+  }
+
+  this->SetEntries(candidates);
+  return true;
+}
+
+/**
+ * Save profile to file
+ * @param[in] filename Name of profile file
+ * @returns True when file was written, false otherwise
+ * */
+bool CompressionProfile::Save(const std::string &filename) {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  file << PROFILE_MAGIC << " " << +PROFILE_VERSION << std::endl;
+  file << "# tile_size predictor scanning bwt huffman threads ratio compress_mb_s decompress_mb_s" << std::endl;
+  for (const ProfileEntry &entry : this->entries) {
+    file << entry.tile_size << " " << TilePredictor::GetName(entry.predictor) << " "
+      << CompressionProfile::GetScanningName(entry.scanning) << " " << (entry.bwt_transform ? 1 : 0) << " "
+      << (entry.static_huffman ? "static" : "adaptive") << " " << entry.threads << " " << entry.ratio << " "
+      << entry.compress_speed << " " << entry.decompress_speed << std::endl;
+  }
+  return file.good();
+}
+
+/**
+ * Choose mode by compression level, -1 is the fastest mode, -9 mode with the best ratio
+ * and modes between are spread evenly
+ * @param[in] level Compression level 1 to 9, 0 for mode with the best ratio
+ * @returns Chosen mode
+ * */
+const ProfileEntry & CompressionProfile::Select(const uint8_t &level) {
+  if (level == 0) {
+    return this->entries.back();
+  }
+
+  const double position = (std::min<uint8_t>(level, 9) - 1) / 8.0;
+  return this->entries[std::lround(position * (this->entries.size() - 1))];
+}
+
+/**
+ * Return settings of compression pipeline for mode, 2D predictor of tiles is replaced by -m,
+ * when image is not split into tiles
+ * @param[in] entry Mode of compression
+ * @param[in] settings Settings of compression pipeline, BWT block size and maximum error are kept
+ * @returns Settings of mode
+ * */
+CodecSettings CompressionProfile::GetSettings(const ProfileEntry &entry, const CodecSettings &settings) {
+  CodecSettings result = settings;
+  result.input_preprocessing = (entry.predictor != TILE_PREDICTOR_NONE);
+  result.adaptive_sequence_scanning = (entry.scanning != PROFILE_SCANNING_HORIZONTAL);
+  result.quadtree_coding = (entry.scanning == PROFILE_SCANNING_QUADTREE);
+  result.bwt_transform = entry.bwt_transform;
+  result.static_huffman = entry.static_huffman;
+  return result;
+}
+
+/**
+ * Return human readable description of mode
+ * @param[in] entry Mode of compression
+ * @returns Description of mode
+ * */
+std::string CompressionProfile::Describe(const ProfileEntry &entry) {
+  std::stringstream sstream;
+  if (entry.tile_size == 0) {
+    sstream << "whole image";
+  }
+  else {
+    sstream << entry.tile_size << "x" << entry.tile_size << " tiles";
+  }
+  sstream << ", predictor " << TilePredictor::GetName(entry.predictor) << ", "
+    << CompressionProfile::GetScanningName(entry.scanning) << " scanning" << (entry.bwt_transform ? ", BWT" : "")
+    << ", " << (entry.static_huffman ? "static" : "adaptive") << " huffman";
+  if (entry.tile_size > 0) {
+    sstream << ", " << entry.threads << ((entry.threads == 1) ? " thread" : " threads");
+  }
+  return sstream.str();
+}
+
+/**
+ * Return modes of profile
+ * @returns Modes from the fastest to the best ratio
+ * */
+const std::vector<ProfileEntry> & CompressionProfile::GetEntries() {
+  return this->entries;
+}
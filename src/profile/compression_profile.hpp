@@ -0,0 +1,148 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: compression_profile.hpp
+ * Description: Contains definitions of CompressionProfile class, that holds Pareto-optimal modes
+ * of compression measured on corpus of images, saved to and loaded from text file
+ * */
+#ifndef __COMPRESSION_PROFILE__
+#define __COMPRESSION_PROFILE__
+
+#include <cstdint>  // uint8_t, uint32_t
+#include <string>   // string
+#include <sstream>  // stringstream
+#include <fstream>  // ifstream, ofstream
+#include <iostream> // cerr
+#include <vector>   // vector
+#include <algorithm> // sort
+#include <cmath>    // lround
+
+#include "../image_codec.hpp"
+#include "../tiles/tiles.hpp"
+#include "../tiles/tile_predictor.hpp"
+#include "../tiles/tile_workers.hpp"
+
+// First word and version of profile file, version 1 has no number of threads
+constexpr const char *PROFILE_MAGIC = "huff_codec-profile";
+constexpr uint8_t PROFILE_VERSION = 2;
+
+// Scanning of RLE, horizontal, the better of horizontal and vertical (-a), quadtree (-q)
+constexpr uint8_t PROFILE_SCANNING_HORIZONTAL = 0;
+constexpr uint8_t PROFILE_SCANNING_ADAPTIVE = 1;
+constexpr uint8_t PROFILE_SCANNING_QUADTREE = 2;
+constexpr uint8_t PROFILE_SCANNING_COUNT = 3;
+
+/**
+ * One mode of compression with its results on corpus
+ * @param tile_size Number of pixels in each direction of one tile, 0 to code whole image
+ * @param predictor Identifier of predictor, whole image can use only none or left (-m)
+ * @param scanning Scanning of RLE
+ * @param bwt_transform True to transform data by BWT (-b)
+ * @param static_huffman True to use static huffman code instead of adaptive
+ * @param threads Number of threads coding tiles, 1 for whole image
+ * @param ratio Size of raw corpus divided by size of compressed corpus
+ * @param compress_speed Compressed megabytes of raw corpus per second
+ * @param decompress_speed Decompressed megabytes of raw corpus per second
+ * */
+typedef struct ProfileEntry {
+  uint32_t tile_size;
+  uint8_t predictor;
+  uint8_t scanning;
+  bool bwt_transform;
+  bool static_huffman;
+  uint32_t threads;
+  double ratio;
+  double compress_speed;
+  double decompress_speed;
+} ProfileEntry;
+
+/**
+ * Class holding modes, that are not both slower and worse than other mode, ordered from the fastest
+ * to the best ratio, so level -1 to -9 can choose one of them
+ * */
+class CompressionProfile {
+private:
+  // Pareto-optimal modes from the fastest to the best ratio
+  std::vector<ProfileEntry> entries;
+
+  /**
+   * Return name of scanning
+   * @param[in] scanning Scanning of RLE
+   * @returns Name of scanning
+   * */
+  static std::string GetScanningName(const uint8_t &scanning);
+
+  /**
+   * Parse one line of profile file into mode
+   * @param[in] line Line of profile file
+   * @param[in] version Version of profile file
+   * @param[out] entry Parsed mode
+   * @returns True when line is valid mode, false otherwise
+   * */
+  static bool ParseEntry(const std::string &line, const uint32_t &version, ProfileEntry &entry);
+
+public:
+  /**
+   * Constructor of empty profile
+   * */
+  CompressionProfile();
+
+  /**
+   * Keep only Pareto-optimal modes by ratio and speed of compression
+   * @param[in] candidates Measured modes
+   * @returns Modes from the fastest to the best ratio
+   * */
+  static std::vector<ProfileEntry> ParetoFront(const std::vector<ProfileEntry> &candidates);
+
+  /**
+   * Set modes of profile, only Pareto-optimal of them are kept
+   * @param[in] candidates Measured modes
+   * */
+  void SetEntries(const std::vector<ProfileEntry> &candidates);
+
+  /**
+   * Load profile from file
+   * @param[in] filename Name of profile file
+   * @returns True when file is valid profile with at least one mode, false otherwise
+   * */
+  bool Load(const std::string &filename);
+
+  /**
+   * Save profile to file
+   * @param[in] filename Name of profile file
+   * @returns True when file was written, false otherwise
+   * */
+  bool Save(const std::string &filename);
+
+  /**
+   * Choose mode by compression level, -1 is the fastest mode, -9 mode with the best ratio
+   * and modes between are spread evenly
+   * @param[in] level Compression level 1 to 9, 0 for mode with the best ratio
+   * @returns Chosen mode
+   * */
+  const ProfileEntry & Select(const uint8_t &level);
+
+  /**
+   * Return settings of compression pipeline for mode, 2D predictor of tiles is replaced by -m,
+   * when image is not split into tiles
+   * @param[in] entry Mode of compression
+   * @param[in] settings Settings of compression pipeline, BWT block size and maximum error are kept
+   * @returns Settings of mode
+   * */
+  static CodecSettings GetSettings(const ProfileEntry &entry, const CodecSettings &settings);
+
+  /**
+   * Return human readable description of mode
+   * @param[in] entry Mode of compression
+   * @returns Description of mode
+   * */
+  static std::string Describe(const ProfileEntry &entry);
+
+  /**
+   * Return modes of profile
+   * @returns Modes from the fastest to the best ratio
+   * */
+  const std::vector<ProfileEntry> & GetEntries();
+};
+
+#endif
@@ -0,0 +1,32 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: progressive.hpp
+ * Description: Contains definitions of constant data for both progressive compressor and decompressor
+ * */
+#ifndef __PROGRESSIVE__
+#define __PROGRESSIVE__
+
+#include <cstdint>  // uint8_t
+
+// Constants used both in ProgressiveCompressor and ProgressiveDecompressor
+
+// Default number of levels of pyramid, including full resolution
+constexpr uint8_t PROGRESSIVE_DEFAULT_LEVELS = 4;
+
+// Maximum number of levels of pyramid
+constexpr uint8_t PROGRESSIVE_MAX_LEVELS = 16;
+
+// Number of bytes of width and height
+constexpr uint8_t PROGRESSIVE_VALUE_BYTES = 4;
+
+// Number of bytes of size of encoded level
+constexpr uint8_t PROGRESSIVE_SIZE_BYTES = 8;
+
+// Size of header, magic bytes followed by width, height, number of levels and maximum error of residuals
+constexpr uint8_t PROGRESSIVE_HEADER_SIZE = 4 + 2 * PROGRESSIVE_VALUE_BYTES + 2;
+
+// Size of one entry in level index, width, height and size of encoded level
+constexpr uint8_t PROGRESSIVE_INDEX_ENTRY_SIZE = 2 * PROGRESSIVE_VALUE_BYTES + PROGRESSIVE_SIZE_BYTES;
+
+#endif
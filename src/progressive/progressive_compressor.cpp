@@ -0,0 +1,173 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: progressive_compressor.cpp
+ * Description: Contains implementations of progressive compressor class that is used to compress
+ * image as pyramid of levels ordered from coarse to fine
+ * */
+#include "progressive_compressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor that will initialize values
+ * @param[in] buffer Image data
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * */
+ProgressiveCompressor::ProgressiveCompressor(const uint8_t *buffer, const uint32_t &width, const uint32_t &height) {
+  // Set image which we will be compressing
+  this->buffer = buffer;
+  this->width = width;
+  this->height = height;
+
+  // Set container data
+  this->encoded_buff = nullptr;
+  this->encoded_index = 0;
+}
+
+/**
+ * Deconstructor that will free allocated data
+ * */
+ProgressiveCompressor::~ProgressiveCompressor() {
+  // When buffer was allocated, free him
+  if (this->encoded_buff) {
+    free(this->encoded_buff);
+  }
+
+  // Remove pointer pointing to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Compress image as pyramid, levels stop early when coarsest level has one pixel
+ * @param[in] settings Settings of compression pipeline, coarsest level is coded with them, residuals
+ * of finer levels without difference of pixels and quantization
+ * @param[in] levels Number of levels, including full resolution
+ * @returns True when image was compressed, false when coarsest level could not be reconstructed
+ * */
+bool ProgressiveCompressor::Compress(const CodecSettings &settings, const uint8_t &levels) {
+  // Build pyramid from full resolution, each level is subsampled previous level
+  std::vector<std::vector<uint8_t>> pyramid(1, std::vector<uint8_t>(this->buffer, this->buffer + static_cast<size_t>(this->width) * this->height));
+  std::vector<uint32_t> widths = {this->width};
+  std::vector<uint32_t> heights = {this->height};
+  while (pyramid.size() < levels && (widths.back() > 1 || heights.back() > 1)) {
+    const uint32_t coarse_width = Pyramid::CoarserSize(widths.back());
+    const uint32_t coarse_height = Pyramid::CoarserSize(heights.back());
+
+    std::vector<uint8_t> coarse(static_cast<size_t>(coarse_width) * coarse_height);
+    Pyramid::Subsample(pyramid.back().data(), widths.back(), heights.back(), coarse.data());
+
+    pyramid.push_back(coarse);
+    widths.push_back(coarse_width);
+    heights.push_back(coarse_height);
+  }
+
+  // Residuals are already differences from prediction, quantized when near-lossless
+  CodecSettings residual_settings = settings;
+  residual_settings.input_preprocessing = false;
+  residual_settings.max_error = 0;
+
+  // Code levels from coarse to fine, coarsest level as image, finer levels as residuals of odd columns of even
+  // rows and residuals of odd rows, each of them as image, so their scanning follows rows and columns of level
+  const size_t level_count = pyramid.size();
+  std::deque<ImageCodec> codecs(level_count);
+  std::deque<ImageCodec> row_codecs(level_count);
+  std::vector<uint64_t> level_sizes(level_count);
+  std::vector<uint8_t> reconstructed;
+  uint64_t data_size = 0;
+  for (size_t i = 0; i < level_count; i++) {
+    const size_t level = level_count - 1 - i;
+    const uint32_t width = widths[level];
+    const uint32_t height = heights[level];
+    TraceSpan span("level", "block", {{"level", level}});
+
+    if (i == 0) {
+      codecs[i].Compress(pyramid[level].data(), width, height, settings, false);
+      level_sizes[i] = codecs[i].GetSize();
+
+      // Finer levels are predicted from coarsest level as decoder reconstructs it
+      reconstructed = pyramid[level];
+      if (settings.max_error > 0) {
+        ImageCodec decoder;
+        if (!decoder.Decompress(codecs[i].GetBuffer(), codecs[i].GetSize()) || decoder.GetSize() != reconstructed.size()) {
+          std::cerr << "Failed to reconstruct coarsest level of pyramid!" << std::endl;
+          return false;
+        }
+        reconstructed.assign(decoder.GetBuffer(), decoder.GetBuffer() + decoder.GetSize());
+      }
+    } else {
+      std::vector<uint8_t> columns(Pyramid::ColumnResiduals(width, height));
+      std::vector<uint8_t> rows(Pyramid::RowResiduals(width, height));
+      std::vector<uint8_t> fine(static_cast<size_t>(width) * height);
+      Pyramid::Encode(pyramid[level].data(), reconstructed.data(), width, height, settings.max_error, columns.data(), rows.data(), fine.data());
+      reconstructed.swap(fine);
+
+      // Level with single column or single row has no residuals of that kind
+      if (!columns.empty()) {
+        codecs[i].Compress(columns.data(), width / 2, Pyramid::CoarserSize(height), residual_settings, false);
+      }
+      if (!rows.empty()) {
+        row_codecs[i].Compress(rows.data(), width, height / 2, residual_settings, false);
+      }
+      level_sizes[i] = PROGRESSIVE_SIZE_BYTES + codecs[i].GetSize() + row_codecs[i].GetSize();
+    }
+
+    data_size += level_sizes[i];
+    span.AddArg("bytes", level_sizes[i]);
+  }
+
+  // Allocate buffer for header, level index and data of all levels
+  this->encoded_buff = (uint8_t *)malloc(sizeof(uint8_t) * (PROGRESSIVE_HEADER_SIZE + level_count * PROGRESSIVE_INDEX_ENTRY_SIZE + data_size));
+
+  // Invalid pointer
+  assert(this->encoded_buff != nullptr);
+
+  // Magic bytes of container
+  memcpy(this->encoded_buff, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC));
+  this->encoded_index = sizeof(CONTAINER_MAGIC);
+  this->encoded_buff[this->encoded_index++] = CONTAINER_PROGRESSIVE;
+
+  // Size of image, number of levels and maximum error of residuals
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->width, PROGRESSIVE_VALUE_BYTES);
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->height, PROGRESSIVE_VALUE_BYTES);
+  this->encoded_buff[this->encoded_index++] = level_count;
+  this->encoded_buff[this->encoded_index++] = settings.max_error;
+
+  // Level index, from coarse to fine
+  for (size_t i = 0; i < level_count; i++) {
+    const size_t level = level_count - 1 - i;
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, widths[level], PROGRESSIVE_VALUE_BYTES);
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, heights[level], PROGRESSIVE_VALUE_BYTES);
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, level_sizes[i], PROGRESSIVE_SIZE_BYTES);
+  }
+
+  // Encoded levels, from coarse to fine, finer levels start with size of residuals of columns
+  for (size_t i = 0; i < level_count; i++) {
+    if (i > 0) {
+      ByteIo::AppendValue(this->encoded_buff, this->encoded_index, codecs[i].GetSize(), PROGRESSIVE_SIZE_BYTES);
+    }
+    for (ImageCodec *codec : {&codecs[i], &row_codecs[i]}) {
+      if (codec->GetSize() > 0) {
+        memcpy(&this->encoded_buff[this->encoded_index], codec->GetBuffer(), codec->GetSize());
+        this->encoded_index += codec->GetSize();
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Return pointer to container buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & ProgressiveCompressor::GetBuffer() {
+  return this->encoded_buff;
+}
+
+/**
+ * Return container buffer size
+ * @returns Size of buffer
+ * */
+uint64_t & ProgressiveCompressor::GetSize() {
+  return this->encoded_index;
+}
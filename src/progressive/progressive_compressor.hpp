@@ -0,0 +1,74 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: progressive_compressor.hpp
+ * Description: Contains definitions of progressive compressor class that is used to compress
+ * image as pyramid of levels ordered from coarse to fine
+ * */
+#ifndef __PROGRESSIVE_COMPRESSOR__
+#define __PROGRESSIVE_COMPRESSOR__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstring>  // memcpy
+#include <vector>   // vector
+#include <deque>    // deque
+#include <cassert>  // assert
+
+#include "progressive.hpp"
+#include "pyramid.hpp"
+#include "../container.hpp"
+#include "../image_codec.hpp"
+
+/**
+ * Class that will compress image into resolution progressive container, coarsest level is coded
+ * on its own and each finer level codes only its pixels missing in coarser level, as difference
+ * from prediction by already coded pixels
+ * */
+class ProgressiveCompressor {
+private:
+  // Image which we will be compressing
+  const uint8_t *buffer;
+  uint32_t width;
+  uint32_t height;
+
+  // Resulting container
+  uint8_t *encoded_buff;
+  uint64_t encoded_index;
+
+public:
+  /**
+   * Constructor that will initialize values
+   * @param[in] buffer Image data
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * */
+  ProgressiveCompressor(const uint8_t *buffer, const uint32_t &width, const uint32_t &height);
+
+  /**
+   * Deconstructor that will free allocated data
+   * */
+  ~ProgressiveCompressor();
+
+  /**
+   * Compress image as pyramid, levels stop early when coarsest level has one pixel
+   * @param[in] settings Settings of compression pipeline, coarsest level is coded with them, residuals
+   * of finer levels without difference of pixels and quantization
+   * @param[in] levels Number of levels, including full resolution
+   * @returns True when image was compressed, false when coarsest level could not be reconstructed
+   * */
+  bool Compress(const CodecSettings &settings, const uint8_t &levels);
+
+  /**
+   * Return pointer to container buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return container buffer size
+   * @returns Size of buffer
+   * */
+  uint64_t & GetSize();
+};
+
+#endif
@@ -0,0 +1,248 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: progressive_decompressor.cpp
+ * Description: Contains implementations of progressive decompressor class that is used to decompress
+ * image from resolution progressive container, up to level that is available
+ * */
+#include "progressive_decompressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor for ProgressiveDecompressor that will initialize values
+ * @param[in] buffer Data buffer holding container
+ * @param[in] size Size of data buffer
+ * */
+ProgressiveDecompressor::ProgressiveDecompressor(uint8_t * &buffer, const uint64_t &size) {
+  // Receive buffer
+  this->buffer = buffer;
+  this->size = size;
+
+  // Initialize header values
+  this->width = 0;
+  this->height = 0;
+  this->level_count = 0;
+  this->max_error = 0;
+
+  // Initialize decompressed image
+  this->image_width = 0;
+  this->image_height = 0;
+}
+
+/**
+ * Deconstructor
+ * */
+ProgressiveDecompressor::~ProgressiveDecompressor() {
+  // Destroy pointer to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Decompress residuals of finer level, coded as image
+ * @param[in] position Position of encoded residuals
+ * @param[in] size Size of encoded residuals, 0 when level has no residuals of that kind
+ * @param[in] count Expected number of residuals
+ * @param[out] residuals Decompressed residuals
+ * @returns True when expected number of residuals was decompressed, false otherwise
+ * */
+bool ProgressiveDecompressor::DecompressResiduals(const uint64_t &position, const uint64_t &size, const size_t &count, std::vector<uint8_t> &residuals) {
+  if (count == 0) {
+    return (size == 0);
+  }
+
+  ImageCodec codec;
+  if (!codec.Decompress(&this->buffer[position], size) || codec.GetSize() != count) {
+    return false;
+  }
+  residuals.assign(codec.GetBuffer(), codec.GetBuffer() + count);
+  return true;
+}
+
+/**
+ * Read header and level index, encoded levels may be missing
+ * @returns True when header is valid, false otherwise
+ * */
+bool ProgressiveDecompressor::ReadHeader() {
+  // Check magic bytes and size of header
+  if (!IsContainer(this->buffer, this->size, CONTAINER_PROGRESSIVE) || this->size < PROGRESSIVE_HEADER_SIZE) {
+    std::cerr << "Data are not resolution progressive image!" << std::endl;
+    return false;
+  }
+
+  // Load size of image, number of levels and maximum error of residuals
+  this->width = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE, PROGRESSIVE_VALUE_BYTES);
+  this->height = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE + PROGRESSIVE_VALUE_BYTES, PROGRESSIVE_VALUE_BYTES);
+  this->level_count = this->buffer[CONTAINER_MAGIC_SIZE + 2 * PROGRESSIVE_VALUE_BYTES];
+  this->max_error = this->buffer[CONTAINER_MAGIC_SIZE + 2 * PROGRESSIVE_VALUE_BYTES + 1];
+  if (this->level_count == 0) {
+    std::cerr << "Progressive image has no levels!" << std::endl;
+    return false;
+  }
+
+  // Level index may not be loaded yet
+  if (this->GetIndexEnd() > this->size) {
+    return true;
+  }
+
+  // Load level index, each finer level is twice the size of coarser level
+  uint64_t position = PROGRESSIVE_HEADER_SIZE;
+  for (uint8_t i = 0; i < this->level_count; i++) {
+    this->widths.push_back(ByteIo::ReadValue(this->buffer, position, PROGRESSIVE_VALUE_BYTES));
+    this->heights.push_back(ByteIo::ReadValue(this->buffer, position + PROGRESSIVE_VALUE_BYTES, PROGRESSIVE_VALUE_BYTES));
+    this->sizes.push_back(ByteIo::ReadValue(this->buffer, position + 2 * PROGRESSIVE_VALUE_BYTES, PROGRESSIVE_SIZE_BYTES));
+    position += PROGRESSIVE_INDEX_ENTRY_SIZE;
+
+    if (i > 0 && (Pyramid::CoarserSize(this->widths[i]) != this->widths[i - 1] ||
+      Pyramid::CoarserSize(this->heights[i]) != this->heights[i - 1]))
+    {
+      std::cerr << "Invalid size of level " << static_cast<uint32_t>(i) << "!" << std::endl;
+      return false;
+    }
+  }
+
+  // Finest level has size of image
+  if (this->widths.back() != this->width || this->heights.back() != this->height) {
+    std::cerr << "Finest level does not have size of image!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Return number of bytes needed for reading header with level index
+ * @returns Size of header and level index, 0 when header was not read
+ * */
+uint64_t ProgressiveDecompressor::GetIndexEnd() {
+  return PROGRESSIVE_HEADER_SIZE + static_cast<uint64_t>(this->level_count) * PROGRESSIVE_INDEX_ENTRY_SIZE;
+}
+
+/**
+ * Return number of bytes from start of container, that are needed for decompressing given level
+ * @param[in] level Number of halvings of full resolution, 0 for full resolution
+ * @returns Size of header, level index and encoded levels up to given level
+ * */
+uint64_t ProgressiveDecompressor::GetLevelEnd(const uint8_t &level) {
+  uint64_t end = this->GetIndexEnd();
+
+  // Levels are saved from coarse to fine, sum levels up to given one, but at least coarsest level
+  for (size_t i = 0; i < this->sizes.size() && (i == 0 || (i + level) < this->sizes.size()); i++) {
+    end += this->sizes[i];
+  }
+  return end;
+}
+
+/**
+ * Decompress levels from coarse to fine, until given level or until level that is not loaded
+ * @param[in] level Number of halvings of full resolution, 0 for full resolution
+ * @returns True when at least coarsest level was decompressed, false otherwise
+ * */
+bool ProgressiveDecompressor::Decompress(const uint8_t &level) {
+  // Level index needs to be loaded
+  if (this->sizes.empty()) {
+    std::cerr << "Container does not contain level index!" << std::endl;
+    return false;
+  }
+
+  uint64_t position = this->GetIndexEnd();
+  for (size_t i = 0; i < this->sizes.size() && (i == 0 || (i + level) < this->sizes.size()); i++) {
+    // Level is not loaded, keep coarser image
+    if (this->sizes[i] > (this->size - position)) {
+      break;
+    }
+
+    TraceSpan span("level decode", "block", {{"level", this->sizes.size() - 1 - i}, {"bytes", this->sizes[i]}});
+    const uint32_t width = this->widths[i];
+    const uint32_t height = this->heights[i];
+    const uint64_t level_size = static_cast<uint64_t>(width) * height;
+    std::vector<uint8_t> pixels;
+
+    // Decompress coarsest level and check its size
+    if (i == 0) {
+      ImageCodec codec;
+      if (!codec.Decompress(&this->buffer[position], this->sizes[i]) || codec.GetSize() != level_size) {
+        std::cerr << "Failed to decompress level " << i << "!" << std::endl;
+        return false;
+      }
+      pixels.assign(codec.GetBuffer(), codec.GetBuffer() + level_size);
+    // Finer level, residuals of columns and of rows follow size of residuals of columns
+    } else {
+      const uint64_t columns_size = (this->sizes[i] >= PROGRESSIVE_SIZE_BYTES) ? ByteIo::ReadValue(this->buffer, position, PROGRESSIVE_SIZE_BYTES) : UINT64_MAX;
+      std::vector<uint8_t> columns;
+      std::vector<uint8_t> rows;
+      if (columns_size > (this->sizes[i] - PROGRESSIVE_SIZE_BYTES) ||
+        !this->DecompressResiduals(position + PROGRESSIVE_SIZE_BYTES, columns_size, Pyramid::ColumnResiduals(width, height), columns) ||
+        !this->DecompressResiduals(position + PROGRESSIVE_SIZE_BYTES + columns_size, this->sizes[i] - PROGRESSIVE_SIZE_BYTES - columns_size,
+          Pyramid::RowResiduals(width, height), rows))
+      {
+        std::cerr << "Failed to decompress level " << i << "!" << std::endl;
+        return false;
+      }
+
+      // Pixels of coarser level are kept, missing pixels are prediction with residual
+      pixels.resize(level_size);
+      Pyramid::Decode(this->image.data(), columns.data(), rows.data(), width, height, this->max_error, pixels.data());
+    }
+    position += this->sizes[i];
+
+    this->image.swap(pixels);
+    this->image_width = width;
+    this->image_height = height;
+  }
+
+  // Not even coarsest level was loaded
+  if (this->image_width == 0) {
+    std::cerr << "Container does not contain coarsest level!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Return width of decompressed image
+ * @returns Width of image
+ * */
+uint32_t ProgressiveDecompressor::GetWidth() {
+  return this->image_width;
+}
+
+/**
+ * Return height of decompressed image
+ * @returns Height of image
+ * */
+uint32_t ProgressiveDecompressor::GetHeight() {
+  return this->image_height;
+}
+
+/**
+ * Return whether decompressed image has full resolution
+ * @returns True when finest level was decompressed, false otherwise
+ * */
+bool ProgressiveDecompressor::IsFullResolution() {
+  return (this->image_width == this->width && this->image_height == this->height);
+}
+
+/**
+ * Return pointer to decompressed image
+ * @returns Pointer to buffer
+ * */
+uint8_t * ProgressiveDecompressor::GetBuffer() {
+  return this->image.data();
+}
+
+/**
+ * Return size of decompressed image
+ * @returns Size of buffer
+ * */
+uint64_t ProgressiveDecompressor::GetSize() {
+  return this->image.size();
+}
+
+/**
+ * Return maximum error of each pixel of decompressed image, saved in header
+ * @returns Maximum error, 0 for lossless image
+ * */
+uint8_t ProgressiveDecompressor::GetMaxError() {
+  return this->max_error;
+}
@@ -0,0 +1,133 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: progressive_decompressor.hpp
+ * Description: Contains definitions of progressive decompressor class that is used to decompress
+ * image from resolution progressive container, up to level that is available
+ * */
+#ifndef __PROGRESSIVE_DECOMPRESSOR__
+#define __PROGRESSIVE_DECOMPRESSOR__
+
+#include <iostream> // cerr
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <vector>   // vector
+
+#include "progressive.hpp"
+#include "pyramid.hpp"
+#include "../container.hpp"
+#include "../image_codec.hpp"
+
+/**
+ * Class used for decompressing levels of pyramid from coarse to fine, any prefix of container
+ * with header and level index decompresses to coarser image
+ * */
+class ProgressiveDecompressor {
+private:
+  // Buffer that holds loaded container, or only its start
+  uint8_t *buffer;
+  // Size of loaded data
+  uint64_t size;
+
+  // Size of image, number of levels and maximum error of residuals
+  uint32_t width;
+  uint32_t height;
+  uint8_t level_count;
+  uint8_t max_error;
+
+  // Size of each level and size of its encoded data, from coarse to fine
+  std::vector<uint32_t> widths;
+  std::vector<uint32_t> heights;
+  std::vector<uint64_t> sizes;
+
+  // Decompressed image of finest decompressed level
+  std::vector<uint8_t> image;
+  uint32_t image_width;
+  uint32_t image_height;
+
+  /**
+   * Decompress residuals of finer level, coded as image
+   * @param[in] position Position of encoded residuals
+   * @param[in] size Size of encoded residuals, 0 when level has no residuals of that kind
+   * @param[in] count Expected number of residuals
+   * @param[out] residuals Decompressed residuals
+   * @returns True when expected number of residuals was decompressed, false otherwise
+   * */
+  bool DecompressResiduals(const uint64_t &position, const uint64_t &size, const size_t &count, std::vector<uint8_t> &residuals);
+
+public:
+  /**
+   * Constructor for ProgressiveDecompressor that will initialize values
+   * @param[in] buffer Data buffer holding container
+   * @param[in] size Size of data buffer
+   * */
+  ProgressiveDecompressor(uint8_t * &buffer, const uint64_t &size);
+
+  /**
+   * Deconstructor
+   * */
+  ~ProgressiveDecompressor();
+
+  /**
+   * Read header and level index, encoded levels may be missing
+   * @returns True when header is valid, false otherwise
+   * */
+  bool ReadHeader();
+
+  /**
+   * Return number of bytes needed for reading header with level index
+   * @returns Size of header and level index, 0 when header was not read
+   * */
+  uint64_t GetIndexEnd();
+
+  /**
+   * Return number of bytes from start of container, that are needed for decompressing given level
+   * @param[in] level Number of halvings of full resolution, 0 for full resolution
+   * @returns Size of header, level index and encoded levels up to given level
+   * */
+  uint64_t GetLevelEnd(const uint8_t &level);
+
+  /**
+   * Decompress levels from coarse to fine, until given level or until level that is not loaded
+   * @param[in] level Number of halvings of full resolution, 0 for full resolution
+   * @returns True when at least coarsest level was decompressed, false otherwise
+   * */
+  bool Decompress(const uint8_t &level);
+
+  /**
+   * Return width of decompressed image
+   * @returns Width of image
+   * */
+  uint32_t GetWidth();
+
+  /**
+   * Return height of decompressed image
+   * @returns Height of image
+   * */
+  uint32_t GetHeight();
+
+  /**
+   * Return whether decompressed image has full resolution
+   * @returns True when finest level was decompressed, false otherwise
+   * */
+  bool IsFullResolution();
+
+  /**
+   * Return pointer to decompressed image
+   * @returns Pointer to buffer
+   * */
+  uint8_t * GetBuffer();
+
+  /**
+   * Return size of decompressed image
+   * @returns Size of buffer
+   * */
+  uint64_t GetSize();
+
+  /**
+   * Return maximum error of each pixel of decompressed image, saved in header
+   * @returns Maximum error, 0 for lossless image
+   * */
+  uint8_t GetMaxError();
+};
+
+#endif
@@ -0,0 +1,230 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: pyramid.cpp
+ * Description: Contains implementations of Pyramid class, that is used to build levels of
+ * resolution pyramid and predict finer level from coarser one
+ * */
+#include "pyramid.hpp"
+
+/**
+ * Return residual of pixel against prediction, near-lossless residual is quantized
+ * @param[in] value Value of pixel
+ * @param[in] prediction Prediction of pixel
+ * @param[in] max_error Maximum error of pixel, 0 for lossless
+ * @param[out] reconstructed Value of pixel, as decoder will reconstruct it
+ * @returns Residual
+ * */
+uint8_t Pyramid::Residual(const uint8_t &value, const uint8_t &prediction, const uint8_t &max_error, uint8_t &reconstructed) {
+  // Lossless residual wraps around, so it fits into 8 bits
+  if (max_error == 0) {
+    reconstructed = value;
+    return static_cast<uint8_t>(value - prediction);
+  }
+
+  // Round difference to the nearest multiple of step, the same way as near-lossless preprocessing
+  const int32_t step = (2 * max_error + 1);
+  const int32_t error = value - prediction;
+  const int32_t quantized = (error >= 0) ? ((error + max_error) / step) : -((max_error - error) / step);
+  reconstructed = static_cast<uint8_t>(std::min(std::max(prediction + quantized * step, 0), 0xFF));
+  return static_cast<uint8_t>(quantized);
+}
+
+/**
+ * Return pixel reconstructed from residual and prediction
+ * @param[in] residual Residual of pixel
+ * @param[in] prediction Prediction of pixel
+ * @param[in] max_error Maximum error of pixel, 0 for lossless
+ * @returns Value of pixel
+ * */
+uint8_t Pyramid::Reconstruct(const uint8_t &residual, const uint8_t &prediction, const uint8_t &max_error) {
+  if (max_error == 0) {
+    return static_cast<uint8_t>(prediction + residual);
+  }
+
+  const int32_t step = (2 * max_error + 1);
+  return static_cast<uint8_t>(std::min(std::max(prediction + static_cast<int8_t>(residual) * step, 0), 0xFF));
+}
+
+/**
+ * Return prediction of pixel between two known pixels, second one is missing on edges
+ * @param[in] first Known pixel on the left or above
+ * @param[in] second Pointer to known pixel on the right or below, nullptr on edge
+ * @returns Prediction of pixel
+ * */
+uint8_t Pyramid::Interpolate(const uint8_t &first, const uint8_t *second) {
+  if (second == nullptr) {
+    return first;
+  }
+  return ((first + *second + 1) / 2);
+}
+
+/**
+ * Return prediction of pixel of odd row, by median edge detector of left pixel and of interpolation of rows above
+ * and below, so runs of row continue even when rows above and below differ
+ * @param[in] above Reconstructed row above
+ * @param[in] below Reconstructed row below, nullptr on bottom edge
+ * @param[in] row Reconstructed pixels of row left of pixel
+ * @param[in] x Column of pixel
+ * @returns Prediction of pixel
+ * */
+uint8_t Pyramid::Predict(const uint8_t *above, const uint8_t *below, const uint8_t *row, const uint32_t &x) {
+  const int32_t vertical = Interpolate(above[x], (below != nullptr) ? &below[x] : nullptr);
+  if (x == 0) {
+    return vertical;
+  }
+
+  const int32_t left = row[x - 1];
+  const int32_t corner = Interpolate(above[x - 1], (below != nullptr) ? &below[x - 1] : nullptr);
+  if (corner >= std::max(left, vertical)) {
+    return std::min(left, vertical);
+  }
+  if (corner <= std::min(left, vertical)) {
+    return std::max(left, vertical);
+  }
+  return (left + vertical - corner);
+}
+
+/**
+ * Return size of coarser level, each pixel of coarser level covers 2x2 block
+ * @param[in] size Width or height of finer level
+ * @returns Width or height of coarser level
+ * */
+uint32_t Pyramid::CoarserSize(const uint32_t &size) {
+  return (size / 2) + (size % 2);
+}
+
+/**
+ * Return number of residuals of odd columns of even rows of finer level
+ * @param[in] width Width of finer level
+ * @param[in] height Height of finer level
+ * @returns Number of residuals, residuals form image of width / 2 columns and CoarserSize(height) rows
+ * */
+size_t Pyramid::ColumnResiduals(const uint32_t &width, const uint32_t &height) {
+  return static_cast<size_t>(width / 2) * CoarserSize(height);
+}
+
+/**
+ * Return number of residuals of odd rows of finer level
+ * @param[in] width Width of finer level
+ * @param[in] height Height of finer level
+ * @returns Number of residuals, residuals form image of width columns and height / 2 rows
+ * */
+size_t Pyramid::RowResiduals(const uint32_t &width, const uint32_t &height) {
+  return static_cast<size_t>(width) * (height / 2);
+}
+
+/**
+ * Take every second pixel of every second row of finer level
+ * @param[in] fine Finer level
+ * @param[in] width Width of finer level
+ * @param[in] height Height of finer level
+ * @param[out] coarse Coarser level, with size given by CoarserSize
+ * */
+void Pyramid::Subsample(const uint8_t *fine, const uint32_t &width, const uint32_t &height, uint8_t *coarse) {
+  const uint32_t coarse_width = CoarserSize(width);
+  for (uint32_t y = 0; y < height; y += 2) {
+    const uint8_t *row = &fine[static_cast<size_t>(y) * width];
+    uint8_t *output = &coarse[static_cast<size_t>(y / 2) * coarse_width];
+    for (uint32_t x = 0; x < width; x += 2) {
+      output[x / 2] = row[x];
+    }
+  }
+}
+
+/**
+ * Code pixels of finer level missing in coarser level as residuals against prediction from reconstructed
+ * pixels, so near-lossless error of each pixel stays within maximum error through all levels
+ * @param[in] fine Finer level
+ * @param[in] coarse Coarser level, as decoder reconstructs it
+ * @param[in] width Width of finer level
+ * @param[in] height Height of finer level
+ * @param[in] max_error Maximum error of pixel, 0 for lossless
+ * @param[out] columns Residuals of odd columns of even rows, ColumnResiduals of them
+ * @param[out] rows Residuals of odd rows, RowResiduals of them
+ * @param[out] reconstructed Finer level, as decoder reconstructs it
+ * */
+void Pyramid::Encode(
+  const uint8_t *fine,
+  const uint8_t *coarse,
+  const uint32_t &width,
+  const uint32_t &height,
+  const uint8_t &max_error,
+  uint8_t *columns,
+  uint8_t *rows,
+  uint8_t *reconstructed
+) {
+  const uint32_t coarse_width = CoarserSize(width);
+
+  // Even rows, pixels of coarser level are kept, odd columns are predicted from their left and right neighbours
+  size_t index = 0;
+  for (uint32_t y = 0; y < height; y += 2) {
+    const uint8_t *input = &fine[static_cast<size_t>(y) * width];
+    uint8_t *output = &reconstructed[static_cast<size_t>(y) * width];
+    for (uint32_t x = 0; x < width; x += 2) {
+      output[x] = coarse[static_cast<size_t>(y / 2) * coarse_width + (x / 2)];
+    }
+    for (uint32_t x = 1; x < width; x += 2) {
+      const uint8_t prediction = Interpolate(output[x - 1], ((x + 1) < width) ? &output[x + 1] : nullptr);
+      columns[index++] = Residual(input[x], prediction, max_error, output[x]);
+    }
+  }
+
+  // Odd rows are predicted from complete even rows above and below them
+  index = 0;
+  for (uint32_t y = 1; y < height; y += 2) {
+    const uint8_t *input = &fine[static_cast<size_t>(y) * width];
+    const uint8_t *above = &reconstructed[static_cast<size_t>(y - 1) * width];
+    const uint8_t *below = ((y + 1) < height) ? &reconstructed[static_cast<size_t>(y + 1) * width] : nullptr;
+    uint8_t *output = &reconstructed[static_cast<size_t>(y) * width];
+    for (uint32_t x = 0; x < width; x++) {
+      rows[index++] = Residual(input[x], Predict(above, below, output, x), max_error, output[x]);
+    }
+  }
+}
+
+/**
+ * Reconstruct finer level from coarser level and residuals
+ * @param[in] coarse Coarser level
+ * @param[in] columns Residuals of odd columns of even rows
+ * @param[in] rows Residuals of odd rows
+ * @param[in] width Width of finer level
+ * @param[in] height Height of finer level
+ * @param[in] max_error Maximum error of pixel, 0 for lossless
+ * @param[out] fine Finer level
+ * */
+void Pyramid::Decode(
+  const uint8_t *coarse,
+  const uint8_t *columns,
+  const uint8_t *rows,
+  const uint32_t &width,
+  const uint32_t &height,
+  const uint8_t &max_error,
+  uint8_t *fine
+) {
+  const uint32_t coarse_width = CoarserSize(width);
+
+  // Even rows, in the same order as they were coded
+  size_t index = 0;
+  for (uint32_t y = 0; y < height; y += 2) {
+    uint8_t *output = &fine[static_cast<size_t>(y) * width];
+    for (uint32_t x = 0; x < width; x += 2) {
+      output[x] = coarse[static_cast<size_t>(y / 2) * coarse_width + (x / 2)];
+    }
+    for (uint32_t x = 1; x < width; x += 2) {
+      const uint8_t prediction = Interpolate(output[x - 1], ((x + 1) < width) ? &output[x + 1] : nullptr);
+      output[x] = Reconstruct(columns[index++], prediction, max_error);
+    }
+  }
+
+  // Odd rows
+  index = 0;
+  for (uint32_t y = 1; y < height; y += 2) {
+    const uint8_t *above = &fine[static_cast<size_t>(y - 1) * width];
+    const uint8_t *below = ((y + 1) < height) ? &fine[static_cast<size_t>(y + 1) * width] : nullptr;
+    uint8_t *output = &fine[static_cast<size_t>(y) * width];
+    for (uint32_t x = 0; x < width; x++) {
+      output[x] = Reconstruct(rows[index++], Predict(above, below, output, x), max_error);
+    }
+  }
+}
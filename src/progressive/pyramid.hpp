@@ -0,0 +1,140 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: pyramid.hpp
+ * Description: Contains definitions of Pyramid class, that is used to build levels of
+ * resolution pyramid and predict finer level from coarser one
+ * */
+#ifndef __PYRAMID__
+#define __PYRAMID__
+
+#include <cstdint>  // uint8_t, uint32_t, int32_t
+#include <cstddef>  // size_t
+#include <algorithm> // min, max
+
+/**
+ * Class with operations shared by progressive compressor and decompressor, both need
+ * exactly the same prediction, so residuals are reversed without loss
+ *
+ * Coarser level holds every second pixel of every second row of finer level, so pixels are not
+ * stored twice, finer level codes only remaining pixels, first odd columns of even rows predicted
+ * from their left and right neighbours, then odd rows predicted from rows above and below
+ * */
+class Pyramid {
+private:
+  /**
+   * Return residual of pixel against prediction, near-lossless residual is quantized
+   * @param[in] value Value of pixel
+   * @param[in] prediction Prediction of pixel
+   * @param[in] max_error Maximum error of pixel, 0 for lossless
+   * @param[out] reconstructed Value of pixel, as decoder will reconstruct it
+   * @returns Residual
+   * */
+  static uint8_t Residual(const uint8_t &value, const uint8_t &prediction, const uint8_t &max_error, uint8_t &reconstructed);
+
+  /**
+   * Return pixel reconstructed from residual and prediction
+   * @param[in] residual Residual of pixel
+   * @param[in] prediction Prediction of pixel
+   * @param[in] max_error Maximum error of pixel, 0 for lossless
+   * @returns Value of pixel
+   * */
+  static uint8_t Reconstruct(const uint8_t &residual, const uint8_t &prediction, const uint8_t &max_error);
+
+  /**
+   * Return prediction of pixel between two known pixels, second one is missing on edges
+   * @param[in] first Known pixel on the left or above
+   * @param[in] second Pointer to known pixel on the right or below, nullptr on edge
+   * @returns Prediction of pixel
+   * */
+  static uint8_t Interpolate(const uint8_t &first, const uint8_t *second);
+
+  /**
+   * Return prediction of pixel of odd row, by median edge detector of left pixel and of interpolation of rows above
+   * and below, so runs of row continue even when rows above and below differ
+   * @param[in] above Reconstructed row above
+   * @param[in] below Reconstructed row below, nullptr on bottom edge
+   * @param[in] row Reconstructed pixels of row left of pixel
+   * @param[in] x Column of pixel
+   * @returns Prediction of pixel
+   * */
+  static uint8_t Predict(const uint8_t *above, const uint8_t *below, const uint8_t *row, const uint32_t &x);
+
+public:
+  /**
+   * Return size of coarser level, each pixel of coarser level covers 2x2 block
+   * @param[in] size Width or height of finer level
+   * @returns Width or height of coarser level
+   * */
+  static uint32_t CoarserSize(const uint32_t &size);
+
+  /**
+   * Return number of residuals of odd columns of even rows of finer level
+   * @param[in] width Width of finer level
+   * @param[in] height Height of finer level
+   * @returns Number of residuals, residuals form image of width / 2 columns and CoarserSize(height) rows
+   * */
+  static size_t ColumnResiduals(const uint32_t &width, const uint32_t &height);
+
+  /**
+   * Return number of residuals of odd rows of finer level
+   * @param[in] width Width of finer level
+   * @param[in] height Height of finer level
+   * @returns Number of residuals, residuals form image of width columns and height / 2 rows
+   * */
+  static size_t RowResiduals(const uint32_t &width, const uint32_t &height);
+
+  /**
+   * Take every second pixel of every second row of finer level
+   * @param[in] fine Finer level
+   * @param[in] width Width of finer level
+   * @param[in] height Height of finer level
+   * @param[out] coarse Coarser level, with size given by CoarserSize
+   * */
+  static void Subsample(const uint8_t *fine, const uint32_t &width, const uint32_t &height, uint8_t *coarse);
+
+  /**
+   * Code pixels of finer level missing in coarser level as residuals against prediction from reconstructed
+   * pixels, so near-lossless error of each pixel stays within maximum error through all levels
+   * @param[in] fine Finer level
+   * @param[in] coarse Coarser level, as decoder reconstructs it
+   * @param[in] width Width of finer level
+   * @param[in] height Height of finer level
+   * @param[in] max_error Maximum error of pixel, 0 for lossless
+   * @param[out] columns Residuals of odd columns of even rows, ColumnResiduals of them
+   * @param[out] rows Residuals of odd rows, RowResiduals of them
+   * @param[out] reconstructed Finer level, as decoder reconstructs it
+   * */
+  static void Encode(
+    const uint8_t *fine,
+    const uint8_t *coarse,
+    const uint32_t &width,
+    const uint32_t &height,
+    const uint8_t &max_error,
+    uint8_t *columns,
+    uint8_t *rows,
+    uint8_t *reconstructed
+  );
+
+  /**
+   * Reconstruct finer level from coarser level and residuals
+   * @param[in] coarse Coarser level
+   * @param[in] columns Residuals of odd columns of even rows
+   * @param[in] rows Residuals of odd rows
+   * @param[in] width Width of finer level
+   * @param[in] height Height of finer level
+   * @param[in] max_error Maximum error of pixel, 0 for lossless
+   * @param[out] fine Finer level
+   * */
+  static void Decode(
+    const uint8_t *coarse,
+    const uint8_t *columns,
+    const uint8_t *rows,
+    const uint32_t &width,
+    const uint32_t &height,
+    const uint8_t &max_error,
+    uint8_t *fine
+  );
+};
+
+#endif
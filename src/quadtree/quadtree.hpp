@@ -0,0 +1,32 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: quadtree.hpp
+ * Description: Contains definitions of constant data for both quadtree compressor and decompressor
+ * */
+#ifndef __QUADTREE__
+#define __QUADTREE__
+
+#include <cstdint>  // uint8_t
+
+// Constants used both in QuadtreeCompressor and QuadtreeDecompressor
+
+// Bit in settings byte (before huffman data), representing that image was coded with quadtree
+constexpr uint8_t QUADTREE_SETTINGS_BIT = 0x20;
+
+// Bit of quadtree settings byte representing if -m was used
+constexpr uint8_t QUADTREE_MODEL_MASK = 0b01000000;
+
+// Bits of quadtree settings byte representing log2 of smallest block size
+constexpr uint8_t QUADTREE_BLOCK_MASK = 0b00011111;
+
+// Log2 of smallest block, that is not divided any further (8x8 pixels)
+constexpr uint8_t QUADTREE_MIN_BLOCK_LOG = 3;
+
+// Number of bytes used for saving sizes and counters in quadtree header
+constexpr uint8_t QUADTREE_VALUE_BYTES = 4;
+
+// Size of quadtree header, settings byte, width, height, node count, uniform count
+constexpr uint8_t QUADTREE_HEADER_SIZE = 1 + 4 * QUADTREE_VALUE_BYTES;
+
+#endif
@@ -0,0 +1,222 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: quadtree_compressor.cpp
+ * Description: Contains implementations of quadtree compressor class that is used to code
+ * uniform blocks of image as single value and pass only remaining blocks to RLE
+ * */
+#include "quadtree_compressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor that will initialize values
+ * @param[in] buffer Buffer representing image data
+ * @param[in] width Width of image in buffer
+ * @param[in] height Height of image in buffer
+ * */
+QuadtreeCompressor::QuadtreeCompressor(
+  const uint8_t *buffer,
+  const uint32_t &width,
+  const uint32_t &height
+) {
+  // Set image which we will be coding
+  this->buffer = buffer;
+  this->width = width;
+  this->height = height;
+  this->node_count = 0;
+
+  // Set buffers
+  this->leaf_buff = nullptr;
+  this->leaf_index = 0;
+  this->encoded_buff = nullptr;
+  this->encoded_index = 0;
+}
+
+/**
+ * Deconstructor that will free allocated data
+ * */
+QuadtreeCompressor::~QuadtreeCompressor() {
+  // When buffers were allocated, free them
+  if (this->leaf_buff) {
+    free(this->leaf_buff);
+  }
+
+  if (this->encoded_buff) {
+    free(this->encoded_buff);
+  }
+
+  // Remove pointer pointing to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Add one bit of tree
+ * @param[in] bit Value of bit
+ * */
+void QuadtreeCompressor::AddBit(const bool &bit) {
+  // Start new byte every 8 bits
+  if ((this->node_count % UINT8_T_SIZE) == 0) {
+    this->tree_bits.push_back(0);
+  }
+
+  if (bit) {
+    this->tree_bits.back() |= (1 << (this->node_count % UINT8_T_SIZE));
+  }
+
+  this->node_count++;
+}
+
+/**
+ * Append value to buffer as QUADTREE_VALUE_BYTES bytes, most significant byte first
+ * @param[in] val Value to be added to buffer
+ * */
+void QuadtreeCompressor::AppendValue(const uint32_t &val) {
+  ByteIo::WriteValue(&this->encoded_buff[this->encoded_index], val, QUADTREE_VALUE_BYTES);
+  this->encoded_index += QUADTREE_VALUE_BYTES;
+}
+
+/**
+ * Check if all pixels of block are the same
+ * @param[in] x Left column of block
+ * @param[in] y Top row of block
+ * @param[in] w Width of block
+ * @param[in] h Height of block
+ * @returns True when block is uniform, false otherwise
+ * */
+bool QuadtreeCompressor::IsUniform(
+  const size_t &x,
+  const size_t &y,
+  const size_t &w,
+  const size_t &h
+) {
+  const uint8_t pixel = this->buffer[y * this->width + x];
+
+  // Compare each row with the first pixel, stop at first difference
+  for (size_t row = y; row < (y + h); row++) {
+    const uint8_t *line = &this->buffer[row * this->width + x];
+    for (size_t i = 0; i < w; i++) {
+      if (line[i] != pixel) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Code block, when uniform save its value, otherwise divide it into 4 blocks,
+ * or save its pixels when it is the smallest block
+ * @param[in] x Left column of block
+ * @param[in] y Top row of block
+ * @param[in] block_log Log2 of block size
+ * */
+void QuadtreeCompressor::Subdivide(const size_t &x, const size_t &y, const uint8_t &block_log) {
+  // Block lying completely outside of image is not coded at all
+  if (x >= this->width || y >= this->height) {
+    return;
+  }
+
+  // Clip block to image
+  const size_t size = (static_cast<size_t>(1) << block_log);
+  const size_t w = ((x + size) > this->width) ? (this->width - x) : size;
+  const size_t h = ((y + size) > this->height) ? (this->height - y) : size;
+
+  // Uniform block is saved as one value
+  if (this->IsUniform(x, y, w, h)) {
+    this->AddBit(true);
+    this->uniform_values.push_back(this->buffer[y * this->width + x]);
+    return;
+  }
+
+  this->AddBit(false);
+
+  // Smallest block, save its pixels row by row for RLE
+  if (block_log <= QUADTREE_MIN_BLOCK_LOG) {
+    for (size_t row = y; row < (y + h); row++) {
+      memcpy(&this->leaf_buff[this->leaf_index], &this->buffer[row * this->width + x], w);
+      this->leaf_index += w;
+    }
+    return;
+  }
+
+  // Divide block into 4 blocks, top left, top right, bottom left, bottom right
+  const size_t half = (size >> 1);
+  const uint8_t half_log = (block_log - 1);
+  this->Subdivide(x, y, half_log);
+  this->Subdivide(x + half, y, half_log);
+  this->Subdivide(x, y + half, half_log);
+  this->Subdivide(x + half, y + half, half_log);
+}
+
+/**
+ * Code image with quadtree, and compress pixels of non uniform blocks with RLE
+ * @param[in] input_preprocessing True when image was preprocessed, false otherwise
+ * */
+void QuadtreeCompressor::Compress(const bool &input_preprocessing) {
+  // Non uniform blocks may hold whole image
+  this->leaf_buff = (uint8_t *)malloc(sizeof(uint8_t) * (this->width * this->height + 1));
+
+  // Invalid pointer
+  assert(this->leaf_buff != nullptr);
+
+  // Find size of root block, that covers whole image
+  uint8_t root_log = QUADTREE_MIN_BLOCK_LOG;
+  while ((static_cast<size_t>(1) << root_log) < this->width || (static_cast<size_t>(1) << root_log) < this->height) {
+    root_log++;
+  }
+
+  // Code whole image
+  if (this->width > 0 && this->height > 0) {
+    this->Subdivide(0, 0, root_log);
+  }
+
+  // Compress pixels of non uniform blocks as one row of image
+  RleCompressor rle_compressor(this->leaf_buff, static_cast<uint32_t>(this->leaf_index), 1);
+  if (this->leaf_index > 0) {
+    rle_compressor.SequenceScanning(this->leaf_index, 1, input_preprocessing);
+  }
+
+  // Allocate buffer for header, tree, uniform values and RLE data
+  this->encoded_buff = (uint8_t *)malloc(sizeof(uint8_t) * (QUADTREE_HEADER_SIZE + this->tree_bits.size() + this->uniform_values.size() + rle_compressor.GetSize()));
+
+  // Invalid pointer
+  assert(this->encoded_buff != nullptr);
+
+  // Settings byte with model bit and size of smallest block
+  this->encoded_buff[this->encoded_index++] = (input_preprocessing ? QUADTREE_MODEL_MASK : 0) | QUADTREE_MIN_BLOCK_LOG;
+
+  // Size of image, and size of tree sections
+  this->AppendValue(static_cast<uint32_t>(this->width));
+  this->AppendValue(static_cast<uint32_t>(this->height));
+  this->AppendValue(this->node_count);
+  this->AppendValue(static_cast<uint32_t>(this->uniform_values.size()));
+
+  // Tree bits
+  memcpy(&this->encoded_buff[this->encoded_index], this->tree_bits.data(), this->tree_bits.size());
+  this->encoded_index += this->tree_bits.size();
+
+  // Values of uniform blocks
+  memcpy(&this->encoded_buff[this->encoded_index], this->uniform_values.data(), this->uniform_values.size());
+  this->encoded_index += this->uniform_values.size();
+
+  // RLE data of non uniform blocks
+  memcpy(&this->encoded_buff[this->encoded_index], rle_compressor.GetBuffer(), rle_compressor.GetSize());
+  this->encoded_index += rle_compressor.GetSize();
+}
+
+/**
+ * Return pointer to coded data buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & QuadtreeCompressor::GetBuffer() {
+  return this->encoded_buff;
+}
+
+/**
+ * Return coded data buffer size
+ * @returns Size of buffer
+ * */
+size_t & QuadtreeCompressor::GetSize() {
+  return this->encoded_index;
+}
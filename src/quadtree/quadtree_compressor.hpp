@@ -0,0 +1,109 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: quadtree_compressor.hpp
+ * Description: Contains definitions of quadtree compressor class that is used to code
+ * uniform blocks of image as single value and pass only remaining blocks to RLE
+ * */
+#ifndef __QUADTREE_COMPRESSOR__
+#define __QUADTREE_COMPRESSOR__
+
+#include <cstdint>  // uint8_t, uint32_t
+#include <cstring>  // memcpy
+#include <vector>   // vector
+#include <cassert>  // assert
+
+#include "quadtree.hpp"
+#include "../rle/rle_compressor.hpp"
+
+/**
+ * Class that will recursively divide image into blocks, uniform blocks are saved
+ * as one value, pixels of other smallest blocks are compressed with RLE
+ * */
+class QuadtreeCompressor {
+private:
+  // Image data
+  const uint8_t *buffer;
+  size_t width;
+  size_t height;
+
+  // Bits of tree, 1 for uniform block, 0 for divided or non uniform smallest block
+  std::vector<uint8_t> tree_bits;
+  uint32_t node_count;
+
+  // Values of uniform blocks
+  std::vector<uint8_t> uniform_values;
+
+  // Pixels of non uniform smallest blocks, in order of tree traversal
+  uint8_t *leaf_buff;
+  size_t leaf_index;
+
+  // Resulting data
+  uint8_t *encoded_buff;
+  size_t encoded_index;
+
+  /**
+   * Add one bit of tree
+   * @param[in] bit Value of bit
+   * */
+  void AddBit(const bool &bit);
+
+  /**
+   * Append value to buffer as QUADTREE_VALUE_BYTES bytes, most significant byte first
+   * @param[in] val Value to be added to buffer
+   * */
+  void AppendValue(const uint32_t &val);
+
+  /**
+   * Check if all pixels of block are the same
+   * @param[in] x Left column of block
+   * @param[in] y Top row of block
+   * @param[in] w Width of block
+   * @param[in] h Height of block
+   * @returns True when block is uniform, false otherwise
+   * */
+  bool IsUniform(const size_t &x, const size_t &y, const size_t &w, const size_t &h);
+
+  /**
+   * Code block, when uniform save its value, otherwise divide it into 4 blocks,
+   * or save its pixels when it is the smallest block
+   * @param[in] x Left column of block
+   * @param[in] y Top row of block
+   * @param[in] block_log Log2 of block size
+   * */
+  void Subdivide(const size_t &x, const size_t &y, const uint8_t &block_log);
+
+public:
+  /**
+   * Constructor that will initialize values
+   * @param[in] buffer Buffer representing image data
+   * @param[in] width Width of image in buffer
+   * @param[in] height Height of image in buffer
+   * */
+  QuadtreeCompressor(const uint8_t *buffer, const uint32_t &width, const uint32_t &height);
+
+  /**
+   * Deconstructor that will free allocated data
+   * */
+  ~QuadtreeCompressor();
+
+  /**
+   * Code image with quadtree, and compress pixels of non uniform blocks with RLE
+   * @param[in] input_preprocessing True when image was preprocessed, false otherwise
+   * */
+  void Compress(const bool &input_preprocessing);
+
+  /**
+   * Return pointer to coded data buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return coded data buffer size
+   * @returns Size of buffer
+   * */
+  size_t & GetSize();
+};
+
+#endif
@@ -0,0 +1,252 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: quadtree_decompressor.cpp
+ * Description: Contains implementations of quadtree decompressor class that is used to decompress
+ * data coded by QuadtreeCompressor into raw grayscale 8bit images
+ * */
+#include "quadtree_decompressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor for QuadtreeDecompressor that will initialize values
+ * @param[in] buffer Data buffer holding quadtree coded data
+ * @param[in] size Size of data buffer
+ * */
+QuadtreeDecompressor::QuadtreeDecompressor(uint8_t * &buffer, const size_t &size) {
+  // Receive buffer
+  this->buffer = buffer;
+  this->size = size;
+  this->index = 0;
+  this->width = 0;
+  this->height = 0;
+
+  // Initialize sections of data
+  this->tree_bits = nullptr;
+  this->node_count = 0;
+  this->node_index = 0;
+  this->uniform_values = nullptr;
+  this->uniform_count = 0;
+  this->uniform_index = 0;
+  this->leaf_buff = nullptr;
+  this->leaf_size = 0;
+  this->leaf_index = 0;
+
+  // Initialize decompressed data buffer
+  this->dec_buffer = nullptr;
+  this->dec_buffer_index = 0;
+}
+
+/**
+ * Deconstructor for QuadtreeDecompressor that will free allocated data
+ * */
+QuadtreeDecompressor::~QuadtreeDecompressor() {
+  // Free allocated decompressed data buffer, when one was allocated
+  if (this->dec_buffer != nullptr) {
+    free(this->dec_buffer);
+  }
+
+  // Destroy pointers to outside buffers
+  this->buffer = nullptr;
+  this->leaf_buff = nullptr;
+}
+
+/**
+ * Read QUADTREE_VALUE_BYTES bytes from buffer as one value, most significant byte first
+ * @param[out] val Read value
+ * @returns True when there were enough bytes in buffer, false otherwise
+ * */
+bool QuadtreeDecompressor::ReadValue(uint32_t &val) {
+  // Not enough bytes in buffer
+  if ((this->index + QUADTREE_VALUE_BYTES) > this->size) {
+    return false;
+  }
+
+  val = ByteIo::ReadValue(this->buffer, this->index, QUADTREE_VALUE_BYTES);
+  this->index += QUADTREE_VALUE_BYTES;
+
+  return true;
+}
+
+/**
+ * Get next bit of tree
+ * @param[out] bit Value of bit
+ * @returns True when there was next bit, false otherwise
+ * */
+bool QuadtreeDecompressor::NextBit(bool &bit) {
+  // No more bits
+  if (this->node_index >= this->node_count) {
+    return false;
+  }
+
+  bit = (this->tree_bits[this->node_index / UINT8_T_SIZE] & (1 << (this->node_index % UINT8_T_SIZE)));
+  this->node_index++;
+  return true;
+}
+
+/**
+ * Fill block of image, from uniform value, divided blocks or pixels of smallest block
+ * @param[in] x Left column of block
+ * @param[in] y Top row of block
+ * @param[in] block_log Log2 of block size
+ * @param[in] min_block_log Log2 of smallest block size
+ * @returns True when block was filled, false on invalid data
+ * */
+bool QuadtreeDecompressor::Fill(
+  const size_t &x,
+  const size_t &y,
+  const uint8_t &block_log,
+  const uint8_t &min_block_log
+) {
+  // Block lying completely outside of image was not coded
+  if (x >= this->width || y >= this->height) {
+    return true;
+  }
+
+  // Clip block to image
+  const size_t size = (static_cast<size_t>(1) << block_log);
+  const size_t w = ((x + size) > this->width) ? (this->width - x) : size;
+  const size_t h = ((y + size) > this->height) ? (this->height - y) : size;
+  bool uniform;
+
+  // Missing tree bit
+  if (!this->NextBit(uniform)) {
+    return false;
+  }
+
+  // Uniform block, fill it with its value
+  if (uniform) {
+    // Missing uniform value
+    if (this->uniform_index >= this->uniform_count) {
+      return false;
+    }
+
+    const uint8_t val = this->uniform_values[this->uniform_index++];
+
+    // Block covering whole rows is continuous in memory, fill it at once
+    if (w == this->width) {
+      memset(&this->dec_buffer[y * this->width], val, w * h);
+      return true;
+    }
+
+    for (size_t row = y; row < (y + h); row++) {
+      memset(&this->dec_buffer[row * this->width + x], val, w);
+    }
+    return true;
+  }
+
+  // Smallest block, copy its pixels row by row
+  if (block_log <= min_block_log) {
+    // Missing pixels
+    if ((this->leaf_index + w * h) > this->leaf_size) {
+      return false;
+    }
+
+    for (size_t row = y; row < (y + h); row++) {
+      memcpy(&this->dec_buffer[row * this->width + x], &this->leaf_buff[this->leaf_index], w);
+      this->leaf_index += w;
+    }
+    return true;
+  }
+
+  // Divided block, fill top left, top right, bottom left and bottom right block
+  const size_t half = (size >> 1);
+  const uint8_t half_log = (block_log - 1);
+  return this->Fill(x, y, half_log, min_block_log) &&
+    this->Fill(x + half, y, half_log, min_block_log) &&
+    this->Fill(x, y + half, half_log, min_block_log) &&
+    this->Fill(x + half, y + half, half_log, min_block_log);
+}
+
+/**
+ * Decompress quadtree coded data
+ * @param[out] convert_from_model Set to true when settings byte has -m bit set
+ * @returns True when decompression was successfull, false otherwise
+ * */
+bool QuadtreeDecompressor::Decompress(bool &convert_from_model) {
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  // Check that whole header is present
+  if (this->size < QUADTREE_HEADER_SIZE) {
+    std::cerr << "Buffer does not contain quadtree header!" << std::endl;
+    return false;
+  }
+
+  // Load settings byte
+  const uint8_t settings = this->buffer[this->index++];
+  const uint8_t min_block_log = (settings & QUADTREE_BLOCK_MASK);
+  convert_from_model = (settings & QUADTREE_MODEL_MASK);
+
+  // Load size of image and sizes of sections
+  this->ReadValue(width);
+  this->ReadValue(height);
+  this->ReadValue(this->node_count);
+  this->ReadValue(this->uniform_count);
+  this->width = width;
+  this->height = height;
+
+  // Check that tree and uniform values are present
+  const size_t tree_size = (static_cast<size_t>(this->node_count) + UINT8_T_SIZE - 1) / UINT8_T_SIZE;
+  if ((this->index + tree_size + this->uniform_count) > this->size) {
+    std::cerr << "Buffer does not contain whole quadtree!" << std::endl;
+    return false;
+  }
+
+  // Set sections
+  this->tree_bits = &this->buffer[this->index];
+  this->index += tree_size;
+  this->uniform_values = &this->buffer[this->index];
+  this->index += this->uniform_count;
+
+  // Decompress pixels of non uniform blocks, when there are any
+  uint8_t *rle_data = const_cast<uint8_t *>(&this->buffer[this->index]);
+  RleDecompressor rle_decompressor(rle_data, (this->size - this->index));
+  if (this->index < this->size) {
+    bool rle_model = false;
+    if (!rle_decompressor.Decompress(rle_model)) {
+      std::cerr << "Failed to decompress pixels of non uniform blocks!" << std::endl;
+      return false;
+    }
+    this->leaf_buff = rle_decompressor.GetBuffer();
+    this->leaf_size = rle_decompressor.GetSize();
+  }
+
+  // Allocate memory for image
+  this->dec_buffer_index = this->width * this->height;
+  this->dec_buffer = (uint8_t *)malloc(sizeof(uint8_t) * (this->dec_buffer_index + 1));
+
+  // Invalid allocation
+  assert(this->dec_buffer != nullptr);
+
+  // Find size of root block, that covers whole image
+  uint8_t root_log = min_block_log;
+  while ((static_cast<size_t>(1) << root_log) < this->width || (static_cast<size_t>(1) << root_log) < this->height) {
+    root_log++;
+  }
+
+  // Fill whole image
+  if (this->dec_buffer_index > 0 && !this->Fill(0, 0, root_log, min_block_log)) {
+    std::cerr << "Invalid quadtree data!" << std::endl;
+    return false;
+  }
+
+  // All pixels of non uniform blocks need to be used
+  return this->leaf_index == this->leaf_size;
+}
+
+/**
+ * Return pointer to decompressed data buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & QuadtreeDecompressor::GetBuffer() {
+  return this->dec_buffer;
+}
+
+/**
+ * Return decompressed data buffer size
+ * @returns Size of buffer
+ * */
+size_t QuadtreeDecompressor::GetSize() {
+  return this->dec_buffer_index;
+}
@@ -0,0 +1,112 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: quadtree_decompressor.hpp
+ * Description: Contains definitions of quadtree decompressor class that is used to decompress
+ * data coded by QuadtreeCompressor into raw grayscale 8bit images
+ * */
+#ifndef __QUADTREE_DECOMPRESSOR__
+#define __QUADTREE_DECOMPRESSOR__
+
+#include <iostream> // cerr
+#include <cstdint>  // uint8_t, uint32_t
+#include <cstring>  // memset, memcpy
+#include <cassert>  // assert
+
+#include "quadtree.hpp"
+#include "../rle/rle_decompressor.hpp"
+
+/**
+ * Class used for decompressing data coded by class QuadtreeCompressor
+ * */
+class QuadtreeDecompressor {
+private:
+  // Buffer that holds loaded data
+  const uint8_t *buffer;
+  // Size of loaded data buffer
+  size_t size;
+  // Current index in loaded data buffer
+  size_t index;
+
+  // Size of image
+  size_t width;
+  size_t height;
+
+  // Bits of tree, and index of next bit
+  const uint8_t *tree_bits;
+  uint32_t node_count;
+  uint32_t node_index;
+
+  // Values of uniform blocks, and index of next value
+  const uint8_t *uniform_values;
+  uint32_t uniform_count;
+  uint32_t uniform_index;
+
+  // Pixels of non uniform blocks, and index of next pixel
+  const uint8_t *leaf_buff;
+  size_t leaf_size;
+  size_t leaf_index;
+
+  // Buffer for holding decompressed image
+  uint8_t *dec_buffer;
+  // Size of decompressed image
+  size_t dec_buffer_index;
+
+  /**
+   * Read QUADTREE_VALUE_BYTES bytes from buffer as one value, most significant byte first
+   * @param[out] val Read value
+   * @returns True when there were enough bytes in buffer, false otherwise
+   * */
+  bool ReadValue(uint32_t &val);
+
+  /**
+   * Get next bit of tree
+   * @param[out] bit Value of bit
+   * @returns True when there was next bit, false otherwise
+   * */
+  bool NextBit(bool &bit);
+
+  /**
+   * Fill block of image, from uniform value, divided blocks or pixels of smallest block
+   * @param[in] x Left column of block
+   * @param[in] y Top row of block
+   * @param[in] block_log Log2 of block size
+   * @param[in] min_block_log Log2 of smallest block size
+   * @returns True when block was filled, false on invalid data
+   * */
+  bool Fill(const size_t &x, const size_t &y, const uint8_t &block_log, const uint8_t &min_block_log);
+
+public:
+  /**
+   * Constructor for QuadtreeDecompressor that will initialize values
+   * @param[in] buffer Data buffer holding quadtree coded data
+   * @param[in] size Size of data buffer
+   * */
+  QuadtreeDecompressor(uint8_t * &buffer, const size_t &size);
+
+  /**
+   * Deconstructor for QuadtreeDecompressor that will free allocated data
+   * */
+  ~QuadtreeDecompressor();
+
+  /**
+   * Decompress quadtree coded data
+   * @param[out] convert_from_model Set to true when settings byte has -m bit set
+   * @returns True when decompression was successfull, false otherwise
+   * */
+  bool Decompress(bool &convert_from_model);
+
+  /**
+   * Return pointer to decompressed data buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return decompressed data buffer size
+   * @returns Size of buffer
+   * */
+  size_t GetSize();
+};
+
+#endif
@@ -27,6 +27,7 @@ RleCompressor::RleCompressor(
   this->encoded_buff = nullptr;
   this->encoded_alloc = 0;
   this->encoded_index = 0;
+  this->run_count = 0;
 }
 
 /**
@@ -67,6 +68,9 @@ void RleCompressor::ReallocateBuffer() {
   if (this->encoded_buff != nullptr) {
     memcpy(tmp, this->encoded_buff, sizeof(uint8_t) * this->encoded_index);
     free(this->encoded_buff);
+    AllocCounters::Reallocation(this->encoded_index);
+  } else {
+    AllocCounters::Allocation();
   }
 
   // Set new buffer
@@ -202,7 +206,7 @@ void RleCompressor::appendToBuff(
 
   // Add value, when we are not pushing all values at last
   if (!end_push) {
-    group_vec.push_back(val);
+    AllocCounters::PushBack(group_vec, val, ALLOC_VECTOR);
   }
 
   // When group vector has 8 values, add them after group value
@@ -239,6 +243,8 @@ void RleCompressor::appendCounterValue(
   const uint8_t &val,
   size_t &counter
 ) {
+  this->run_count++;
+
   // When given counter, is bigger than 1, start adding counter split into 8bit values
   if (counter > 1) {
     // Vector to hold values
@@ -412,11 +418,13 @@ void RleCompressor::AdaptiveScanning(
   uint8_t *tmp_buff = this->encoded_buff;
   const size_t tmp_buff_alloc = this->encoded_alloc;
   const size_t tmp_buff_index = this->encoded_index;
+  const uint64_t tmp_run_count = this->run_count;
 
   // Clear buffer
   this->encoded_buff = nullptr;
   this->encoded_alloc = 0;
   this->encoded_index = 0;
+  this->run_count = 0;
 
   // Append settings to buffer with image width and height
   this->appendSettingsToBuff(vertical_settings, width, height);
@@ -437,6 +445,7 @@ void RleCompressor::AdaptiveScanning(
   this->encoded_buff = tmp_buff;
   this->encoded_alloc = tmp_buff_alloc;
   this->encoded_index = tmp_buff_index;
+  this->run_count = tmp_run_count;
 }
 
 /**
@@ -454,3 +463,11 @@ uint8_t * & RleCompressor::GetBuffer() {
 size_t & RleCompressor::GetSize() {
   return this->encoded_index;
 }
+
+/**
+ * Return number of runs, single values included, coded by chosen scanning
+ * @returns Number of runs
+ * */
+uint64_t RleCompressor::GetRunCount() {
+  return this->run_count;
+}
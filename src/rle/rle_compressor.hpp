@@ -16,6 +16,7 @@
 #include <cassert>   // assert
 
 #include "rle.hpp"
+#include "../stats/alloc_counters.hpp"
 
 // Default data when no settings are pressent
 constexpr uint8_t * NO_SETTINGS = nullptr;
@@ -24,6 +25,11 @@ constexpr uint8_t * NO_SETTINGS = nullptr;
  * Class that will compress image data into RLE compressed data
  * */
 class RleCompressor {
+  // Benchmark measures each scanning alone
+  friend struct RleScanningBench;
+  // Differential test compares each scanning alone with reference
+  friend struct RleScanningDifferential;
+
 private:
   const uint8_t *buffer;
   uint8_t *encoded_buff;
@@ -31,6 +37,9 @@ private:
   size_t encoded_alloc;
   size_t alloc_size;
 
+  // Number of runs of chosen scanning, reported by --stats
+  uint64_t run_count;
+
   /**
    * Create new buffer when there is none or reallocate existing buffer
    * */
@@ -149,6 +158,12 @@ public:
    * @returns Size of buffer
    * */
   size_t & GetSize();
+
+  /**
+   * Return number of runs, single values included, coded by chosen scanning
+   * @returns Number of runs
+   * */
+  uint64_t GetRunCount();
 };
 
 #endif
@@ -0,0 +1,189 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: pipeline_selector.cpp
+ * Description: Contains implementations of PipelineSelector class, that is used to choose settings of
+ * compression pipeline from sample of image, without compressing whole image with each of them
+ * */
+#include "pipeline_selector.hpp"
+
+/**
+ * Constructor that will initialize values and build sample of image
+ * @param[in] image Image data
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * */
+PipelineSelector::PipelineSelector(const uint8_t *image, const uint32_t &width, const uint32_t &height) {
+  this->image = image;
+  this->width = width;
+  this->height = height;
+  this->sample_width = 0;
+  this->sample_height = 0;
+  this->row_sample_height = 0;
+  this->estimated_bpp = 8;
+
+  this->BuildSample();
+}
+
+/**
+ * Copy tiles and bands of rows spread evenly over image below each other into samples, small image is copied whole
+ * */
+void PipelineSelector::BuildSample() {
+  const uint64_t image_size = static_cast<uint64_t>(this->width) * this->height;
+
+  // Small image is used whole
+  if (image_size <= SELECTOR_MAX_WHOLE_IMAGE) {
+    this->sample.assign(this->image, this->image + image_size);
+    this->sample_width = this->width;
+    this->sample_height = this->height;
+    return;
+  }
+
+  // Tiles are placed on regular grid, narrow or low image has tiles of its size
+  const uint32_t tile_width = std::min(SELECTOR_TILE_SIZE, this->width);
+  const uint32_t tile_height = std::min(SELECTOR_TILE_SIZE, this->height);
+  const uint32_t columns = std::min<uint32_t>(SELECTOR_TILES, this->width / tile_width);
+  const uint32_t rows = std::min<uint32_t>(SELECTOR_TILES, this->height / tile_height);
+
+  this->sample_width = tile_width;
+  this->sample_height = columns * rows * tile_height;
+  this->sample.resize(static_cast<uint64_t>(this->sample_width) * this->sample_height);
+
+  uint8_t *output = this->sample.data();
+  for (uint32_t row = 0; row < rows; row++) {
+    // Tiles are centered in their cells of grid
+    const uint32_t y = (row * this->height) / rows + ((this->height / rows) - tile_height) / 2;
+    for (uint32_t column = 0; column < columns; column++) {
+      const uint32_t x = (column * this->width) / columns + ((this->width / columns) - tile_width) / 2;
+      for (uint32_t i = 0; i < tile_height; i++) {
+        const uint8_t *line = &this->image[static_cast<uint64_t>(y + i) * this->width + x];
+        std::copy(line, line + tile_width, output);
+        output += tile_width;
+      }
+    }
+  }
+
+  // Bands of whole rows are centered in their parts of image, narrow image has bands of more rows
+  const uint32_t bands = std::min<uint32_t>(SELECTOR_TILES, this->height);
+  const uint32_t band_height = std::min<uint64_t>(
+    std::max<uint64_t>(SELECTOR_ROW_PIXELS / (static_cast<uint64_t>(bands) * this->width), 1), this->height / bands
+  );
+  this->row_sample_height = bands * band_height;
+  this->row_sample.resize(static_cast<uint64_t>(this->width) * this->row_sample_height);
+
+  output = this->row_sample.data();
+  for (uint32_t band = 0; band < bands; band++) {
+    const uint32_t y = (band * this->height) / bands + ((this->height / bands) - band_height) / 2;
+    const uint8_t *rows = &this->image[static_cast<uint64_t>(y) * this->width];
+    std::copy(rows, rows + static_cast<uint64_t>(band_height) * this->width, output);
+    output += static_cast<uint64_t>(band_height) * this->width;
+  }
+}
+
+/**
+ * Estimate number of bits of sample coded by pipeline
+ * @param[in] sample Sample of image
+ * @param[in] width Width of sample
+ * @param[in] height Height of sample
+ * @param[in] settings Settings of pipeline
+ * @returns Estimated number of bits, at most size of raw sample
+ * */
+double PipelineSelector::EstimateSample(
+  const std::vector<uint8_t> &sample,
+  const uint32_t &width,
+  const uint32_t &height,
+  const CodecSettings &settings
+) {
+  if (sample.empty()) {
+    return 0;
+  }
+
+  ImageCodec codec;
+  codec.Transform(sample.data(), width, height, settings, false);
+
+  // Raw pixels are stored, when coding would increase size
+  return std::min(EstimateBits(codec.GetBuffer(), codec.GetSize()), static_cast<double>(sample.size()) * BITS_IN_BYTE);
+}
+
+/**
+ * Estimate number of bits of huffman coded data from entropy of their symbols
+ * @param[in] data Data before huffman coding
+ * @param[in] size Size of data
+ * @returns Estimated number of bits
+ * */
+double PipelineSelector::EstimateBits(const uint8_t *data, const uint64_t &size) {
+  uint64_t counts[N_VALUES] = {0};
+  for (uint64_t i = 0; i < size; i++) {
+    counts[data[i]]++;
+  }
+
+  // Entropy of symbols, adaptive huffman codes at least one bit per symbol
+  double bits = 0;
+  uint16_t symbols = 0;
+  for (uint16_t i = 0; i < N_VALUES; i++) {
+    if (counts[i] > 0) {
+      bits -= counts[i] * std::log2(static_cast<double>(counts[i]) / size);
+      symbols++;
+    }
+  }
+  bits = std::max(bits, static_cast<double>(size));
+
+  // First appearance of each symbol is saved as whole byte after path to NYT node
+  bits += symbols * (BITS_IN_BYTE + std::log2(static_cast<double>(symbols) + 1));
+
+  // Huffman is not used when it does not reduce size
+  return std::min(bits, static_cast<double>(size) * BITS_IN_BYTE);
+}
+
+/**
+ * Choose settings of pipeline predicted to give the smallest result, from candidates with and without
+ * preprocessing, quadtree coding and BWT, scanning is always adaptive
+ * @param[in] settings Settings given by user, BWT block size and maximum error are kept
+ * @returns Chosen settings
+ * */
+CodecSettings PipelineSelector::Select(const CodecSettings &settings) {
+  const uint64_t sample_size = this->sample.size() + this->row_sample.size();
+  CodecSettings best = settings;
+  double best_bits = -1;
+
+  // Candidates are ordered from the fastest, so slower one has to be better by SELECTOR_MIN_GAIN
+  for (uint8_t candidate = 0; candidate < 8; candidate++) {
+    CodecSettings current = settings;
+    current.input_preprocessing = (candidate & 1) || settings.max_error > 0;
+    current.adaptive_sequence_scanning = true;
+    current.quadtree_coding = (candidate & 2);
+    current.bwt_transform = (candidate & 4);
+
+    // Preprocessing can not be turned off for near-lossless mode
+    if (settings.max_error > 0 && !(candidate & 1)) {
+      continue;
+    }
+
+    // Tiles and rows are estimated separately, because they have different width
+    const double bits = EstimateSample(this->sample, this->sample_width, this->sample_height, current) +
+      EstimateSample(this->row_sample, this->width, this->row_sample_height, current);
+    if (best_bits < 0 || bits < best_bits * (1 - SELECTOR_MIN_GAIN)) {
+      best = current;
+      best_bits = bits;
+    }
+  }
+
+  this->estimated_bpp = (sample_size > 0) ? (best_bits / sample_size) : 0;
+  return best;
+}
+
+/**
+ * Return estimated number of bits per pixel of chosen pipeline
+ * @returns Bits per pixel
+ * */
+double PipelineSelector::GetEstimatedBitsPerPixel() {
+  return this->estimated_bpp;
+}
+
+/**
+ * Return number of sampled pixels
+ * @returns Size of sample
+ * */
+uint64_t PipelineSelector::GetSampleSize() {
+  return this->sample.size() + this->row_sample.size();
+}
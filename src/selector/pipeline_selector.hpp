@@ -0,0 +1,111 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: pipeline_selector.hpp
+ * Description: Contains definitions of PipelineSelector class, that is used to choose settings of
+ * compression pipeline from sample of image, without compressing whole image with each of them
+ * */
+#ifndef __PIPELINE_SELECTOR__
+#define __PIPELINE_SELECTOR__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cmath>    // log2
+#include <vector>   // vector
+#include <algorithm> // min
+
+#include "../image_codec.hpp"
+
+// Width and height of one sampled tile
+constexpr uint32_t SELECTOR_TILE_SIZE = 64;
+
+// Number of sampled tiles in each direction
+constexpr uint32_t SELECTOR_TILES = 4;
+
+// Images with at most this number of pixels, which is number of pixels of sampled tiles, are not
+// sampled, whole image is used
+constexpr uint64_t SELECTOR_MAX_WHOLE_IMAGE = SELECTOR_TILES * SELECTOR_TILES * SELECTOR_TILE_SIZE * SELECTOR_TILE_SIZE;
+
+// Number of pixels of whole rows sampled besides tiles, so runs longer than tile are also sampled,
+// rows are split into SELECTOR_TILES bands of neighbouring rows spread over image
+constexpr uint64_t SELECTOR_ROW_PIXELS = SELECTOR_TILES * SELECTOR_TILE_SIZE * SELECTOR_TILE_SIZE;
+
+// Slower candidate is chosen only when its estimated size is smaller by more than this ratio
+constexpr double SELECTOR_MIN_GAIN = 0.01;
+
+/**
+ * Class that samples tiles and bands of rows spread over image, runs stages before huffman coding on sample for each
+ * candidate pipeline and estimates size of huffman coded result from entropy of symbols
+ * */
+class PipelineSelector {
+private:
+  // Image from which we will choose settings
+  const uint8_t *image;
+  uint32_t width;
+  uint32_t height;
+
+  // Tiles of image stacked below each other
+  std::vector<uint8_t> sample;
+  uint32_t sample_width;
+  uint32_t sample_height;
+
+  // Bands of whole rows of image stacked below each other, empty when whole image is sampled
+  std::vector<uint8_t> row_sample;
+  uint32_t row_sample_height;
+
+  // Estimated number of bits per pixel of chosen pipeline
+  double estimated_bpp;
+
+  /**
+   * Copy tiles and bands of rows spread evenly over image below each other into samples, small image is copied whole
+   * */
+  void BuildSample();
+
+  /**
+   * Estimate number of bits of sample coded by pipeline
+   * @param[in] sample Sample of image
+   * @param[in] width Width of sample
+   * @param[in] height Height of sample
+   * @param[in] settings Settings of pipeline
+   * @returns Estimated number of bits, at most size of raw sample
+   * */
+  static double EstimateSample(const std::vector<uint8_t> &sample, const uint32_t &width, const uint32_t &height, const CodecSettings &settings);
+
+  /**
+   * Estimate number of bits of huffman coded data from entropy of their symbols
+   * @param[in] data Data before huffman coding
+   * @param[in] size Size of data
+   * @returns Estimated number of bits
+   * */
+  static double EstimateBits(const uint8_t *data, const uint64_t &size);
+
+public:
+  /**
+   * Constructor that will initialize values and build sample of image
+   * @param[in] image Image data
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * */
+  PipelineSelector(const uint8_t *image, const uint32_t &width, const uint32_t &height);
+
+  /**
+   * Choose settings of pipeline predicted to give the smallest result, from candidates with and without
+   * preprocessing, quadtree coding and BWT, scanning is always adaptive
+   * @param[in] settings Settings given by user, BWT block size and maximum error are kept
+   * @returns Chosen settings
+   * */
+  CodecSettings Select(const CodecSettings &settings);
+
+  /**
+   * Return estimated number of bits per pixel of chosen pipeline
+   * @returns Bits per pixel
+   * */
+  double GetEstimatedBitsPerPixel();
+
+  /**
+   * Return number of sampled pixels
+   * @returns Size of sample
+   * */
+  uint64_t GetSampleSize();
+};
+
+#endif
@@ -0,0 +1,104 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: alloc_counters.cpp
+ * Description: Contains implementations of AllocCounters class, that counts allocations, reallocations and copied
+ * bytes of growing buffers of RLE and huffman coding, growth of vectors and BFS queues and peak RSS
+ * */
+#include "alloc_counters.hpp"
+
+std::atomic<uint64_t> AllocCounters::allocations(0);
+std::atomic<uint64_t> AllocCounters::reallocations(0);
+std::atomic<uint64_t> AllocCounters::bytes_copied(0);
+std::atomic<uint64_t> AllocCounters::vector_growths(0);
+std::atomic<uint64_t> AllocCounters::queue_growths(0);
+
+/**
+ * Count new buffer without previous data
+ * */
+void AllocCounters::Allocation() {
+  AllocCounters::allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Count increased buffer
+ * @param[in] bytes_copied Number of bytes copied from old buffer
+ * */
+void AllocCounters::Reallocation(const uint64_t &bytes_copied) {
+  AllocCounters::reallocations.fetch_add(1, std::memory_order_relaxed);
+  AllocCounters::bytes_copied.fetch_add(bytes_copied, std::memory_order_relaxed);
+}
+
+/**
+ * Count growth of vector or queue
+ * @param[in] kind ALLOC_VECTOR or ALLOC_QUEUE
+ * @param[in] bytes_copied Number of bytes moved to new storage
+ * */
+void AllocCounters::Growth(const uint8_t &kind, const uint64_t &bytes_copied) {
+  if (kind == ALLOC_QUEUE) {
+    AllocCounters::queue_growths.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    AllocCounters::vector_growths.fetch_add(1, std::memory_order_relaxed);
+  }
+  AllocCounters::bytes_copied.fetch_add(bytes_copied, std::memory_order_relaxed);
+}
+
+/**
+ * Return counted allocations
+ * @returns Values of counters
+ * */
+AllocValues AllocCounters::Get() {
+  return {
+    AllocCounters::allocations.load(std::memory_order_relaxed),
+    AllocCounters::reallocations.load(std::memory_order_relaxed),
+    AllocCounters::bytes_copied.load(std::memory_order_relaxed),
+    AllocCounters::vector_growths.load(std::memory_order_relaxed),
+    AllocCounters::queue_growths.load(std::memory_order_relaxed)
+  };
+}
+
+/**
+ * Set all counters to zero
+ * */
+void AllocCounters::Reset() {
+  AllocCounters::allocations = 0;
+  AllocCounters::reallocations = 0;
+  AllocCounters::bytes_copied = 0;
+  AllocCounters::vector_growths = 0;
+  AllocCounters::queue_growths = 0;
+}
+
+/**
+ * Reset peak resident set size, so next GetPeakRss returns peak since now, needs Linux 4.0
+ * @returns True when peak was reset, false otherwise
+ * */
+bool AllocCounters::ResetPeakRss() {
+  std::ofstream file("/proc/self/clear_refs");
+  if (!file.is_open()) {
+    return false;
+  }
+  file << "5";
+  file.flush();
+  return file.good();
+}
+
+/**
+ * Return peak resident set size, since ResetPeakRss or start of process
+ * @returns Peak RSS in KiB
+ * */
+uint64_t AllocCounters::GetPeakRss() {
+  // VmHWM is reset by ResetPeakRss, ru_maxrss is peak of whole process
+  std::ifstream file("/proc/self/status");
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.compare(0, 6, "VmHWM:") == 0) {
+      return std::stoull(line.substr(6));
+    }
+  }
+
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  return usage.ru_maxrss;
+}
@@ -0,0 +1,108 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: alloc_counters.hpp
+ * Description: Contains definitions of AllocCounters class, that counts allocations, reallocations and copied
+ * bytes of growing buffers of RLE and huffman coding, growth of vectors and BFS queues and peak RSS
+ * */
+#ifndef __ALLOC_COUNTERS__
+#define __ALLOC_COUNTERS__
+
+#include <cstdint>  // uint8_t, uint64_t
+#include <vector>   // vector
+#include <atomic>   // atomic
+#include <fstream>  // ifstream, ofstream
+#include <string>   // string, getline
+#include <sys/resource.h> // getrusage
+
+// Kind of vector, which growth is counted by PushBack
+constexpr uint8_t ALLOC_VECTOR = 0;
+constexpr uint8_t ALLOC_QUEUE = 1;
+
+/**
+ * Counted allocations
+ * @param allocations Number of buffers allocated without previous data
+ * @param reallocations Number of buffers increased, data of old buffer were copied into new one
+ * @param bytes_copied Number of bytes copied by reallocations and growth of vectors and queues
+ * @param vector_growths Number of times, when group vector of RLE needed bigger storage
+ * @param queue_growths Number of times, when BFS queue of huffman tree needed bigger storage
+ * */
+typedef struct AllocValues {
+  uint64_t allocations;
+  uint64_t reallocations;
+  uint64_t bytes_copied;
+  uint64_t vector_growths;
+  uint64_t queue_growths;
+} AllocValues;
+
+/**
+ * Class that counts allocations of whole process, counters are atomic so codecs running
+ * on more threads can count into them, growth is rare so counting does not slow coding
+ * */
+class AllocCounters {
+private:
+  static std::atomic<uint64_t> allocations;
+  static std::atomic<uint64_t> reallocations;
+  static std::atomic<uint64_t> bytes_copied;
+  static std::atomic<uint64_t> vector_growths;
+  static std::atomic<uint64_t> queue_growths;
+
+public:
+  /**
+   * Count new buffer without previous data
+   * */
+  static void Allocation();
+
+  /**
+   * Count increased buffer
+   * @param[in] bytes_copied Number of bytes copied from old buffer
+   * */
+  static void Reallocation(const uint64_t &bytes_copied);
+
+  /**
+   * Count growth of vector or queue
+   * @param[in] kind ALLOC_VECTOR or ALLOC_QUEUE
+   * @param[in] bytes_copied Number of bytes moved to new storage
+   * */
+  static void Growth(const uint8_t &kind, const uint64_t &bytes_copied);
+
+  /**
+   * Push value to vector, growth of storage of vector is counted
+   * @param[in] vector Vector, where value is pushed
+   * @param[in] value Pushed value
+   * @param[in] kind ALLOC_VECTOR or ALLOC_QUEUE
+   * */
+  template <typename T>
+  static inline void PushBack(std::vector<T> &vector, const T &value, const uint8_t &kind) {
+    const size_t capacity = vector.capacity();
+    vector.push_back(value);
+    if (vector.capacity() != capacity) {
+      AllocCounters::Growth(kind, capacity * sizeof(T));
+    }
+  }
+
+  /**
+   * Return counted allocations
+   * @returns Values of counters
+   * */
+  static AllocValues Get();
+
+  /**
+   * Set all counters to zero
+   * */
+  static void Reset();
+
+  /**
+   * Reset peak resident set size, so next GetPeakRss returns peak since now, needs Linux 4.0
+   * @returns True when peak was reset, false otherwise
+   * */
+  static bool ResetPeakRss();
+
+  /**
+   * Return peak resident set size, since ResetPeakRss or start of process
+   * @returns Peak RSS in KiB
+   * */
+  static uint64_t GetPeakRss();
+};
+
+#endif
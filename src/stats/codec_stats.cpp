@@ -0,0 +1,191 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: codec_stats.cpp
+ * Description: Contains implementations of CodecStats class, that measures time and sizes of each stage
+ * of compression and counters of RLE and huffman coding, printed by --stats
+ * */
+#include "codec_stats.hpp"
+
+/**
+ * Constructor that will initialize counters
+ * @param[in] hardware_counters True to measure hardware counters of each stage, when they are permitted
+ * */
+CodecStats::CodecStats(const bool &hardware_counters) {
+  this->cpu_start = 0;
+  this->hardware_counters = hardware_counters && this->perf_counters.Open();
+  this->runs = 0;
+  this->huffman_coded = false;
+  this->huffman = {0, 0, 0, 0, 0};
+
+  // Count only allocations of this compression
+  AllocCounters::Reset();
+}
+
+/**
+ * Start measuring of stage
+ * @param[in] name Name of stage
+ * @param[in] bytes_in Number of bytes given to stage
+ * */
+void CodecStats::StartStage(const std::string &name, const uint64_t &bytes_in) {
+  this->stages.push_back({name, 0, 0, bytes_in, 0, {}});
+  this->cpu_start = std::clock();
+  this->wall_start = std::chrono::steady_clock::now();
+  if (this->hardware_counters) {
+    this->perf_counters.Start();
+  }
+}
+
+/**
+ * Stop measuring of stage started by the last StartStage
+ * @param[in] bytes_out Number of bytes produced by stage
+ * */
+void CodecStats::EndStage(const uint64_t &bytes_out) {
+  StageStats &stage = this->stages.back();
+  if (this->hardware_counters) {
+    stage.counters = this->perf_counters.Stop();
+  }
+  const auto wall_end = std::chrono::steady_clock::now();
+  stage.wall_ms = std::chrono::duration<double, std::milli>(wall_end - this->wall_start).count();
+  stage.cpu_ms = 1000.0 * (std::clock() - this->cpu_start) / CLOCKS_PER_SEC;
+  stage.bytes_out = bytes_out;
+
+  // Stage is also shown in trace, when --trace is used with --stats
+  TraceRecorder::AddSpan(stage.name, "stage", this->wall_start, wall_end, {{"bytes_in", stage.bytes_in}, {"bytes_out", bytes_out}});
+}
+
+/**
+ * Save number of runs of RLE
+ * @param[in] runs Number of runs
+ * */
+void CodecStats::SetRuns(const uint64_t &runs) {
+  this->runs = runs;
+}
+
+/**
+ * Save counters of huffman coder
+ * @param[in] huffman Counters of adaptive or static huffman coder
+ * */
+void CodecStats::SetHuffman(const HuffmanStats &huffman) {
+  this->huffman = huffman;
+  this->huffman_coded = true;
+}
+
+/**
+ * Return peak resident set size of process
+ * @returns Peak RSS in KiB
+ * */
+uint64_t CodecStats::GetPeakRss() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  return usage.ru_maxrss;
+}
+
+/**
+ * Print stages and counters as table
+ * @param[in] stream Stream to print to
+ * */
+void CodecStats::Print(std::ostream &stream) {
+  double wall_ms = 0;
+  double cpu_ms = 0;
+  stream << std::fixed << std::setprecision(3);
+  stream << std::left << std::setw(16) << "stage" << std::right << std::setw(12) << "wall ms" << std::setw(12) << "cpu ms"
+    << std::setw(14) << "bytes in" << std::setw(14) << "bytes out" << std::endl;
+  for (const StageStats &stage : this->stages) {
+    stream << std::left << std::setw(16) << stage.name << std::right << std::setw(12) << stage.wall_ms << std::setw(12) << stage.cpu_ms
+      << std::setw(14) << stage.bytes_in << std::setw(14) << stage.bytes_out << std::endl;
+    wall_ms += stage.wall_ms;
+    cpu_ms += stage.cpu_ms;
+  }
+  stream << std::left << std::setw(16) << "total" << std::right << std::setw(12) << wall_ms << std::setw(12) << cpu_ms << std::endl;
+
+  stream << "runs: " << this->runs << std::endl;
+  if (this->huffman_coded) {
+    const double average = (this->huffman.symbols > 0) ? static_cast<double>(this->huffman.code_bits) / this->huffman.symbols : 0;
+    stream << "huffman symbols: " << this->huffman.symbols << ", NYT literals: " << this->huffman.nyt_count
+      << ", swapped nodes: " << this->huffman.swap_count << ", max depth: " << this->huffman.max_depth
+      << ", average code length: " << average << " bits" << std::endl;
+  }
+  const AllocValues alloc = AllocCounters::Get();
+  stream << "allocations: " << alloc.allocations << ", reallocations: " << alloc.reallocations
+    << ", vector growths: " << alloc.vector_growths << ", queue growths: " << alloc.queue_growths
+    << ", bytes copied: " << alloc.bytes_copied << std::endl;
+  stream << "peak RSS: " << CodecStats::GetPeakRss() << " KiB" << std::endl;
+
+  // Hardware counters of each stage, counters that were not measured are printed as -
+  if (!this->hardware_counters) {
+    if (this->perf_counters.GetError() != "") {
+      stream << "hardware counters: not available (" << this->perf_counters.GetError() << ")" << std::endl;
+    }
+    stream.unsetf(std::ios_base::floatfield);
+    return;
+  }
+  stream << std::left << std::setw(16) << "stage" << std::right;
+  for (uint8_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+    stream << std::setw(15) << PerfCounters::GetName(i);
+  }
+  stream << std::setw(8) << "IPC" << std::endl;
+  for (const StageStats &stage : this->stages) {
+    stream << std::left << std::setw(16) << stage.name << std::right;
+    for (uint8_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+      if (stage.counters.available[i]) {
+        stream << std::setw(15) << stage.counters.values[i];
+      } else {
+        stream << std::setw(15) << "-";
+      }
+    }
+    if (stage.counters.available[PERF_CYCLES] && stage.counters.available[PERF_INSTRUCTIONS] && stage.counters.values[PERF_CYCLES] > 0) {
+      stream << std::setw(8) << std::setprecision(2)
+        << static_cast<double>(stage.counters.values[PERF_INSTRUCTIONS]) / stage.counters.values[PERF_CYCLES] << std::setprecision(3);
+    }
+    stream << std::endl;
+  }
+  stream.unsetf(std::ios_base::floatfield);
+}
+
+/**
+ * Print stages and counters as JSON object
+ * @param[in] stream Stream to print to
+ * */
+void CodecStats::PrintJson(std::ostream &stream) {
+  stream << std::fixed << std::setprecision(3);
+  stream << "{\"stages\": [";
+  for (size_t i = 0; i < this->stages.size(); i++) {
+    const StageStats &stage = this->stages[i];
+    stream << ((i > 0) ? ", " : "") << "{\"name\": \"" << stage.name << "\", \"wall_ms\": " << stage.wall_ms
+      << ", \"cpu_ms\": " << stage.cpu_ms << ", \"bytes_in\": " << stage.bytes_in << ", \"bytes_out\": " << stage.bytes_out;
+
+    // Only measured counters are saved
+    if (this->hardware_counters) {
+      stream << ", \"counters\": {";
+      bool first = true;
+      for (uint8_t j = 0; j < PERF_COUNTER_COUNT; j++) {
+        if (stage.counters.available[j]) {
+          stream << (first ? "" : ", ") << "\"" << PerfCounters::GetName(j) << "\": " << stage.counters.values[j];
+          first = false;
+        }
+      }
+      stream << "}";
+    }
+    stream << "}";
+  }
+  stream << "], \"runs\": " << this->runs;
+  if (this->huffman_coded) {
+    const double average = (this->huffman.symbols > 0) ? static_cast<double>(this->huffman.code_bits) / this->huffman.symbols : 0;
+    stream << ", \"huffman\": {\"symbols\": " << this->huffman.symbols << ", \"nyt_count\": " << this->huffman.nyt_count
+      << ", \"swap_count\": " << this->huffman.swap_count << ", \"max_depth\": " << this->huffman.max_depth
+      << ", \"average_code_length\": " << average << "}";
+  }
+  const AllocValues alloc = AllocCounters::Get();
+  stream << ", \"alloc\": {\"allocations\": " << alloc.allocations << ", \"reallocations\": " << alloc.reallocations
+    << ", \"vector_growths\": " << alloc.vector_growths << ", \"queue_growths\": " << alloc.queue_growths
+    << ", \"bytes_copied\": " << alloc.bytes_copied << "}";
+  stream << ", \"peak_rss_kib\": " << CodecStats::GetPeakRss();
+  if (!this->hardware_counters && this->perf_counters.GetError() != "") {
+    stream << ", \"counters_error\": \"" << this->perf_counters.GetError() << "\"";
+  }
+  stream << "}" << std::endl;
+  stream.unsetf(std::ios_base::floatfield);
+}
@@ -0,0 +1,112 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: codec_stats.hpp
+ * Description: Contains definitions of CodecStats class, that measures time and sizes of each stage
+ * of compression and counters of RLE and huffman coding, printed by --stats
+ * */
+#ifndef __CODEC_STATS__
+#define __CODEC_STATS__
+
+#include <cstdint>  // uint64_t
+#include <string>   // string
+#include <vector>   // vector
+#include <iostream> // ostream
+#include <iomanip>  // setw, setprecision
+#include <chrono>   // steady_clock
+#include <ctime>    // clock
+#include <sys/resource.h> // getrusage
+
+#include "../huffman/huffman.hpp"
+#include "perf_counters.hpp"
+#include "trace_recorder.hpp"
+#include "alloc_counters.hpp"
+
+/**
+ * Time and sizes of one stage
+ * @param name Name of stage
+ * @param wall_ms Wall time of stage in ms
+ * @param cpu_ms CPU time of process during stage in ms
+ * @param bytes_in Number of bytes given to stage
+ * @param bytes_out Number of bytes produced by stage
+ * @param counters Hardware counters of stage
+ * */
+typedef struct StageStats {
+  std::string name;
+  double wall_ms;
+  double cpu_ms;
+  uint64_t bytes_in;
+  uint64_t bytes_out;
+  PerfValues counters;
+} StageStats;
+
+/**
+ * Class that measures stages one after another, stage is measured from StartStage to EndStage
+ * */
+class CodecStats {
+private:
+  std::vector<StageStats> stages;
+  std::chrono::steady_clock::time_point wall_start;
+  std::clock_t cpu_start;
+
+  // Hardware counters, opened only when they are requested
+  PerfCounters perf_counters;
+  bool hardware_counters;
+
+  // Counters of the last coded image
+  uint64_t runs;
+  bool huffman_coded;
+  HuffmanStats huffman;
+
+public:
+  /**
+   * Constructor that will initialize counters
+   * @param[in] hardware_counters True to measure hardware counters of each stage, when they are permitted
+   * */
+  CodecStats(const bool &hardware_counters = false);
+
+  /**
+   * Start measuring of stage
+   * @param[in] name Name of stage
+   * @param[in] bytes_in Number of bytes given to stage
+   * */
+  void StartStage(const std::string &name, const uint64_t &bytes_in);
+
+  /**
+   * Stop measuring of stage started by the last StartStage
+   * @param[in] bytes_out Number of bytes produced by stage
+   * */
+  void EndStage(const uint64_t &bytes_out);
+
+  /**
+   * Save number of runs of RLE
+   * @param[in] runs Number of runs
+   * */
+  void SetRuns(const uint64_t &runs);
+
+  /**
+   * Save counters of huffman coder
+   * @param[in] huffman Counters of adaptive or static huffman coder
+   * */
+  void SetHuffman(const HuffmanStats &huffman);
+
+  /**
+   * Return peak resident set size of process
+   * @returns Peak RSS in KiB
+   * */
+  static uint64_t GetPeakRss();
+
+  /**
+   * Print stages and counters as table
+   * @param[in] stream Stream to print to
+   * */
+  void Print(std::ostream &stream);
+
+  /**
+   * Print stages and counters as JSON object
+   * @param[in] stream Stream to print to
+   * */
+  void PrintJson(std::ostream &stream);
+};
+
+#endif
@@ -0,0 +1,161 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: perf_counters.cpp
+ * Description: Contains implementations of PerfCounters class, that reads hardware counters of CPU
+ * through perf_event_open, counters that are not permitted or not supported are left out
+ * */
+#include "perf_counters.hpp"
+
+/**
+ * Constructor, counters are not opened until Open
+ * */
+PerfCounters::PerfCounters() {
+  for (uint8_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+    this->fds[i] = -1;
+  }
+  this->error = "";
+}
+
+/**
+ * Deconstructor that will close opened counters
+ * */
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+  for (uint8_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+    if (this->fds[i] >= 0) {
+      close(this->fds[i]);
+    }
+  }
+#endif
+}
+
+/**
+ * Open all counters, each counter is opened on its own, so unsupported counter does not disable others
+ * @returns True when at least one counter was opened, false otherwise
+ * */
+bool PerfCounters::Open() {
+#ifdef __linux__
+  // Type and config of each counter, cache counters are read misses
+  const uint32_t types[PERF_COUNTER_COUNT] = {
+    PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE
+  };
+  const uint64_t configs[PERF_COUNTER_COUNT] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+  };
+
+  bool opened = false;
+  for (uint8_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+    if (this->fds[i] >= 0) {
+      opened = true;
+      continue;
+    }
+
+    // Only user space of this process is counted, which is permitted with default perf_event_paranoid
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = types[i];
+    attr.config = configs[i];
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    this->fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (this->fds[i] >= 0) {
+      opened = true;
+    } else if (this->error == "") {
+      this->error = "perf_event_open: " + std::string(strerror(errno));
+      if (errno == EACCES || errno == EPERM) {
+        this->error += ", check /proc/sys/kernel/perf_event_paranoid";
+      }
+    }
+  }
+  return opened;
+#else
+  this->error = "perf_event_open is available only on Linux";
+  return false;
+#endif
+}
+
+/**
+ * Reset and start all opened counters
+ * */
+void PerfCounters::Start() {
+#ifdef __linux__
+  for (uint8_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+    if (this->fds[i] >= 0) {
+      ioctl(this->fds[i], PERF_EVENT_IOC_RESET, 0);
+      ioctl(this->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+#endif
+}
+
+/**
+ * Stop all opened counters and read their values
+ * @returns Values of counters
+ * */
+PerfValues PerfCounters::Stop() {
+  PerfValues values;
+  memset(&values, 0, sizeof(values));
+
+#ifdef __linux__
+  for (uint8_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+    if (this->fds[i] >= 0) {
+      ioctl(this->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+
+  for (uint8_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+    // Value, time when counter was enabled and time when it was really counting
+    uint64_t data[3] = {0, 0, 0};
+    if (this->fds[i] < 0 || read(this->fds[i], data, sizeof(data)) != sizeof(data) || data[2] == 0) {
+      continue;
+    }
+
+    // Kernel shares hardware counters between more events, value is estimated from time it was counting
+    values.available[i] = true;
+    values.values[i] = (data[2] < data[1]) ? static_cast<uint64_t>(static_cast<double>(data[0]) * data[1] / data[2]) : data[0];
+  }
+#endif
+  return values;
+}
+
+/**
+ * Return reason why counter could not be opened
+ * @returns Error message, empty when all counters were opened
+ * */
+const std::string & PerfCounters::GetError() {
+  return this->error;
+}
+
+/**
+ * Return name of counter
+ * @param[in] counter Index of counter
+ * @returns Name of counter, as used in JSON
+ * */
+std::string PerfCounters::GetName(const uint8_t &counter) {
+  switch (counter) {
+    case PERF_CYCLES:
+      return "cycles";
+    case PERF_INSTRUCTIONS:
+      return "instructions";
+    case PERF_BRANCH_MISSES:
+      return "branch_misses";
+    case PERF_L1D_MISSES:
+      return "l1d_misses";
+    case PERF_LLC_MISSES:
+      return "llc_misses";
+    case PERF_DTLB_MISSES:
+      return "dtlb_misses";
+  }
+  return "unknown";
+}
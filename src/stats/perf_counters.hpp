@@ -0,0 +1,95 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: perf_counters.hpp
+ * Description: Contains definitions of PerfCounters class, that reads hardware counters of CPU
+ * through perf_event_open, counters that are not permitted or not supported are left out
+ * */
+#ifndef __PERF_COUNTERS__
+#define __PERF_COUNTERS__
+
+#include <cstdint>  // uint8_t, uint64_t
+#include <cstring>  // memset, strerror
+#include <cerrno>   // errno
+#include <string>   // string
+
+#ifdef __linux__
+#include <linux/perf_event.h> // perf_event_attr
+#include <sys/syscall.h> // SYS_perf_event_open
+#include <sys/ioctl.h>   // ioctl
+#include <unistd.h>      // syscall, read, close
+#endif
+
+// Counters in order of their values
+constexpr uint8_t PERF_CYCLES = 0;
+constexpr uint8_t PERF_INSTRUCTIONS = 1;
+constexpr uint8_t PERF_BRANCH_MISSES = 2;
+constexpr uint8_t PERF_L1D_MISSES = 3;
+constexpr uint8_t PERF_LLC_MISSES = 4;
+constexpr uint8_t PERF_DTLB_MISSES = 5;
+constexpr uint8_t PERF_COUNTER_COUNT = 6;
+
+/**
+ * Values of counters measured between Start and Stop
+ * @param available True for each counter, that was measured
+ * @param values Value of each counter, scaled when kernel multiplexed counters
+ * */
+typedef struct PerfValues {
+  bool available[PERF_COUNTER_COUNT];
+  uint64_t values[PERF_COUNTER_COUNT];
+} PerfValues;
+
+/**
+ * Class that measures hardware counters of process, threads started after Open are included
+ * */
+class PerfCounters {
+private:
+  // File descriptor of each counter, -1 when counter is not available
+  int fds[PERF_COUNTER_COUNT];
+
+  // Reason why the first counter could not be opened
+  std::string error;
+
+public:
+  /**
+   * Constructor, counters are not opened until Open
+   * */
+  PerfCounters();
+
+  /**
+   * Deconstructor that will close opened counters
+   * */
+  ~PerfCounters();
+
+  /**
+   * Open all counters, each counter is opened on its own, so unsupported counter does not disable others
+   * @returns True when at least one counter was opened, false otherwise
+   * */
+  bool Open();
+
+  /**
+   * Reset and start all opened counters
+   * */
+  void Start();
+
+  /**
+   * Stop all opened counters and read their values
+   * @returns Values of counters
+   * */
+  PerfValues Stop();
+
+  /**
+   * Return reason why counter could not be opened
+   * @returns Error message, empty when all counters were opened
+   * */
+  const std::string & GetError();
+
+  /**
+   * Return name of counter
+   * @param[in] counter Index of counter
+   * @returns Name of counter, as used in JSON
+   * */
+  static std::string GetName(const uint8_t &counter);
+};
+
+#endif
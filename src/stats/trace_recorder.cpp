@@ -0,0 +1,157 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: trace_recorder.cpp
+ * Description: Contains implementations of TraceRecorder class, that records spans of stages, blocks and I/O
+ * of every thread and saves them as Chrome trace JSON, which is opened by Perfetto or chrome://tracing
+ * */
+#include "trace_recorder.hpp"
+
+std::mutex TraceRecorder::mutex;
+std::atomic<bool> TraceRecorder::enabled(false);
+std::chrono::steady_clock::time_point TraceRecorder::origin;
+std::vector<TraceEvent> TraceRecorder::events;
+std::vector<std::thread::id> TraceRecorder::threads;
+
+/**
+ * Return index of calling thread, new thread gets next index, mutex needs to be locked
+ * @returns Index of thread
+ * */
+uint32_t TraceRecorder::ThreadIndex() {
+  const std::thread::id id = std::this_thread::get_id();
+  for (size_t i = 0; i < TraceRecorder::threads.size(); i++) {
+    if (TraceRecorder::threads[i] == id) {
+      return i;
+    }
+  }
+  TraceRecorder::threads.push_back(id);
+  return TraceRecorder::threads.size() - 1;
+}
+
+/**
+ * Return text as JSON string, with quotes, backslashes and control characters escaped
+ * @param[in] text Text
+ * @returns JSON string with quotes
+ * */
+std::string TraceRecorder::JsonString(const std::string &text) {
+  std::string result = "\"";
+  for (const char &character : text) {
+    if (character == '"' || character == '\\') {
+      result += '\\';
+    }
+    if (static_cast<unsigned char>(character) < 0x20) {
+      result += ' ';
+      continue;
+    }
+    result += character;
+  }
+  return result + "\"";
+}
+
+/**
+ * Start recording, calling thread is named main thread and time of trace starts now
+ * */
+void TraceRecorder::Enable() {
+  std::lock_guard<std::mutex> lock(TraceRecorder::mutex);
+  TraceRecorder::origin = std::chrono::steady_clock::now();
+  TraceRecorder::ThreadIndex();
+  TraceRecorder::enabled = true;
+}
+
+/**
+ * Return true when spans are recorded
+ * @returns True after Enable
+ * */
+bool TraceRecorder::IsEnabled() {
+  return TraceRecorder::enabled;
+}
+
+/**
+ * Record span of calling thread
+ * @param[in] name Name of span
+ * @param[in] category Category of span, stage, block or io
+ * @param[in] start Time when span started
+ * @param[in] end Time when span ended
+ * @param[in] args Numeric arguments of span
+ * */
+void TraceRecorder::AddSpan(
+  const std::string &name,
+  const std::string &category,
+  const std::chrono::steady_clock::time_point &start,
+  const std::chrono::steady_clock::time_point &end,
+  const TraceArgs &args
+) {
+  if (!TraceRecorder::enabled) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(TraceRecorder::mutex);
+  TraceRecorder::events.push_back({name, category, TraceRecorder::ThreadIndex(), start, end, args});
+}
+
+/**
+ * Save recorded spans as Chrome trace JSON, with names of threads
+ * @param[in] filename Name of file
+ * @returns True when file was written, false otherwise
+ * */
+bool TraceRecorder::Write(const std::string &filename) {
+  std::lock_guard<std::mutex> lock(TraceRecorder::mutex);
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  // Complete events with time and duration in microseconds from start of trace
+  file << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  for (size_t i = 0; i < TraceRecorder::threads.size(); i++) {
+    file << ((i > 0) ? ",\n" : "\n") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << i
+      << ", \"args\": {\"name\": " << JsonString((i == 0) ? "main" : "worker " + std::to_string(i)) << "}}";
+  }
+  for (const TraceEvent &event : TraceRecorder::events) {
+    file << ",\n{\"name\": " << JsonString(event.name) << ", \"cat\": " << JsonString(event.category)
+      << ", \"ph\": \"X\", \"pid\": 1, \"tid\": " << event.thread
+      << ", \"ts\": " << std::chrono::duration<double, std::micro>(event.start - TraceRecorder::origin).count()
+      << ", \"dur\": " << std::chrono::duration<double, std::micro>(event.end - event.start).count() << ", \"args\": {";
+    for (size_t i = 0; i < event.args.size(); i++) {
+      file << ((i > 0) ? ", " : "") << JsonString(event.args[i].first) << ": " << event.args[i].second;
+    }
+    file << "}}";
+  }
+  file << "\n]}\n";
+  return file.good();
+}
+
+/**
+ * Constructor that will start span
+ * @param[in] name Name of span
+ * @param[in] category Category of span, stage, block or io
+ * @param[in] args Numeric arguments of span
+ * */
+TraceSpan::TraceSpan(const std::string &name, const std::string &category, const TraceArgs &args) {
+  this->active = TraceRecorder::IsEnabled();
+  if (this->active) {
+    this->name = name;
+    this->category = category;
+    this->args = args;
+    this->start = std::chrono::steady_clock::now();
+  }
+}
+
+/**
+ * Deconstructor that will record span
+ * */
+TraceSpan::~TraceSpan() {
+  if (this->active) {
+    TraceRecorder::AddSpan(this->name, this->category, this->start, std::chrono::steady_clock::now(), this->args);
+  }
+}
+
+/**
+ * Add numeric argument known only at the end of span
+ * @param[in] name Name of argument
+ * @param[in] value Value of argument
+ * */
+void TraceSpan::AddArg(const std::string &name, const uint64_t &value) {
+  if (this->active) {
+    this->args.push_back({name, value});
+  }
+}
@@ -0,0 +1,137 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: trace_recorder.hpp
+ * Description: Contains definitions of TraceRecorder class, that records spans of stages, blocks and I/O
+ * of every thread and saves them as Chrome trace JSON, which is opened by Perfetto or chrome://tracing
+ * */
+#ifndef __TRACE_RECORDER__
+#define __TRACE_RECORDER__
+
+#include <cstdint>  // uint32_t, uint64_t
+#include <string>   // string
+#include <vector>   // vector
+#include <utility>  // pair
+#include <fstream>  // ofstream
+#include <iomanip>  // setprecision
+#include <chrono>   // steady_clock
+#include <mutex>    // mutex, lock_guard
+#include <atomic>   // atomic
+#include <thread>   // this_thread
+
+// Numeric arguments of span, shown by trace viewer
+typedef std::vector<std::pair<std::string, uint64_t>> TraceArgs;
+
+/**
+ * One recorded span
+ * @param name Name of span
+ * @param category Category of span, stage, block or io
+ * @param thread Index of thread, in order in which threads recorded their first span
+ * @param start Time when span started
+ * @param end Time when span ended
+ * @param args Numeric arguments of span
+ * */
+typedef struct TraceEvent {
+  std::string name;
+  std::string category;
+  uint32_t thread;
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::time_point end;
+  TraceArgs args;
+} TraceEvent;
+
+/**
+ * Class that records spans of whole process, spans are recorded only after Enable, so codec
+ * does not pay for tracing when it is not requested
+ * */
+class TraceRecorder {
+private:
+  static std::mutex mutex;
+  static std::atomic<bool> enabled;
+  static std::chrono::steady_clock::time_point origin;
+  static std::vector<TraceEvent> events;
+  static std::vector<std::thread::id> threads;
+
+  /**
+   * Return index of calling thread, new thread gets next index, mutex needs to be locked
+   * @returns Index of thread
+   * */
+  static uint32_t ThreadIndex();
+
+  /**
+   * Return text as JSON string, with quotes, backslashes and control characters escaped
+   * @param[in] text Text
+   * @returns JSON string with quotes
+   * */
+  static std::string JsonString(const std::string &text);
+
+public:
+  /**
+   * Start recording, calling thread is named main thread and time of trace starts now
+   * */
+  static void Enable();
+
+  /**
+   * Return true when spans are recorded
+   * @returns True after Enable
+   * */
+  static bool IsEnabled();
+
+  /**
+   * Record span of calling thread
+   * @param[in] name Name of span
+   * @param[in] category Category of span, stage, block or io
+   * @param[in] start Time when span started
+   * @param[in] end Time when span ended
+   * @param[in] args Numeric arguments of span
+   * */
+  static void AddSpan(
+    const std::string &name,
+    const std::string &category,
+    const std::chrono::steady_clock::time_point &start,
+    const std::chrono::steady_clock::time_point &end,
+    const TraceArgs &args = {}
+  );
+
+  /**
+   * Save recorded spans as Chrome trace JSON, with names of threads
+   * @param[in] filename Name of file
+   * @returns True when file was written, false otherwise
+   * */
+  static bool Write(const std::string &filename);
+};
+
+/**
+ * Span recorded from construction to destruction, when recording is enabled
+ * */
+class TraceSpan {
+private:
+  std::string name;
+  std::string category;
+  TraceArgs args;
+  std::chrono::steady_clock::time_point start;
+  bool active;
+
+public:
+  /**
+   * Constructor that will start span
+   * @param[in] name Name of span
+   * @param[in] category Category of span, stage, block or io
+   * @param[in] args Numeric arguments of span
+   * */
+  TraceSpan(const std::string &name, const std::string &category, const TraceArgs &args = {});
+
+  /**
+   * Deconstructor that will record span
+   * */
+  ~TraceSpan();
+
+  /**
+   * Add numeric argument known only at the end of span
+   * @param[in] name Name of argument
+   * @param[in] value Value of argument
+   * */
+  void AddArg(const std::string &name, const uint64_t &value);
+};
+
+#endif
@@ -0,0 +1,162 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: tile_predictor.cpp
+ * Description: Contains implementations of TilePredictor class, that is used to replace pixels of tile
+ * by difference from prediction by their already coded neighbours, and to reverse it
+ * */
+#include "tile_predictor.hpp"
+
+/**
+ * Predict pixel from its neighbours inside tile
+ * @param[in] predictor Identifier of predictor
+ * @param[in] tile Pixels of tile, row after row
+ * @param[in] width Width of tile
+ * @param[in] x Column of pixel
+ * @param[in] y Row of pixel
+ * @returns Predicted value
+ * */
+uint8_t TilePredictor::Predict(
+  const uint8_t &predictor,
+  const uint8_t *tile,
+  const uint32_t &width,
+  const uint32_t &x,
+  const uint32_t &y
+) {
+  const size_t index = static_cast<size_t>(y) * width + x;
+
+  // Edges of tile have only one neighbour
+  if (predictor == TILE_PREDICTOR_NONE || (x == 0 && y == 0)) {
+    return 0;
+  }
+  if (y == 0) {
+    return tile[index - 1];
+  }
+  if (x == 0) {
+    return tile[index - width];
+  }
+
+  const int32_t a = tile[index - 1];
+  const int32_t b = tile[index - width];
+  const int32_t c = tile[index - width - 1];
+
+  switch (predictor) {
+    case TILE_PREDICTOR_LEFT:
+      return a;
+    case TILE_PREDICTOR_UP:
+      return b;
+    case TILE_PREDICTOR_AVERAGE:
+      return (a + b) / 2;
+    case TILE_PREDICTOR_PAETH:
+      {
+        const int32_t p = a + b - c;
+        const int32_t pa = std::abs(p - a);
+        const int32_t pb = std::abs(p - b);
+        const int32_t pc = std::abs(p - c);
+        if (pa <= pb && pa <= pc) {
+          return a;
+        }
+        return (pb <= pc) ? b : c;
+      }
+    case TILE_PREDICTOR_MED:
+      if (c >= std::max(a, b)) {
+        return std::min(a, b);
+      }
+      if (c <= std::min(a, b)) {
+        return std::max(a, b);
+      }
+      return a + b - c;
+  }
+  return 0;
+}
+
+/**
+ * Replace pixels of tile by difference from their prediction
+ * @param[in] predictor Identifier of predictor
+ * @param[in] tile Pixels of tile, row after row
+ * @param[in] width Width of tile
+ * @param[in] height Height of tile
+ * @param[out] residuals Differences of pixels from prediction
+ * */
+void TilePredictor::Forward(
+  const uint8_t &predictor,
+  const uint8_t *tile,
+  const uint32_t &width,
+  const uint32_t &height,
+  std::vector<uint8_t> &residuals
+) {
+  residuals.resize(static_cast<size_t>(width) * height);
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      const size_t index = static_cast<size_t>(y) * width + x;
+      residuals[index] = tile[index] - TilePredictor::Predict(predictor, tile, width, x, y);
+    }
+  }
+}
+
+/**
+ * Reconstruct pixels of tile from differences, in place
+ * @param[in] predictor Identifier of predictor
+ * @param[in,out] tile Differences of pixels, replaced by pixels
+ * @param[in] width Width of tile
+ * @param[in] height Height of tile
+ * */
+void TilePredictor::Inverse(const uint8_t &predictor, uint8_t *tile, const uint32_t &width, const uint32_t &height) {
+  // Neighbours of pixel are already reconstructed, when going row after row
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      const size_t index = static_cast<size_t>(y) * width + x;
+      tile[index] += TilePredictor::Predict(predictor, tile, width, x, y);
+    }
+  }
+}
+
+/**
+ * Compute order-0 entropy of data, used to rank predictors before compressing tile
+ * @param[in] data Data
+ * @returns Entropy in bits per byte
+ * */
+double TilePredictor::Entropy(const std::vector<uint8_t> &data) {
+  if (data.empty()) {
+    return 0;
+  }
+
+  uint64_t counts[256] = {0};
+  for (const uint8_t &value : data) {
+    counts[value]++;
+  }
+
+  double entropy = 0;
+  for (uint16_t i = 0; i < 256; i++) {
+    if (counts[i] > 0) {
+      const double probability = static_cast<double>(counts[i]) / data.size();
+      entropy -= probability * std::log2(probability);
+    }
+  }
+  return entropy;
+}
+
+/**
+ * Return name of predictor
+ * @param[in] predictor Identifier of predictor
+ * @returns Name of predictor, "unknown" for invalid identifier
+ * */
+std::string TilePredictor::GetName(const uint8_t &predictor) {
+  switch (predictor) {
+    case TILE_PREDICTOR_NONE:
+      return "none";
+    case TILE_PREDICTOR_LEFT:
+      return "left";
+    case TILE_PREDICTOR_UP:
+      return "up";
+    case TILE_PREDICTOR_AVERAGE:
+      return "average";
+    case TILE_PREDICTOR_PAETH:
+      return "paeth";
+    case TILE_PREDICTOR_MED:
+      return "med";
+    case TILE_PREDICTOR_LOWEST_ENTROPY:
+      return "entropy";
+  }
+  return "unknown";
+}
@@ -0,0 +1,78 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: tile_predictor.hpp
+ * Description: Contains definitions of TilePredictor class, that is used to replace pixels of tile
+ * by difference from prediction by their already coded neighbours, and to reverse it
+ * */
+#ifndef __TILE_PREDICTOR__
+#define __TILE_PREDICTOR__
+
+#include <cstdint>  // uint8_t, uint32_t
+#include <cstdlib>  // abs
+#include <cmath>    // log2
+#include <vector>   // vector
+#include <algorithm> // min, max
+#include <string>   // string
+
+#include "tiles.hpp"
+
+/**
+ * Class with 2D predictors, tile is predicted only from its own pixels, so tiles are independent,
+ * pixels of first row are predicted by left neighbour and pixels of first column by upper neighbour
+ * */
+class TilePredictor {
+private:
+  /**
+   * Predict pixel from its neighbours inside tile
+   * @param[in] predictor Identifier of predictor
+   * @param[in] tile Pixels of tile, row after row
+   * @param[in] width Width of tile
+   * @param[in] x Column of pixel
+   * @param[in] y Row of pixel
+   * @returns Predicted value
+   * */
+  static uint8_t Predict(const uint8_t &predictor, const uint8_t *tile, const uint32_t &width, const uint32_t &x, const uint32_t &y);
+
+public:
+  /**
+   * Replace pixels of tile by difference from their prediction
+   * @param[in] predictor Identifier of predictor
+   * @param[in] tile Pixels of tile, row after row
+   * @param[in] width Width of tile
+   * @param[in] height Height of tile
+   * @param[out] residuals Differences of pixels from prediction
+   * */
+  static void Forward(
+    const uint8_t &predictor,
+    const uint8_t *tile,
+    const uint32_t &width,
+    const uint32_t &height,
+    std::vector<uint8_t> &residuals
+  );
+
+  /**
+   * Reconstruct pixels of tile from differences, in place
+   * @param[in] predictor Identifier of predictor
+   * @param[in,out] tile Differences of pixels, replaced by pixels
+   * @param[in] width Width of tile
+   * @param[in] height Height of tile
+   * */
+  static void Inverse(const uint8_t &predictor, uint8_t *tile, const uint32_t &width, const uint32_t &height);
+
+  /**
+   * Compute order-0 entropy of data, used to rank predictors before compressing tile
+   * @param[in] data Data
+   * @returns Entropy in bits per byte
+   * */
+  static double Entropy(const std::vector<uint8_t> &data);
+
+  /**
+   * Return name of predictor
+   * @param[in] predictor Identifier of predictor
+   * @returns Name of predictor, "unknown" for invalid identifier
+   * */
+  static std::string GetName(const uint8_t &predictor);
+};
+
+#endif
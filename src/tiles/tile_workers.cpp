@@ -0,0 +1,50 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: tile_workers.cpp
+ * Description: Contains implementations of TileWorkers class, that is used to code independent tiles
+ * on more threads, each thread takes next tile until all tiles are coded
+ * */
+#include "tile_workers.hpp"
+
+/**
+ * Run function for each index from 0 to count, calling thread is one of threads
+ * @param[in] count Number of tiles
+ * @param[in] threads Number of threads, 1 runs all tiles on calling thread
+ * @param[in] function Function called with index of tile
+ * */
+void TileWorkers::ForEach(const size_t &count, const uint32_t &threads, const std::function<void(const size_t &)> &function) {
+  // More threads than tiles would only wait
+  const size_t thread_count = std::min<size_t>(std::max<uint32_t>(threads, 1), count);
+  if (thread_count <= 1) {
+    for (size_t i = 0; i < count; i++) {
+      function(i);
+    }
+    return;
+  }
+
+  // Tiles differ in time of coding, so each thread takes next tile instead of fixed range of tiles
+  std::atomic<size_t> next(0);
+  const auto work = [&]() {
+    for (size_t i = next++; i < count; i = next++) {
+      function(i);
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < thread_count; i++) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+}
+
+/**
+ * Return number of hardware threads
+ * @returns Number of threads, at least 1
+ * */
+uint32_t TileWorkers::GetHardwareThreads() {
+  return std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+}
@@ -0,0 +1,43 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: tile_workers.hpp
+ * Description: Contains definitions of TileWorkers class, that is used to code independent tiles
+ * on more threads, each thread takes next tile until all tiles are coded
+ * */
+#ifndef __TILE_WORKERS__
+#define __TILE_WORKERS__
+
+#include <cstdint>  // uint32_t
+#include <cstddef>  // size_t
+#include <vector>   // vector
+#include <thread>   // thread, hardware_concurrency
+#include <atomic>   // atomic
+#include <functional> // function
+#include <algorithm> // min, max
+
+// Highest number of threads given by user, more threads than this only wait for tiles
+constexpr uint32_t TILE_WORKERS_MAX_THREADS = 1024;
+
+/**
+ * Class that runs function for each tile on given number of threads, tiles are taken in order,
+ * so result does not depend on number of threads, when function writes only data of its tile
+ * */
+class TileWorkers {
+public:
+  /**
+   * Run function for each index from 0 to count, calling thread is one of threads
+   * @param[in] count Number of tiles
+   * @param[in] threads Number of threads, 1 runs all tiles on calling thread
+   * @param[in] function Function called with index of tile
+   * */
+  static void ForEach(const size_t &count, const uint32_t &threads, const std::function<void(const size_t &)> &function);
+
+  /**
+   * Return number of hardware threads
+   * @returns Number of threads, at least 1
+   * */
+  static uint32_t GetHardwareThreads();
+};
+
+#endif
@@ -0,0 +1,51 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: tiles.hpp
+ * Description: Contains definitions of constant data for both tiles compressor and decompressor
+ * */
+#ifndef __TILES__
+#define __TILES__
+
+#include <cstdint>  // uint8_t, uint32_t
+
+// Constants used both in TilesCompressor and TilesDecompressor
+
+// Default number of pixels in each direction of one tile
+constexpr uint32_t TILES_DEFAULT_SIZE = 256;
+
+// Number of bytes of width and height of image and size of tile
+constexpr uint8_t TILES_VALUE_BYTES = 4;
+
+// Number of bytes of size of encoded tile
+constexpr uint8_t TILES_SIZE_BYTES = 8;
+
+// Size of header, magic bytes followed by width and height of image and size of tile
+constexpr uint8_t TILES_HEADER_SIZE = 4 + 3 * TILES_VALUE_BYTES;
+
+// Size of entry of tile index, predictor followed by size of encoded tile
+constexpr uint8_t TILES_ENTRY_SIZE = 1 + TILES_SIZE_BYTES;
+
+// Predictors of pixel from its left (a), upper (b) and upper left (c) neighbour
+constexpr uint8_t TILE_PREDICTOR_NONE = 0;    // 0
+constexpr uint8_t TILE_PREDICTOR_LEFT = 1;    // a
+constexpr uint8_t TILE_PREDICTOR_UP = 2;      // b
+constexpr uint8_t TILE_PREDICTOR_AVERAGE = 3; // (a + b) / 2
+constexpr uint8_t TILE_PREDICTOR_PAETH = 4;   // a, b or c closest to a + b - c
+constexpr uint8_t TILE_PREDICTOR_MED = 5;     // median of a, b and a + b - c, as in LOCO-I
+constexpr uint8_t TILE_PREDICTOR_COUNT = 6;
+
+// Bit of predictor in tile index, differences of tile are coded by context coder instead of pipeline
+constexpr uint8_t TILE_CONTEXT_BIT = 0x80;
+
+// Not saved in container, chooses predictor with the lowest entropy of differences for each tile
+constexpr uint8_t TILE_PREDICTOR_LOWEST_ENTROPY = TILE_PREDICTOR_COUNT;
+
+// Number of pipelines tried for each tile, adaptive scanning alone, with BWT, quadtree alone and with BWT
+constexpr uint8_t TILE_PIPELINE_COUNT = 4;
+
+// Time of each pipeline with static and with adaptive huffman code relative to the fastest one,
+// used by deadline before time of pipeline is measured, rounded up so deadline is rather kept
+constexpr uint16_t TILE_PIPELINE_COST[2][TILE_PIPELINE_COUNT] = {{1, 16, 1, 16}, {128, 128, 128, 128}};
+
+#endif
@@ -0,0 +1,406 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: tiles_compressor.cpp
+ * Description: Contains implementations of tiles compressor class that is used to split image into tiles
+ * and compress each tile with predictor and pipeline, that give the smallest result for it
+ * */
+#include "tiles_compressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor that will initialize values
+ * @param[in] buffer Image data
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * */
+TilesCompressor::TilesCompressor(const uint8_t *buffer, const uint32_t &width, const uint32_t &height) {
+  // Set image which we will be compressing
+  this->buffer = buffer;
+  this->width = width;
+  this->height = height;
+
+  // Set tiles
+  this->tile_size = 0;
+  this->tiles_x = 0;
+  this->tiles_y = 0;
+  this->attempts = 0;
+  this->improvements = 0;
+  this->threads = 1;
+
+  // Set container data
+  this->encoded_buff = nullptr;
+  this->encoded_index = 0;
+}
+
+/**
+ * Deconstructor that will free allocated data
+ * */
+TilesCompressor::~TilesCompressor() {
+  // When buffer was allocated, free him
+  if (this->encoded_buff) {
+    free(this->encoded_buff);
+  }
+
+  // Remove pointer pointing to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Set number of threads compressing tiles, result is the same for any number of threads
+ * @param[in] threads Number of threads, 1 compresses tiles on calling thread
+ * */
+void TilesCompressor::SetThreads(const uint32_t &threads) {
+  this->threads = std::max<uint32_t>(threads, 1);
+}
+
+/**
+ * Copy tile from image into separate buffer
+ * @param[in] index Index of tile, row after row
+ * @param[out] tile Pixels of tile, row after row
+ * @param[out] tile_width Width of tile
+ * @param[out] tile_height Height of tile
+ * */
+void TilesCompressor::CopyTile(const size_t &index, std::vector<uint8_t> &tile, uint32_t &tile_width, uint32_t &tile_height) {
+  // Tiles on right and bottom edge may be smaller
+  const uint32_t x = (index % this->tiles_x) * this->tile_size;
+  const uint32_t y = (index / this->tiles_x) * this->tile_size;
+  tile_width = std::min(this->tile_size, this->width - x);
+  tile_height = std::min(this->tile_size, this->height - y);
+
+  tile.resize(static_cast<size_t>(tile_width) * tile_height);
+  for (uint32_t row = 0; row < tile_height; row++) {
+    memcpy(&tile[static_cast<size_t>(row) * tile_width], &this->buffer[static_cast<size_t>(y + row) * this->width + x], tile_width);
+  }
+}
+
+/**
+ * Split image into tiles of given size, and rank predictors of each tile
+ * @param[in] tile_size Number of pixels in each direction of one tile
+ * @param[in] rank False to skip ranking, when predictor is given
+ * */
+void TilesCompressor::InitTiles(const uint32_t &tile_size, const bool &rank) {
+  this->tile_size = tile_size;
+  this->tiles_x = (static_cast<uint64_t>(this->width) + tile_size - 1) / tile_size;
+  this->tiles_y = (static_cast<uint64_t>(this->height) + tile_size - 1) / tile_size;
+
+  const size_t tile_count = static_cast<size_t>(this->tiles_x) * this->tiles_y;
+  this->rankings.assign(tile_count, {});
+  this->tile_predictors.assign(tile_count, TILE_PREDICTOR_NONE);
+  this->encoded_tiles.assign(tile_count, {});
+  this->attempts = 0;
+  this->improvements = 0;
+  if (!rank) {
+    return;
+  }
+
+  // Rank predictors by entropy of differences, which is much faster than compressing them
+  TileWorkers::ForEach(tile_count, this->threads, [&](const size_t &i) {
+    std::vector<uint8_t> tile;
+    std::vector<uint8_t> residuals;
+    uint32_t tile_width, tile_height;
+    this->CopyTile(i, tile, tile_width, tile_height);
+
+    std::vector<std::pair<double, uint8_t>> ranking;
+    for (uint8_t predictor = 0; predictor < TILE_PREDICTOR_COUNT; predictor++) {
+      TilePredictor::Forward(predictor, tile.data(), tile_width, tile_height, residuals);
+      ranking.push_back({TilePredictor::Entropy(residuals), predictor});
+    }
+    std::sort(ranking.begin(), ranking.end());
+
+    for (const std::pair<double, uint8_t> &ranked : ranking) {
+      this->rankings[i].push_back(ranked.second);
+    }
+  });
+}
+
+/**
+ * Return settings of one of pipelines tried for tiles, differences are already computed by predictor
+ * @param[in] settings Settings of compression pipeline, BWT block size is kept
+ * @param[in] pipeline Index of pipeline, from the fastest to TILE_PIPELINE_COUNT
+ * @param[in] static_huffman True to use static huffman code
+ * @returns Settings of pipeline
+ * */
+CodecSettings TilesCompressor::GetPipeline(const CodecSettings &settings, const uint8_t &pipeline, const bool &static_huffman) {
+  CodecSettings candidate = settings;
+  candidate.input_preprocessing = false;
+  candidate.adaptive_sequence_scanning = true;
+  candidate.quadtree_coding = (pipeline >= 2);
+  candidate.bwt_transform = (pipeline % 2 == 1);
+  candidate.max_error = 0;
+  candidate.static_huffman = static_huffman;
+  return candidate;
+}
+
+/**
+ * Compress tile with given predictor and settings, result is kept when it is smaller than previous one
+ * @param[in] index Index of tile
+ * @param[in] predictor Identifier of predictor
+ * @param[in] settings Settings of compression pipeline
+ * */
+void TilesCompressor::TryTile(const size_t &index, const uint8_t &predictor, const CodecSettings &settings) {
+  TraceSpan span("tile", "block", {{"index", index}, {"predictor", predictor}});
+  std::vector<uint8_t> tile;
+  std::vector<uint8_t> residuals;
+  uint32_t tile_width, tile_height;
+  this->CopyTile(index, tile, tile_width, tile_height);
+  TilePredictor::Forward(predictor, tile.data(), tile_width, tile_height, residuals);
+
+  ImageCodec codec;
+  codec.Compress(residuals.data(), tile_width, tile_height, settings, false);
+  span.AddArg("bytes", codec.GetSize());
+  this->KeepTile(index, predictor, codec.GetBuffer(), codec.GetSize());
+}
+
+/**
+ * Code differences of tile given by predictor with context coder, result is kept when it is smaller than previous one
+ * @param[in] index Index of tile
+ * @param[in] predictor Identifier of predictor
+ * @param[in] models Number of models of context coder tried
+ * */
+void TilesCompressor::TryContextTile(const size_t &index, const uint8_t &predictor, const uint8_t &models) {
+  TraceSpan span("context tile", "block", {{"index", index}, {"predictor", predictor}});
+  std::vector<uint8_t> tile;
+  std::vector<uint8_t> residuals;
+  uint32_t tile_width, tile_height;
+  this->CopyTile(index, tile, tile_width, tile_height);
+  TilePredictor::Forward(predictor, tile.data(), tile_width, tile_height, residuals);
+
+  ContextCoder coder;
+  coder.Encode(residuals.data(), tile_width, tile_height, models);
+  span.AddArg("bytes", coder.GetSize());
+  this->KeepTile(index, predictor | TILE_CONTEXT_BIT, coder.GetBuffer(), coder.GetSize());
+}
+
+/**
+ * Keep encoded tile, when it is smaller than previous result of tile
+ * @param[in] index Index of tile
+ * @param[in] predictor Predictor saved in index of tiles, with TILE_CONTEXT_BIT for context coded tile
+ * @param[in] encoded Encoded tile
+ * @param[in] size Size of encoded tile
+ * */
+void TilesCompressor::KeepTile(const size_t &index, const uint8_t &predictor, const uint8_t *encoded, const uint64_t &size) {
+  this->attempts++;
+
+  std::vector<uint8_t> &best = this->encoded_tiles[index];
+  if (best.empty() || size < best.size()) {
+    if (!best.empty()) {
+      this->improvements++;
+    }
+    best.assign(encoded, encoded + size);
+    this->tile_predictors[index] = predictor;
+  }
+}
+
+/**
+ * Compress each tile with every combination of predictors with the lowest entropy of differences
+ * and first pipelines, the smallest result of each tile is saved
+ * @param[in] settings Settings of compression pipeline, BWT block size and type of huffman code are kept
+ * @param[in] tile_size Number of pixels in each direction of one tile
+ * @param[in] predictors Number of predictors tried for each tile, from 1 to TILE_PREDICTOR_COUNT
+ * @param[in] pipelines Number of pipelines tried for each tile, up to TILE_PIPELINE_COUNT, 0 only with context models
+ * @param[in] context_models Number of models of context coder tried with each predictor, 0 without context coder
+ * */
+void TilesCompressor::Compress(
+  const CodecSettings &settings,
+  const uint32_t &tile_size,
+  const uint8_t &predictors,
+  const uint8_t &pipelines,
+  const uint8_t &context_models
+) {
+  // Every tile needs at least one result
+  assert(pipelines > 0 || context_models > 0);
+  this->InitTiles(tile_size);
+
+  // Keep the smallest result of best predictors with each pipeline and context coder, tiles are independent
+  TileWorkers::ForEach(this->encoded_tiles.size(), this->threads, [&](const size_t &i) {
+    for (uint8_t j = 0; j < std::min(predictors, TILE_PREDICTOR_COUNT); j++) {
+      for (uint8_t k = 0; k < std::min(pipelines, TILE_PIPELINE_COUNT); k++) {
+        this->TryTile(i, this->rankings[i][j], this->GetPipeline(settings, k, settings.static_huffman));
+      }
+      if (context_models > 0) {
+        this->TryContextTile(i, this->rankings[i][j], context_models);
+      }
+    }
+  });
+
+  this->WriteContainer();
+}
+
+/**
+ * Compress each tile with one predictor and pipeline given by settings, used by profiles found by tuning
+ * @param[in] settings Settings of compression pipeline, preprocessing is replaced by predictor
+ * @param[in] tile_size Number of pixels in each direction of one tile
+ * @param[in] predictor Identifier of predictor, TILE_PREDICTOR_LOWEST_ENTROPY to rank predictors of each tile
+ * */
+void TilesCompressor::CompressWithMode(const CodecSettings &settings, const uint32_t &tile_size, const uint8_t &predictor) {
+  this->InitTiles(tile_size, predictor == TILE_PREDICTOR_LOWEST_ENTROPY);
+
+  CodecSettings candidate = settings;
+  candidate.input_preprocessing = false;
+  candidate.max_error = 0;
+  TileWorkers::ForEach(this->encoded_tiles.size(), this->threads, [&](const size_t &i) {
+    this->TryTile(i, (predictor < TILE_PREDICTOR_COUNT) ? predictor : this->rankings[i][0], candidate);
+  });
+
+  this->WriteContainer();
+}
+
+/**
+ * Compress all tiles with the fastest mode first, then try stronger modes on tiles while they are
+ * expected to finish before deadline, the smallest result of each tile is saved
+ * @param[in] settings Settings of compression pipeline, BWT block size is kept
+ * @param[in] tile_size Number of pixels in each direction of one tile
+ * @param[in] deadline Time, after which no more attempts are started
+ * */
+void TilesCompressor::CompressWithDeadline(
+  const CodecSettings &settings,
+  const uint32_t &tile_size,
+  const std::chrono::steady_clock::time_point &deadline
+) {
+  this->InitTiles(tile_size);
+
+  // Fastest mode is used for all tiles even after deadline, so every tile has result
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < this->encoded_tiles.size(); i++) {
+    this->TryTile(i, this->rankings[i][0], this->GetPipeline(settings, 0, true));
+  }
+  const uint64_t pixels = static_cast<uint64_t>(this->width) * this->height;
+  const double fastest_cost = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+    std::max<uint64_t>(pixels, 1);
+
+  // Nanoseconds per pixel of each pipeline with static and adaptive huffman code, the highest measured
+  // time is kept, until pipeline is measured time is estimated from the fastest mode
+  double costs[2][TILE_PIPELINE_COUNT];
+  bool measured[2][TILE_PIPELINE_COUNT] = {};
+  costs[0][0] = fastest_cost;
+  measured[0][0] = true;
+
+  // Modes from the cheapest, each mode is tried on all tiles before stronger one
+  std::vector<std::pair<uint16_t, uint8_t>> modes;
+  for (uint8_t huffman = 0; huffman < 2; huffman++) {
+    for (uint8_t pipeline = 0; pipeline < TILE_PIPELINE_COUNT; pipeline++) {
+      modes.push_back({TILE_PIPELINE_COST[huffman][pipeline], huffman * TILE_PIPELINE_COUNT + pipeline});
+    }
+  }
+  std::stable_sort(modes.begin(), modes.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+  std::vector<uint8_t> tile;
+  for (const std::pair<uint16_t, uint8_t> &mode : modes) {
+    const uint8_t huffman = mode.second / TILE_PIPELINE_COUNT;
+    const uint8_t pipeline = mode.second % TILE_PIPELINE_COUNT;
+    const CodecSettings candidate = this->GetPipeline(settings, pipeline, huffman == 0);
+
+    for (uint8_t rank = 0; rank < TILE_PREDICTOR_COUNT; rank++) {
+      // Fastest mode with the best predictor was already tried
+      if (huffman == 0 && pipeline == 0 && rank == 0) {
+        continue;
+      }
+
+      for (size_t i = 0; i < this->encoded_tiles.size(); i++) {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+          this->WriteContainer();
+          return;
+        }
+
+        // Attempt is started only when it is expected to finish in time
+        uint32_t tile_width, tile_height;
+        this->CopyTile(i, tile, tile_width, tile_height);
+        const double cost = measured[huffman][pipeline] ? costs[huffman][pipeline] : fastest_cost * mode.first;
+        const double expected = cost * tile.size();
+        if (std::chrono::duration<double, std::nano>(deadline - now).count() < expected) {
+          continue;
+        }
+
+        this->TryTile(i, this->rankings[i][rank], candidate);
+        const double time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - now).count();
+        const double tile_cost = time / std::max<size_t>(tile.size(), 1);
+        costs[huffman][pipeline] = measured[huffman][pipeline] ? std::max(costs[huffman][pipeline], tile_cost) : tile_cost;
+        measured[huffman][pipeline] = true;
+      }
+    }
+  }
+
+  this->WriteContainer();
+}
+
+/**
+ * Save header, index of tiles and encoded tiles into container
+ * */
+void TilesCompressor::WriteContainer() {
+  uint64_t encoded_size = 0;
+  for (const std::vector<uint8_t> &encoded_tile : this->encoded_tiles) {
+    encoded_size += encoded_tile.size();
+  }
+
+  // Allocate buffer for header, tile index and tiles
+  const uint64_t index_size = static_cast<uint64_t>(this->encoded_tiles.size()) * TILES_ENTRY_SIZE;
+  if (this->encoded_buff) {
+    free(this->encoded_buff);
+  }
+  this->encoded_buff = (uint8_t *)malloc(sizeof(uint8_t) * (TILES_HEADER_SIZE + index_size + encoded_size));
+
+  // Invalid pointer
+  assert(this->encoded_buff != nullptr);
+
+  // Magic bytes of container
+  memcpy(this->encoded_buff, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC));
+  this->encoded_index = sizeof(CONTAINER_MAGIC);
+  this->encoded_buff[this->encoded_index++] = CONTAINER_TILES;
+
+  // Size of image and size of tile
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->width, TILES_VALUE_BYTES);
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->height, TILES_VALUE_BYTES);
+  ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->tile_size, TILES_VALUE_BYTES);
+
+  // Index with predictor and size of each tile, followed by encoded tiles
+  for (size_t i = 0; i < this->encoded_tiles.size(); i++) {
+    this->encoded_buff[this->encoded_index++] = this->tile_predictors[i];
+    ByteIo::AppendValue(this->encoded_buff, this->encoded_index, this->encoded_tiles[i].size(), TILES_SIZE_BYTES);
+  }
+  for (const std::vector<uint8_t> &encoded_tile : this->encoded_tiles) {
+    memcpy(&this->encoded_buff[this->encoded_index], encoded_tile.data(), encoded_tile.size());
+    this->encoded_index += encoded_tile.size();
+  }
+}
+
+/**
+ * Return number of compressed tiles, including tiles compressed again with other mode
+ * @returns Number of attempts
+ * */
+uint64_t TilesCompressor::GetAttempts() {
+  return this->attempts;
+}
+
+/**
+ * Return number of attempts, that were smaller than previous result of their tile
+ * @returns Number of improvements
+ * */
+uint64_t TilesCompressor::GetImprovements() {
+  return this->improvements;
+}
+
+/**
+ * Return number of tiles
+ * @returns Number of tiles
+ * */
+size_t TilesCompressor::GetTileCount() {
+  return this->encoded_tiles.size();
+}
+
+/**
+ * Return pointer to container buffer
+ * @returns Pointer to buffer
+ * */
+uint8_t * & TilesCompressor::GetBuffer() {
+  return this->encoded_buff;
+}
+
+/**
+ * Return container buffer size
+ * @returns Size of buffer
+ * */
+uint64_t & TilesCompressor::GetSize() {
+  return this->encoded_index;
+}
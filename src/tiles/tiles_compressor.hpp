@@ -0,0 +1,201 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: tiles_compressor.hpp
+ * Description: Contains definitions of tiles compressor class that is used to split image into tiles
+ * and compress each tile with predictor and pipeline, that give the smallest result for it
+ * */
+#ifndef __TILES_COMPRESSOR__
+#define __TILES_COMPRESSOR__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstring>  // memcpy
+#include <vector>   // vector
+#include <algorithm> // min, max, sort
+#include <chrono>   // steady_clock
+#include <atomic>   // atomic
+#include <cassert>  // assert
+
+#include "tiles.hpp"
+#include "tile_predictor.hpp"
+#include "tile_workers.hpp"
+#include "../container.hpp"
+#include "../image_codec.hpp"
+#include "../context/context_coder.hpp"
+
+/**
+ * Class that will compress image as independent tiles into one container
+ * */
+class TilesCompressor {
+private:
+  // Image which we will be compressing
+  const uint8_t *buffer;
+  uint32_t width;
+  uint32_t height;
+
+  // Size of tile and number of tiles in each direction
+  uint32_t tile_size;
+  uint32_t tiles_x;
+  uint32_t tiles_y;
+
+  // Predictors of each tile ordered by entropy of differences, chosen predictor and smallest encoded data
+  std::vector<std::vector<uint8_t>> rankings;
+  std::vector<uint8_t> tile_predictors;
+  std::vector<std::vector<uint8_t>> encoded_tiles;
+
+  // Number of compressed tiles and number of them, that were smaller than previous result
+  std::atomic<uint64_t> attempts;
+  std::atomic<uint64_t> improvements;
+
+  // Number of threads compressing tiles
+  uint32_t threads;
+
+  // Resulting container
+  uint8_t *encoded_buff;
+  uint64_t encoded_index;
+
+  /**
+   * Split image into tiles of given size, and rank predictors of each tile
+   * @param[in] tile_size Number of pixels in each direction of one tile
+   * @param[in] rank False to skip ranking, when predictor is given
+   * */
+  void InitTiles(const uint32_t &tile_size, const bool &rank = true);
+
+  /**
+   * Copy tile from image into separate buffer
+   * @param[in] index Index of tile, row after row
+   * @param[out] tile Pixels of tile, row after row
+   * @param[out] tile_width Width of tile
+   * @param[out] tile_height Height of tile
+   * */
+  void CopyTile(const size_t &index, std::vector<uint8_t> &tile, uint32_t &tile_width, uint32_t &tile_height);
+
+  /**
+   * Return settings of one of pipelines tried for tiles, differences are already computed by predictor
+   * @param[in] settings Settings of compression pipeline, BWT block size is kept
+   * @param[in] pipeline Index of pipeline, from the fastest to TILE_PIPELINE_COUNT
+   * @param[in] static_huffman True to use static huffman code
+   * @returns Settings of pipeline
+   * */
+  CodecSettings GetPipeline(const CodecSettings &settings, const uint8_t &pipeline, const bool &static_huffman);
+
+  /**
+   * Compress tile with given predictor and settings, result is kept when it is smaller than previous one
+   * @param[in] index Index of tile
+   * @param[in] predictor Identifier of predictor
+   * @param[in] settings Settings of compression pipeline
+   * */
+  void TryTile(const size_t &index, const uint8_t &predictor, const CodecSettings &settings);
+
+  /**
+   * Code differences of tile given by predictor with context coder, result is kept when it is smaller than previous one
+   * @param[in] index Index of tile
+   * @param[in] predictor Identifier of predictor
+   * @param[in] models Number of models of context coder tried
+   * */
+  void TryContextTile(const size_t &index, const uint8_t &predictor, const uint8_t &models);
+
+  /**
+   * Keep encoded tile, when it is smaller than previous result of tile
+   * @param[in] index Index of tile
+   * @param[in] predictor Predictor saved in index of tiles, with TILE_CONTEXT_BIT for context coded tile
+   * @param[in] encoded Encoded tile
+   * @param[in] size Size of encoded tile
+   * */
+  void KeepTile(const size_t &index, const uint8_t &predictor, const uint8_t *encoded, const uint64_t &size);
+
+  /**
+   * Save header, index of tiles and encoded tiles into container
+   * */
+  void WriteContainer();
+
+public:
+  /**
+   * Constructor that will initialize values
+   * @param[in] buffer Image data
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * */
+  TilesCompressor(const uint8_t *buffer, const uint32_t &width, const uint32_t &height);
+
+  /**
+   * Deconstructor that will free allocated data
+   * */
+  ~TilesCompressor();
+
+  /**
+   * Set number of threads compressing tiles, result is the same for any number of threads
+   * @param[in] threads Number of threads, 1 compresses tiles on calling thread
+   * */
+  void SetThreads(const uint32_t &threads);
+
+  /**
+   * Compress each tile with every combination of predictors with the lowest entropy of differences
+   * and first pipelines, the smallest result of each tile is saved
+   * @param[in] settings Settings of compression pipeline, BWT block size and type of huffman code are kept
+   * @param[in] tile_size Number of pixels in each direction of one tile
+   * @param[in] predictors Number of predictors tried for each tile, from 1 to TILE_PREDICTOR_COUNT
+   * @param[in] pipelines Number of pipelines tried for each tile, up to TILE_PIPELINE_COUNT, 0 only with context models
+   * @param[in] context_models Number of models of context coder tried with each predictor, 0 without context coder
+   * */
+  void Compress(
+    const CodecSettings &settings,
+    const uint32_t &tile_size,
+    const uint8_t &predictors,
+    const uint8_t &pipelines,
+    const uint8_t &context_models = 0
+  );
+
+  /**
+   * Compress each tile with one predictor and pipeline given by settings, used by profiles found by tuning
+   * @param[in] settings Settings of compression pipeline, preprocessing is replaced by predictor
+   * @param[in] tile_size Number of pixels in each direction of one tile
+   * @param[in] predictor Identifier of predictor, TILE_PREDICTOR_LOWEST_ENTROPY to rank predictors of each tile
+   * */
+  void CompressWithMode(const CodecSettings &settings, const uint32_t &tile_size, const uint8_t &predictor);
+
+  /**
+   * Compress all tiles with the fastest mode first, then try stronger modes on tiles while they are
+   * expected to finish before deadline, the smallest result of each tile is saved
+   * @param[in] settings Settings of compression pipeline, BWT block size is kept
+   * @param[in] tile_size Number of pixels in each direction of one tile
+   * @param[in] deadline Time, after which no more attempts are started
+   * */
+  void CompressWithDeadline(
+    const CodecSettings &settings,
+    const uint32_t &tile_size,
+    const std::chrono::steady_clock::time_point &deadline
+  );
+
+  /**
+   * Return number of compressed tiles, including tiles compressed again with other mode
+   * @returns Number of attempts
+   * */
+  uint64_t GetAttempts();
+
+  /**
+   * Return number of attempts, that were smaller than previous result of their tile
+   * @returns Number of improvements
+   * */
+  uint64_t GetImprovements();
+
+  /**
+   * Return number of tiles
+   * @returns Number of tiles
+   * */
+  size_t GetTileCount();
+
+  /**
+   * Return pointer to container buffer
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return container buffer size
+   * @returns Size of buffer
+   * */
+  uint64_t & GetSize();
+};
+
+#endif
@@ -0,0 +1,218 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: tiles_decompressor.cpp
+ * Description: Contains implementations of tiles decompressor class that is used to decompress
+ * image from container created by TilesCompressor
+ * */
+#include "tiles_decompressor.hpp"
+#include "../byte_io.hpp"
+
+/**
+ * Constructor for TilesDecompressor that will initialize values
+ * @param[in] buffer Data buffer holding container
+ * @param[in] size Size of data buffer
+ * */
+TilesDecompressor::TilesDecompressor(uint8_t * &buffer, const uint64_t &size) {
+  // Receive buffer
+  this->buffer = buffer;
+  this->size = size;
+
+  // Initialize header values
+  this->width = 0;
+  this->height = 0;
+  this->tile_size = 0;
+
+  // Initialize image
+  this->image = nullptr;
+  this->image_size = 0;
+  this->threads = 1;
+}
+
+/**
+ * Deconstructor that will free decompressed image
+ * */
+TilesDecompressor::~TilesDecompressor() {
+  if (this->image) {
+    free(this->image);
+  }
+
+  // Destroy pointer to outside buffer
+  this->buffer = nullptr;
+}
+
+/**
+ * Read header of container with index of tiles
+ * @returns True when header is valid, false otherwise
+ * */
+bool TilesDecompressor::ReadHeader() {
+  // Check magic bytes and size of header
+  if (!IsContainer(this->buffer, this->size, CONTAINER_TILES) || this->size < TILES_HEADER_SIZE) {
+    std::cerr << "Data are not tiled image!" << std::endl;
+    return false;
+  }
+
+  // Load size of image and size of tile
+  this->width = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE, TILES_VALUE_BYTES);
+  this->height = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE + TILES_VALUE_BYTES, TILES_VALUE_BYTES);
+  this->tile_size = ByteIo::ReadValue(this->buffer, CONTAINER_MAGIC_SIZE + 2 * TILES_VALUE_BYTES, TILES_VALUE_BYTES);
+  if (this->tile_size == 0) {
+    std::cerr << "Invalid size of tile!" << std::endl;
+    return false;
+  }
+
+  // Whole index needs to be loaded
+  const uint64_t tile_count = ((static_cast<uint64_t>(this->width) + this->tile_size - 1) / this->tile_size) *
+    ((static_cast<uint64_t>(this->height) + this->tile_size - 1) / this->tile_size);
+  if (tile_count > (this->size - TILES_HEADER_SIZE) / TILES_ENTRY_SIZE) {
+    std::cerr << "Container does not contain index of all tiles!" << std::endl;
+    return false;
+  }
+
+  // Load predictor and size of each tile, tiles follow index in the same order
+  uint64_t position = TILES_HEADER_SIZE;
+  uint64_t offset = TILES_HEADER_SIZE + tile_count * TILES_ENTRY_SIZE;
+  this->tile_predictors.clear();
+  this->tile_sizes.clear();
+  this->tile_offsets.clear();
+  for (uint64_t i = 0; i < tile_count; i++) {
+    const uint8_t predictor = this->buffer[position];
+    const uint64_t tile_size = ByteIo::ReadValue(this->buffer, position + 1, TILES_SIZE_BYTES);
+    position += TILES_ENTRY_SIZE;
+
+    if ((predictor & ~TILE_CONTEXT_BIT) >= TILE_PREDICTOR_COUNT || tile_size > (this->size - offset)) {
+      std::cerr << "Invalid entry of tile " << i << " in index!" << std::endl;
+      return false;
+    }
+
+    this->tile_predictors.push_back(predictor);
+    this->tile_sizes.push_back(tile_size);
+    this->tile_offsets.push_back(offset);
+    offset += tile_size;
+  }
+
+  return true;
+}
+
+/**
+ * Set number of threads decompressing tiles
+ * @param[in] threads Number of threads, 1 decompresses tiles on calling thread
+ * */
+void TilesDecompressor::SetThreads(const uint32_t &threads) {
+  this->threads = std::max<uint32_t>(threads, 1);
+}
+
+/**
+ * Decompress all tiles into image
+ * @returns True when decompression was successfull, false otherwise
+ * */
+bool TilesDecompressor::Decompress() {
+  const uint64_t tiles_x = (static_cast<uint64_t>(this->width) + this->tile_size - 1) / this->tile_size;
+
+  // Allocate image
+  if (this->image) {
+    free(this->image);
+  }
+  this->image_size = static_cast<uint64_t>(this->width) * this->height;
+  this->image = (uint8_t *)malloc(sizeof(uint8_t) * (this->image_size + 1));
+  if (this->image == nullptr) {
+    std::cerr << "Failed to allocate image of size " << this->width << "x" << this->height << "!" << std::endl;
+    return false;
+  }
+
+  // Each tile is written into its own part of image, failed tiles are reported after all threads finish
+  std::vector<uint8_t> failed(this->tile_sizes.size(), false);
+  TileWorkers::ForEach(this->tile_sizes.size(), this->threads, [&](const size_t &i) {
+    const uint32_t x = (i % tiles_x) * this->tile_size;
+    const uint32_t y = (i / tiles_x) * this->tile_size;
+    const uint32_t tile_width = std::min(this->tile_size, this->width - x);
+    const uint32_t tile_height = std::min(this->tile_size, this->height - y);
+
+    // Decompress differences of tile by context decoder or pipeline and check their size
+    TraceSpan span("tile decode", "block", {{"index", i}, {"bytes", this->tile_sizes[i]}});
+    ImageCodec codec;
+    ContextDecoder context_decoder;
+    uint8_t *differences = nullptr;
+    if (this->tile_predictors[i] & TILE_CONTEXT_BIT) {
+      if (!context_decoder.Decode(&this->buffer[this->tile_offsets[i]], this->tile_sizes[i], tile_width, tile_height)) {
+        failed[i] = true;
+        return;
+      }
+      differences = context_decoder.GetBuffer();
+    } else {
+      if (!codec.Decompress(&this->buffer[this->tile_offsets[i]], this->tile_sizes[i]) ||
+        codec.GetSize() != static_cast<uint64_t>(tile_width) * tile_height)
+      {
+        failed[i] = true;
+        return;
+      }
+      differences = codec.GetBuffer();
+    }
+
+    // Reconstruct pixels and copy them into image
+    TilePredictor::Inverse(this->tile_predictors[i] & ~TILE_CONTEXT_BIT, differences, tile_width, tile_height);
+    for (uint32_t row = 0; row < tile_height; row++) {
+      memcpy(&this->image[static_cast<size_t>(y + row) * this->width + x], &differences[static_cast<size_t>(row) * tile_width], tile_width);
+    }
+  });
+
+  for (size_t i = 0; i < failed.size(); i++) {
+    if (failed[i]) {
+      std::cerr << "Failed to decompress tile " << i << "!" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Return number of tiles
+ * @returns Number of tiles
+ * */
+size_t TilesDecompressor::GetTileCount() {
+  return this->tile_sizes.size();
+}
+
+/**
+ * Return number of tiles coded with each predictor
+ * @returns Number of tiles for each predictor
+ * */
+std::vector<size_t> TilesDecompressor::GetPredictorCounts() {
+  std::vector<size_t> counts(TILE_PREDICTOR_COUNT, 0);
+  for (const uint8_t &predictor : this->tile_predictors) {
+    counts[predictor & ~TILE_CONTEXT_BIT]++;
+  }
+  return counts;
+}
+
+/**
+ * Return width of image
+ * @returns Width
+ * */
+uint32_t TilesDecompressor::GetWidth() {
+  return this->width;
+}
+
+/**
+ * Return height of image
+ * @returns Height
+ * */
+uint32_t TilesDecompressor::GetHeight() {
+  return this->height;
+}
+
+/**
+ * Return pointer to decompressed image
+ * @returns Pointer to buffer
+ * */
+uint8_t * & TilesDecompressor::GetBuffer() {
+  return this->image;
+}
+
+/**
+ * Return size of decompressed image
+ * @returns Size of buffer
+ * */
+uint64_t TilesDecompressor::GetSize() {
+  return this->image_size;
+}
@@ -0,0 +1,119 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: tiles_decompressor.hpp
+ * Description: Contains definitions of tiles decompressor class that is used to decompress
+ * image from container created by TilesCompressor
+ * */
+#ifndef __TILES_DECOMPRESSOR__
+#define __TILES_DECOMPRESSOR__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstring>  // memcpy
+#include <vector>   // vector
+#include <iostream> // cerr
+#include <algorithm> // min
+
+#include "tiles.hpp"
+#include "tile_predictor.hpp"
+#include "tile_workers.hpp"
+#include "../container.hpp"
+#include "../image_codec.hpp"
+#include "../context/context_decoder.hpp"
+
+/**
+ * Class used for decompressing image from tiles container
+ * */
+class TilesDecompressor {
+private:
+  // Buffer that holds loaded container
+  uint8_t *buffer;
+  // Size of loaded data
+  uint64_t size;
+
+  // Size of image and size of tile
+  uint32_t width;
+  uint32_t height;
+  uint32_t tile_size;
+
+  // Predictor, size and position of encoded data of each tile
+  std::vector<uint8_t> tile_predictors;
+  std::vector<uint64_t> tile_sizes;
+  std::vector<uint64_t> tile_offsets;
+
+  // Decompressed image
+  uint8_t *image;
+  uint64_t image_size;
+
+  // Number of threads decompressing tiles
+  uint32_t threads;
+
+public:
+  /**
+   * Constructor for TilesDecompressor that will initialize values
+   * @param[in] buffer Data buffer holding container
+   * @param[in] size Size of data buffer
+   * */
+  TilesDecompressor(uint8_t * &buffer, const uint64_t &size);
+
+  /**
+   * Deconstructor that will free decompressed image
+   * */
+  ~TilesDecompressor();
+
+  /**
+   * Read header of container with index of tiles
+   * @returns True when header is valid, false otherwise
+   * */
+  bool ReadHeader();
+
+  /**
+   * Set number of threads decompressing tiles
+   * @param[in] threads Number of threads, 1 decompresses tiles on calling thread
+   * */
+  void SetThreads(const uint32_t &threads);
+
+  /**
+   * Decompress all tiles into image
+   * @returns True when decompression was successfull, false otherwise
+   * */
+  bool Decompress();
+
+  /**
+   * Return number of tiles
+   * @returns Number of tiles
+   * */
+  size_t GetTileCount();
+
+  /**
+   * Return number of tiles coded with each predictor
+   * @returns Number of tiles for each predictor
+   * */
+  std::vector<size_t> GetPredictorCounts();
+
+  /**
+   * Return width of image
+   * @returns Width
+   * */
+  uint32_t GetWidth();
+
+  /**
+   * Return height of image
+   * @returns Height
+   * */
+  uint32_t GetHeight();
+
+  /**
+   * Return pointer to decompressed image
+   * @returns Pointer to buffer
+   * */
+  uint8_t * & GetBuffer();
+
+  /**
+   * Return size of decompressed image
+   * @returns Size of buffer
+   * */
+  uint64_t GetSize();
+};
+
+#endif
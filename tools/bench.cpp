@@ -0,0 +1,873 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: bench.cpp
+ * Description: Benchmark of hot functions of codec and of whole compression and decompression,
+ * each case is run with warmup and repetitions, results are printed as table and saved as JSON
+ * */
+#include <string>
+#include <sstream>
+#include <fstream>  // ofstream
+#include <iostream>
+#include <iomanip>  // setw, setprecision
+#include <unistd.h> // getopt
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstdlib>  // malloc, free
+#include <cstring>  // memcpy, memcmp
+#include <vector>   // vector
+#include <chrono>   // steady_clock
+#include <functional> // function
+#include <algorithm> // sort
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h> // __rdtsc
+#endif
+
+#include "../src/data_worker.hpp"
+#include "../src/image_codec.hpp"
+#include "../src/rle/rle_compressor.hpp"
+#include "../src/rle/rle_decompressor.hpp"
+#include "../src/huffman/huffman_coder.hpp"
+#include "../src/huffman/huffman_decoder.hpp"
+#include "../src/huffman/static_huffman_coder.hpp"
+#include "../src/huffman/static_huffman_decoder.hpp"
+#include "../src/tiles/tiles_compressor.hpp"
+#include "../src/tiles/tiles_decompressor.hpp"
+#include "../src/stats/perf_counters.hpp"
+#include "../src/stats/alloc_counters.hpp"
+#include "corpus.hpp"
+#include "regression.hpp"
+
+// Version of JSON output, changed when its fields change
+constexpr uint8_t BENCH_JSON_VERSION = 4;
+
+/**
+ * Settings of benchmark, given by arguments
+ * @param input_files Images given by -i as <filename>:<width>, image.raw of width 512 when no image is given
+ * @param synthetic_specs Synthetic images given by -g, generated in memory
+ * @param width Number specified in -w param, used for images without width
+ * @param warmup Number specified in -W param, runs of each case before measuring
+ * @param repetitions Number specified in -r param, measured runs of each case
+ * @param filter Text given by -f, only cases containing it in their name are run
+ * @param json_file Name of file given by -j, where results are saved as JSON
+ * @param memory True when -m is present, allocation counters and peak RSS are printed in table
+ * @param max_threads Number specified in -T param, 0 when thread scaling is not measured
+ * @param tile_sizes Tile sizes specified in -S param, used by thread scaling
+ * @param baseline_file Name of baseline JSON given by -B, results are compared with it
+ * @param noise Number specified in -N param, allowed decrease of throughput in percent, REGRESSION_NO_SPEED without -N
+ * @param perf_counters Hardware counters opened by main, nullptr when they are not available
+ * */
+typedef struct BenchArguments {
+  std::vector<std::string> input_files;
+  std::vector<std::string> synthetic_specs;
+  uint32_t width;
+  uint32_t warmup;
+  uint32_t repetitions;
+  std::string filter;
+  std::string json_file;
+  bool memory;
+  uint32_t max_threads;
+  std::vector<uint32_t> tile_sizes;
+  std::string baseline_file;
+  double noise;
+  PerfCounters *perf_counters;
+} BenchArguments;
+
+/**
+ * Result of one case on one image
+ * @param name Name of case
+ * @param image Name of image
+ * @param bytes Size of input of case
+ * @param pixels Number of pixels of image
+ * @param times Time of each repetition in seconds
+ * @param cycles Time stamp counter cycles of each repetition, empty when counter is not available
+ * @param counters Hardware counters of each repetition, empty when they are not available
+ * @param ratio Size of image divided by size of result, 0 for cases without compressed result
+ * @param alloc Allocation counters of the last repetition, the same for every repetition
+ * @param peak_rss Peak RSS in KiB during case, with warmup and setup
+ * @param threads Number of threads of thread scaling case, 0 for other cases
+ * @param speedup Median time of 1 thread divided by median time of case, 0 for other cases
+ * */
+typedef struct BenchResult {
+  std::string name;
+  std::string image;
+  uint64_t bytes;
+  uint64_t pixels;
+  std::vector<double> times;
+  std::vector<uint64_t> cycles;
+  std::vector<PerfValues> counters;
+  double ratio;
+  AllocValues alloc;
+  uint64_t peak_rss;
+  uint32_t threads;
+  double speedup;
+} BenchResult;
+
+/**
+ * Settings of one end-to-end case
+ * @param name Params of huff_codec with the same pipeline
+ * @param settings Settings of compression pipeline
+ * */
+typedef struct PipelineCase {
+  std::string name;
+  CodecSettings settings;
+} PipelineCase;
+
+// Pipelines measured end-to-end, static huffman code (-1 to -3) and adaptive huffman code (-4, -5)
+const std::vector<PipelineCase> BENCH_PIPELINES = {
+  {"-1", {false, false, false, false, BWT_DEFAULT_BLOCK_SIZE, 0, true}},
+  {"-3", {true, true, false, false, BWT_DEFAULT_BLOCK_SIZE, 0, true}},
+  {"-m", {true, false, false, false, BWT_DEFAULT_BLOCK_SIZE, 0, false}},
+  {"-m -a", {true, true, false, false, BWT_DEFAULT_BLOCK_SIZE, 0, false}},
+  {"-m -a -q", {true, true, true, false, BWT_DEFAULT_BLOCK_SIZE, 0, false}},
+  {"-m -a -b", {true, true, false, true, BWT_DEFAULT_BLOCK_SIZE, 0, false}}
+};
+
+// Tiles of thread scaling are coded with the fastest mode, best predictor, RLE and static huffman code
+const CodecSettings BENCH_SCALING_SETTINGS = {false, false, false, false, BWT_DEFAULT_BLOCK_SIZE, 0, true};
+
+// Tile sizes of thread scaling, when no -S is given
+const std::vector<uint32_t> BENCH_SCALING_TILE_SIZES = {64, TILES_DEFAULT_SIZE};
+
+/**
+ * Read time stamp counter
+ * @param[out] cycles Value of counter
+ * @returns True when counter is available, false otherwise
+ * */
+bool read_cycles(uint64_t &cycles) {
+#if defined(__x86_64__) || defined(__i386__)
+  cycles = __rdtsc();
+  return true;
+#else
+  cycles = 0;
+  return false;
+#endif
+}
+
+/**
+ * Return median of values
+ * @param[in] values Values, copied for sorting
+ * @returns Median, 0 for no values
+ * */
+template<typename T>
+double median(std::vector<T> values) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  const size_t half = values.size() / 2;
+  return (values.size() % 2 == 1) ? values[half] : (values[half - 1] + values[half]) / 2.0;
+}
+
+/**
+ * Return median of hardware counter over repetitions
+ * @param[in] counters Hardware counters of each repetition
+ * @param[in] counter Index of counter
+ * @param[out] value Median of counter
+ * @returns True when counter was measured in each repetition, false otherwise
+ * */
+bool median_counter(const std::vector<PerfValues> &counters, const uint8_t &counter, double &value) {
+  std::vector<uint64_t> values;
+  for (const PerfValues &perf_values : counters) {
+    if (!perf_values.available[counter]) {
+      return false;
+    }
+    values.push_back(perf_values.values[counter]);
+  }
+  value = median(values);
+  return !values.empty();
+}
+
+/**
+ * Print help of tool
+ * */
+void print_help() {
+  std::cout << "Usage: ./huff_bench [-i <file>:<width> ...] [-g <synthetic> ...] [-w <width>] [-W <warmup>] [-r <repetitions>] "
+    "[-f <filter>] [-j <file>] [-m] [-T <threads> [-S <sizes>]] [-B <baseline> [-N <noise>]]" << std::endl
+    << "  -i <file>:<width>   raw image, can be repeated (default image.raw:512)" << std::endl
+    << "  -g <synthetic>      synthetic image generated in memory, as by ./huff_generate, corpus for all" << std::endl
+    << "  -W <warmup>         runs of each case before measuring (default 1)" << std::endl
+    << "  -r <repetitions>    measured runs of each case (default 5)" << std::endl
+    << "  -f <filter>         run only cases containing filter in their name" << std::endl
+    << "  -j <file>           save results as JSON" << std::endl
+    << "  -T <threads>        measure only thread scaling of tiles on 1, 2, 4 ... threads, 0 for all hardware threads" << std::endl
+    << "  -S <sizes>          comma separated tile sizes of thread scaling (default 64,256)" << std::endl
+    << "  -B <baseline>       compare results with JSON saved by -j, fails when ratio decreased by more than 0.1 %" << std::endl
+    << "                      or case of baseline was not run" << std::endl
+    << "  -N <noise>          compare also throughput, fails when it decreased by more than noise in percent," << std::endl
+    << "                      median and minimal time need to exceed it, only cases of baseline slower than 10 ms" << std::endl
+    << "  -m                  print allocations, reallocations, growths of vectors and queues, copied KiB and peak RSS of each case" << std::endl
+    << "Hardware counters (IPC, branch, L1d, LLC and dTLB misses per 1000 pixels) are measured when perf_event_open is permitted." << std::endl;
+}
+
+/**
+ * Function will parse arguments and assign their values to given structure
+ * @param[in] argc Number of arguments
+ * @param[in] argv Array of arguments
+ * @param[out] arguments Structure holding values of all arguments
+ * @return True when all arguments were rightly formatted, false otherwise
+ **/
+bool parse_arguments(const int &argc, char* argv[], BenchArguments &arguments) {
+  arguments.width = 0;
+  arguments.warmup = 1;
+  arguments.repetitions = 5;
+  arguments.filter = "";
+  arguments.json_file = "";
+  arguments.memory = false;
+  arguments.max_threads = 0;
+  arguments.baseline_file = "";
+  arguments.noise = REGRESSION_NO_SPEED;
+  bool scaling = false;
+  arguments.perf_counters = nullptr;
+
+  int opt;
+  while ((opt = getopt(argc, argv, ":i:g:w:W:r:f:j:mT:S:B:N:h")) != -1) {
+    switch (opt) {
+      case 'i':
+        arguments.input_files.push_back(optarg);
+        break;
+      case 'g':
+        arguments.synthetic_specs.push_back(optarg);
+        break;
+      case 'w':
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.width;
+        }
+        break;
+      case 'W':
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.warmup;
+          if (sstream.fail()) {
+            std::cerr << "Number of warmup runs, needs to be >= 0!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      case 'r':
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.repetitions;
+          if (sstream.fail() || arguments.repetitions < 1) {
+            std::cerr << "Number of repetitions, needs to be >= 1!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      case 'f':
+        arguments.filter = optarg;
+        break;
+      case 'j':
+        arguments.json_file = optarg;
+        break;
+      case 'm':
+        arguments.memory = true;
+        break;
+      case 'B':
+        arguments.baseline_file = optarg;
+        break;
+      case 'N':
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.noise;
+          if (sstream.fail() || arguments.noise < 0) {
+            std::cerr << "Noise of throughput, needs to be >= 0 %!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      case 'T':
+        {
+          int64_t max_threads = 0;
+          std::stringstream sstream(optarg);
+          sstream >> max_threads;
+          if (sstream.fail() || max_threads < 0 || max_threads > TILE_WORKERS_MAX_THREADS) {
+            std::cerr << "Number of threads, needs to be from 0 to " << TILE_WORKERS_MAX_THREADS << "!" << std::endl;
+            return false;
+          }
+          arguments.max_threads = static_cast<uint32_t>(max_threads);
+          scaling = true;
+        }
+        break;
+      case 'S':
+        {
+          std::stringstream sstream(optarg);
+          std::string size;
+          while (std::getline(sstream, size, ',')) {
+            std::stringstream size_stream(size);
+            uint32_t tile_size = 0;
+            size_stream >> tile_size;
+            if (size_stream.fail() || tile_size < 1) {
+              std::cerr << "Tile size, needs to be >= 1!" << std::endl;
+              return false;
+            }
+            arguments.tile_sizes.push_back(tile_size);
+          }
+        }
+        break;
+      case 'h':
+        print_help();
+        return false;
+      case ':':
+        std::cerr << "Option needs a value" << std::endl;
+        return false;
+      case '?':
+        std::cerr << "Unknown param" << std::endl;
+        return false;
+    }
+  }
+
+  if (arguments.input_files.empty() && arguments.synthetic_specs.empty()) {
+    arguments.input_files.push_back("image.raw:512");
+  }
+  if (scaling && arguments.max_threads == 0) {
+    arguments.max_threads = TileWorkers::GetHardwareThreads();
+  }
+  if (arguments.tile_sizes.empty()) {
+    arguments.tile_sizes = BENCH_SCALING_TILE_SIZES;
+  }
+  return true;
+}
+
+/**
+ * Return true when case is selected by filter
+ * @param[in] arguments Settings of benchmark
+ * @param[in] name Name of case
+ * @returns True when name contains filter
+ * */
+bool selected(const BenchArguments &arguments, const std::string &name) {
+  return name.find(arguments.filter) != std::string::npos;
+}
+
+/**
+ * Measure case with warmup and repetitions, only run is measured, setup prepares its input before each run
+ * @param[in] arguments Settings of benchmark
+ * @param[in] name Name of case
+ * @param[in] image Image, that input of case was made from
+ * @param[in] bytes Size of input of case
+ * @param[in] setup Function preparing input of run
+ * @param[in] run Measured function
+ * @param[in] ratio Size of image divided by size of result, 0 for cases without compressed result
+ * @returns Result of case
+ * */
+BenchResult measure_case(
+  const BenchArguments &arguments,
+  const std::string &name,
+  const CorpusImage &image,
+  const uint64_t &bytes,
+  const std::function<void()> &setup,
+  const std::function<void()> &run,
+  const double &ratio
+) {
+  BenchResult result = {name, image.name, bytes, image.pixels.size(), {}, {}, {}, ratio, {0, 0, 0, 0, 0}, 0, 0, 0};
+  AllocCounters::ResetPeakRss();
+  for (uint32_t i = 0; i < arguments.warmup + arguments.repetitions; i++) {
+    setup();
+    AllocCounters::Reset();
+
+    uint64_t start_cycles, end_cycles;
+    if (arguments.perf_counters != nullptr) {
+      arguments.perf_counters->Start();
+    }
+    const bool cycles = read_cycles(start_cycles);
+    const auto start = std::chrono::steady_clock::now();
+    run();
+    const double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    read_cycles(end_cycles);
+    const PerfValues perf_values = (arguments.perf_counters != nullptr) ? arguments.perf_counters->Stop() : PerfValues();
+
+    // Warmup runs fill caches and allocator, they are not measured
+    if (i >= arguments.warmup) {
+      result.times.push_back(time);
+      if (cycles) {
+        result.cycles.push_back(end_cycles - start_cycles);
+      }
+      if (arguments.perf_counters != nullptr) {
+        result.counters.push_back(perf_values);
+      }
+      result.alloc = AllocCounters::Get();
+    }
+  }
+  result.peak_rss = AllocCounters::GetPeakRss();
+  return result;
+}
+
+/**
+ * Print result of case as row of table
+ * @param[in] arguments Settings of benchmark
+ * @param[in] result Result of case
+ * */
+void print_result(const BenchArguments &arguments, const BenchResult &result) {
+  const double median_time = median(result.times);
+  std::cout << std::left << std::setw(22) << result.name << std::right << std::fixed << std::setprecision(3)
+    << std::setw(11) << median_time * 1e3 << std::setw(11) << *std::min_element(result.times.begin(), result.times.end()) * 1e3
+    << std::setprecision(2) << std::setw(10) << result.bytes / 1e6 / std::max(median_time, 1e-12)
+    << std::setw(10) << median(result.cycles) / std::max<uint64_t>(result.pixels, 1);
+  std::cout << std::setprecision(4) << std::setw(9);
+  if (result.ratio > 0) {
+    std::cout << result.ratio;
+  } else {
+    std::cout << "";
+  }
+
+  // Allocations of one run and peak RSS of case
+  if (arguments.memory) {
+    std::cout << std::setw(9) << result.alloc.allocations << std::setw(9) << result.alloc.reallocations
+      << std::setw(9) << result.alloc.vector_growths + result.alloc.queue_growths
+      << std::setprecision(1) << std::setw(12) << result.alloc.bytes_copied / 1024.0
+      << std::setw(9) << result.peak_rss / 1024.0;
+  }
+
+  // Instructions per cycle and misses per 1000 pixels, counters that were not measured are printed as -
+  if (arguments.perf_counters != nullptr) {
+    double cycles_value, instructions_value;
+    if (median_counter(result.counters, PERF_CYCLES, cycles_value) && median_counter(result.counters, PERF_INSTRUCTIONS, instructions_value)) {
+      std::cout << std::setprecision(2) << std::setw(7) << instructions_value / std::max(cycles_value, 1.0);
+    } else {
+      std::cout << std::setw(7) << "-";
+    }
+    for (const uint8_t &counter : {PERF_BRANCH_MISSES, PERF_L1D_MISSES, PERF_LLC_MISSES, PERF_DTLB_MISSES}) {
+      double value;
+      if (median_counter(result.counters, counter, value)) {
+        std::cout << std::setprecision(1) << std::setw(10) << value * 1000 / std::max<uint64_t>(result.pixels, 1);
+      } else {
+        std::cout << std::setw(10) << "-";
+      }
+    }
+  }
+  std::cout << std::endl;
+}
+
+/**
+ * Run case with warmup and repetitions, only run is measured, setup prepares its input before each run
+ * @param[in] arguments Settings of benchmark
+ * @param[in] name Name of case
+ * @param[in] image Image, that input of case was made from
+ * @param[in] bytes Size of input of case
+ * @param[in] setup Function preparing input of run
+ * @param[in] run Measured function
+ * @param[in] ratio Size of image divided by size of result, 0 for cases without compressed result
+ * @param[out] results Results, where result of case is added
+ * */
+void run_case(
+  const BenchArguments &arguments,
+  const std::string &name,
+  const CorpusImage &image,
+  const uint64_t &bytes,
+  const std::function<void()> &setup,
+  const std::function<void()> &run,
+  const double &ratio,
+  std::vector<BenchResult> &results
+) {
+  if (!selected(arguments, name)) {
+    return;
+  }
+
+  const BenchResult result = measure_case(arguments, name, image, bytes, setup, run, ratio);
+  print_result(arguments, result);
+  results.push_back(result);
+}
+
+/**
+ * Scanning of RLE compressor in one direction, private scanning functions are reached as friend of RleCompressor
+ * */
+struct RleScanningBench {
+  /**
+   * Scan preprocessed image in one direction, with settings byte of that direction
+   * @param[in] rle_compressor RLE compressor of image
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * @param[in] vertical True for vertical scanning, false for horizontal one
+   * */
+  static void Scan(RleCompressor &rle_compressor, const uint32_t &width, const uint32_t &height, const bool &vertical) {
+    uint8_t settings = vertical ? MODEL_MASK : (SCANNING_MASK | MODEL_MASK);
+    rle_compressor.appendSettingsToBuff(settings, width, height);
+    if (vertical) {
+      rle_compressor.VerticalScanning(width, height);
+    } else {
+      rle_compressor.HorizontalScanning(width, height);
+    }
+  }
+};
+
+/**
+ * Run benchmark of each hot function on image, functions get input made by previous stages of -m pipeline
+ * @param[in] arguments Settings of benchmark
+ * @param[in] image Image of corpus
+ * @param[out] results Results, where results of cases are added
+ * */
+void bench_functions(const BenchArguments &arguments, const CorpusImage &image, std::vector<BenchResult> &results) {
+  const uint64_t size = image.pixels.size();
+  uint8_t *buffer = (uint8_t *)malloc(sizeof(uint8_t) * size);
+
+  // Difference of pixels
+  run_case(arguments, "Preprocess", image, size,
+    [&]() { memcpy(buffer, image.pixels.data(), size); },
+    [&]() { DataWorker::Preprocess(buffer, size, 0); }, 0, results);
+
+  memcpy(buffer, image.pixels.data(), size);
+  DataWorker::Preprocess(buffer, size, 0);
+  const std::vector<uint8_t> preprocessed(buffer, buffer + size);
+
+  run_case(arguments, "Depreprocess", image, size,
+    [&]() { memcpy(buffer, preprocessed.data(), size); },
+    [&]() { DataWorker::Depreprocess(buffer, size, 0); }, 0, results);
+  free(buffer);
+
+  // RLE of differences in each direction
+  run_case(arguments, "HorizontalScanning", image, size, []() {}, [&]() {
+    RleCompressor rle_compressor(preprocessed.data(), image.width, image.height);
+    RleScanningBench::Scan(rle_compressor, image.width, image.height, false);
+  }, 0, results);
+
+  run_case(arguments, "VerticalScanning", image, size, []() {}, [&]() {
+    RleCompressor rle_compressor(preprocessed.data(), image.width, image.height);
+    RleScanningBench::Scan(rle_compressor, image.width, image.height, true);
+  }, 0, results);
+
+  RleCompressor rle_compressor(preprocessed.data(), image.width, image.height);
+  rle_compressor.SequenceScanning(image.width, image.height, true);
+  std::vector<uint8_t> rle(rle_compressor.GetBuffer(), rle_compressor.GetBuffer() + rle_compressor.GetSize());
+  uint8_t *rle_data = rle.data();
+
+  // GetValCount is private, it is measured by horizontal RLE decompression, which is its loop
+  run_case(arguments, "GetValCount", image, rle.size(), []() {}, [&]() {
+    RleDecompressor rle_decompressor(rle_data, rle.size());
+    bool convert_from_model;
+    rle_decompressor.Decompress(convert_from_model);
+  }, 0, results);
+
+  // Adaptive and static huffman code of RLE data
+  uint8_t huffman_settings = 0;
+  std::vector<uint8_t> huffman;
+  run_case(arguments, "Encode", image, rle.size(), []() {}, [&]() {
+    HuffmanCoder huffman_coder;
+    huffman_coder.Encode(rle_data, rle.size(), huffman_settings);
+    huffman.assign(huffman_coder.GetBuffer(), huffman_coder.GetBuffer() + huffman_coder.GetSize());
+  }, 0, results);
+
+  if (huffman.empty() && selected(arguments, "Decode")) {
+    HuffmanCoder huffman_coder;
+    huffman_coder.Encode(rle_data, rle.size(), huffman_settings);
+    huffman.assign(huffman_coder.GetBuffer(), huffman_coder.GetBuffer() + huffman_coder.GetSize());
+  }
+  uint8_t *huffman_data = huffman.data();
+
+  run_case(arguments, "Decode", image, huffman.size(), []() {}, [&]() {
+    HuffmanDecoder huffman_decoder;
+    huffman_decoder.Decode(huffman_settings, huffman_data, huffman.size());
+  }, 0, results);
+
+  uint8_t static_settings = 0;
+  std::vector<uint8_t> static_huffman;
+  run_case(arguments, "StaticEncode", image, rle.size(), []() {}, [&]() {
+    StaticHuffmanCoder static_huffman_coder;
+    static_huffman_coder.Encode(rle_data, rle.size(), static_settings);
+    static_huffman.assign(static_huffman_coder.GetBuffer(), static_huffman_coder.GetBuffer() + static_huffman_coder.GetSize());
+  }, 0, results);
+
+  if (static_huffman.empty() && selected(arguments, "StaticDecode")) {
+    StaticHuffmanCoder static_huffman_coder;
+    static_huffman_coder.Encode(rle_data, rle.size(), static_settings);
+    static_huffman.assign(static_huffman_coder.GetBuffer(), static_huffman_coder.GetBuffer() + static_huffman_coder.GetSize());
+  }
+
+  run_case(arguments, "StaticDecode", image, static_huffman.size(), []() {}, [&]() {
+    StaticHuffmanDecoder static_huffman_decoder;
+    static_huffman_decoder.Decode(static_settings, static_huffman.data(), static_huffman.size());
+  }, 0, results);
+}
+
+/**
+ * Run benchmark of compression and decompression of image with each pipeline, round trip is checked once
+ * @param[in] arguments Settings of benchmark
+ * @param[in] image Image of corpus
+ * @param[out] results Results, where results of cases are added
+ * @returns True when each pipeline decompressed image back, false otherwise
+ * */
+bool bench_pipelines(const BenchArguments &arguments, const CorpusImage &image, std::vector<BenchResult> &results) {
+  const uint64_t size = image.pixels.size();
+
+  for (const PipelineCase &pipeline : BENCH_PIPELINES) {
+    if (!selected(arguments, "compress " + pipeline.name) && !selected(arguments, "decompress " + pipeline.name)) {
+      continue;
+    }
+
+    // Result of compression, that is decompressed and checked
+    std::vector<uint8_t> encoded;
+    {
+      ImageCodec image_codec;
+      image_codec.Compress(image.pixels.data(), image.width, image.height, pipeline.settings);
+      encoded.assign(image_codec.GetBuffer(), image_codec.GetBuffer() + image_codec.GetSize());
+    }
+    const double ratio = static_cast<double>(size) / std::max<size_t>(encoded.size(), 1);
+
+    run_case(arguments, "compress " + pipeline.name, image, size, []() {}, [&]() {
+      ImageCodec image_codec;
+      image_codec.Compress(image.pixels.data(), image.width, image.height, pipeline.settings);
+    }, ratio, results);
+
+    std::vector<uint8_t> data;
+    bool decompressed = true;
+    run_case(arguments, "decompress " + pipeline.name, image, size, [&]() { data = encoded; }, [&]() {
+      ImageCodec image_codec;
+      decompressed = image_codec.Decompress(data.data(), data.size()) && image_codec.GetSize() == size &&
+        memcmp(image_codec.GetBuffer(), image.pixels.data(), size) == 0;
+    }, ratio, results);
+
+    if (!decompressed) {
+      std::cerr << "Pipeline " << pipeline.name << " failed to decompress " << image.name << "!" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Print speedup, efficiency and throughput per thread of thread scaling case
+ * @param[in] result Result of case, speedup is set from median time of 1 thread
+ * @param[in] single_time Median time of the same case on 1 thread
+ * */
+void print_scaling(BenchResult &result, const double &single_time) {
+  const double median_time = median(result.times);
+  const double throughput = result.bytes / 1e6 / std::max(median_time, 1e-12);
+  result.speedup = single_time / std::max(median_time, 1e-12);
+  std::cout << std::fixed << std::setprecision(3) << std::setw(12) << median_time * 1e3 << std::setprecision(2)
+    << std::setw(10) << throughput << std::setw(9) << result.speedup << std::setw(8) << result.speedup / result.threads
+    << std::setw(11) << throughput / result.threads;
+}
+
+/**
+ * Run benchmark of tiles compression and decompression of image on 1, 2, 4 ... threads with each tile size,
+ * output of every number of threads is compared with output of 1 thread
+ * @param[in] arguments Settings of benchmark
+ * @param[in] image Image of corpus
+ * @param[out] results Results, where results of cases are added
+ * @returns True when output did not depend on number of threads and image was decompressed back, false otherwise
+ * */
+bool bench_scaling(const BenchArguments &arguments, const CorpusImage &image, std::vector<BenchResult> &results) {
+  const uint64_t size = image.pixels.size();
+
+  // Powers of two, followed by maximal number of threads
+  std::vector<uint32_t> thread_counts;
+  for (uint32_t threads = 1; threads < arguments.max_threads; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(arguments.max_threads);
+
+  for (const uint32_t &tile_size : arguments.tile_sizes) {
+    const uint64_t tiles = ((image.width + static_cast<uint64_t>(tile_size) - 1) / tile_size) *
+      ((image.height + static_cast<uint64_t>(tile_size) - 1) / tile_size);
+    std::cout << "tile " << tile_size << ", " << tiles << " tiles" << std::endl;
+    std::cout << std::setw(7) << "threads" << std::setw(12) << "compress ms" << std::setw(10) << "MB/s" << std::setw(9) << "speedup"
+      << std::setw(8) << "effic." << std::setw(11) << "MB/s/thr" << std::setw(12) << "decomp. ms" << std::setw(10) << "MB/s"
+      << std::setw(9) << "speedup" << std::setw(8) << "effic." << std::setw(11) << "MB/s/thr" << std::endl;
+
+    std::vector<uint8_t> reference;
+    double compress_time = 0;
+    double decompress_time = 0;
+    for (const uint32_t &threads : thread_counts) {
+      const std::string suffix = " tile " + std::to_string(tile_size) + " threads " + std::to_string(threads);
+
+      std::vector<uint8_t> encoded;
+      BenchResult compress = measure_case(arguments, "scaling compress" + suffix, image, size, []() {}, [&]() {
+        TilesCompressor tiles_compressor(image.pixels.data(), image.width, image.height);
+        tiles_compressor.SetThreads(threads);
+        tiles_compressor.Compress(BENCH_SCALING_SETTINGS, tile_size, 1, 1);
+        encoded.assign(tiles_compressor.GetBuffer(), tiles_compressor.GetBuffer() + tiles_compressor.GetSize());
+      }, 0);
+      compress.threads = threads;
+      compress.ratio = static_cast<double>(size) / std::max<size_t>(encoded.size(), 1);
+
+      // Tiles are independent, so container has to be the same for any number of threads
+      if (threads == 1) {
+        reference = encoded;
+      } else if (encoded != reference) {
+        std::cerr << "Output of " << threads << " threads differs from output of 1 thread on " << image.name << "!" << std::endl;
+        return false;
+      }
+
+      std::vector<uint8_t> data;
+      bool decompressed = true;
+      BenchResult decompress = measure_case(arguments, "scaling decompress" + suffix, image, size, [&]() { data = encoded; }, [&]() {
+        uint8_t *data_pointer = data.data();
+        TilesDecompressor tiles_decompressor(data_pointer, data.size());
+        tiles_decompressor.SetThreads(threads);
+        decompressed = tiles_decompressor.ReadHeader() && tiles_decompressor.Decompress() && tiles_decompressor.GetSize() == size &&
+          memcmp(tiles_decompressor.GetBuffer(), image.pixels.data(), size) == 0;
+      }, compress.ratio);
+      decompress.threads = threads;
+
+      if (!decompressed) {
+        std::cerr << "Tiles of " << threads << " threads failed to decompress " << image.name << "!" << std::endl;
+        return false;
+      }
+
+      if (threads == 1) {
+        compress_time = median(compress.times);
+        decompress_time = median(decompress.times);
+      }
+      std::cout << std::setw(7) << threads;
+      print_scaling(compress, compress_time);
+      print_scaling(decompress, decompress_time);
+      std::cout << std::endl;
+
+      results.push_back(compress);
+      results.push_back(decompress);
+    }
+  }
+  return true;
+}
+
+/**
+ * Return text as JSON string, with quotes and backslashes escaped
+ * @param[in] text Text
+ * @returns JSON string with quotes
+ * */
+std::string json_string(const std::string &text) {
+  std::string result = "\"";
+  for (const char &character : text) {
+    if (character == '"' || character == '\\') {
+      result += '\\';
+    }
+    result += character;
+  }
+  return result + "\"";
+}
+
+/**
+ * Save results as JSON
+ * @param[in] arguments Settings of benchmark
+ * @param[in] results Results of all cases
+ * @returns True when file was written, false otherwise
+ * */
+bool write_json(const BenchArguments &arguments, const std::vector<BenchResult> &results) {
+  std::ofstream file(arguments.json_file);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  file << std::setprecision(9) << "{\n  \"version\": " << +BENCH_JSON_VERSION << ",\n  \"warmup\": " << arguments.warmup
+    << ",\n  \"repetitions\": " << arguments.repetitions << ",\n  \"results\": [";
+  for (size_t i = 0; i < results.size(); i++) {
+    const BenchResult &result = results[i];
+    const double median_time = median(result.times);
+    const double cycles_per_pixel = median(result.cycles) / std::max<uint64_t>(result.pixels, 1);
+
+    file << (i > 0 ? "," : "") << "\n    {\"name\": " << json_string(result.name) << ", \"image\": " << json_string(result.image)
+      << ", \"bytes\": " << result.bytes << ", \"pixels\": " << result.pixels
+      << ", \"median_ms\": " << median_time * 1e3
+      << ", \"min_ms\": " << *std::min_element(result.times.begin(), result.times.end()) * 1e3
+      << ", \"mb_per_s\": " << result.bytes / 1e6 / std::max(median_time, 1e-12)
+      << ", \"cycles_per_pixel\": " << cycles_per_pixel << ", \"ratio\": " << result.ratio
+      << ", \"alloc\": {\"allocations\": " << result.alloc.allocations << ", \"reallocations\": " << result.alloc.reallocations
+      << ", \"vector_growths\": " << result.alloc.vector_growths << ", \"queue_growths\": " << result.alloc.queue_growths
+      << ", \"bytes_copied\": " << result.alloc.bytes_copied << "}, \"peak_rss_kib\": " << result.peak_rss;
+    if (result.threads > 0) {
+      file << ", \"threads\": " << result.threads << ", \"speedup\": " << result.speedup
+        << ", \"efficiency\": " << result.speedup / result.threads;
+    }
+
+    // Median of each measured hardware counter per run
+    if (!result.counters.empty()) {
+      file << ", \"counters\": {";
+      bool first = true;
+      for (uint8_t counter = 0; counter < PERF_COUNTER_COUNT; counter++) {
+        double value;
+        if (median_counter(result.counters, counter, value)) {
+          file << (first ? "" : ", ") << json_string(PerfCounters::GetName(counter)) << ": " << value;
+          first = false;
+        }
+      }
+      file << "}";
+    }
+    file << "}";
+  }
+  file << "\n  ]\n}\n";
+  return file.good();
+}
+
+/**
+ * Main function of benchmark
+ * @param[in] argc Number of arguments
+ * @param[in] argv Array of arguments
+ * @returns 0 when all cases passed, 1 otherwise
+ * */
+int main(int argc, char* argv[]) {
+  BenchArguments arguments;
+  if (!parse_arguments(argc, argv, arguments)) {
+    return 1;
+  }
+
+  std::vector<CorpusImage> corpus;
+  if (!load_corpus(arguments.input_files, arguments.width, corpus) || !generate_corpus(arguments.synthetic_specs, corpus)) {
+    return 1;
+  }
+
+  // Baseline is loaded before measuring, so invalid baseline does not waste run
+  std::vector<CaseResult> baseline;
+  if (arguments.baseline_file != "" && !load_baseline(arguments.baseline_file, baseline)) {
+    return 1;
+  }
+
+  // Hardware counters are measured only when perf_event_open is permitted
+  PerfCounters perf_counters;
+  if (perf_counters.Open()) {
+    arguments.perf_counters = &perf_counters;
+  } else {
+    std::cerr << "Hardware counters are not available (" << perf_counters.GetError() << ")" << std::endl;
+  }
+
+  std::vector<BenchResult> results;
+  for (const CorpusImage &image : corpus) {
+    std::cout << image.name << " " << image.width << "x" << image.height << ", warmup " << arguments.warmup
+      << ", repetitions " << arguments.repetitions << std::endl;
+
+    // When given -T, measure only thread scaling
+    if (arguments.max_threads > 0) {
+      if (!bench_scaling(arguments, image, results)) {
+        return 1;
+      }
+      std::cout << std::endl;
+      continue;
+    }
+
+    std::cout << std::left << std::setw(22) << "case" << std::right << std::setw(11) << "median ms" << std::setw(11)
+      << "min ms" << std::setw(10) << "MB/s" << std::setw(10) << "cyc/px" << std::setw(9) << "ratio";
+    if (arguments.memory) {
+      std::cout << std::setw(9) << "allocs" << std::setw(9) << "reallocs" << std::setw(9) << "growths"
+        << std::setw(12) << "copied KiB" << std::setw(9) << "RSS MiB";
+    }
+    if (arguments.perf_counters != nullptr) {
+      std::cout << std::setw(7) << "IPC" << std::setw(10) << "brmiss/k" << std::setw(10) << "L1d/k" << std::setw(10) << "LLC/k"
+        << std::setw(10) << "dTLB/k";
+    }
+    std::cout << std::endl;
+
+    bench_functions(arguments, image, results);
+    if (!bench_pipelines(arguments, image, results)) {
+      return 1;
+    }
+    std::cout << std::endl;
+  }
+
+  if (arguments.json_file != "" && !write_json(arguments, results)) {
+    std::cerr << "Failed to write results to given file." << std::endl;
+    return 1;
+  }
+
+  // When given -B, flag cases that regressed against baseline
+  if (arguments.baseline_file != "") {
+    std::vector<CaseResult> case_results;
+    for (const BenchResult &result : results) {
+      case_results.push_back({result.name, result.image, median(result.times) * 1e3,
+        *std::min_element(result.times.begin(), result.times.end()) * 1e3,
+        result.bytes / 1e6 / std::max(median(result.times), 1e-12), result.ratio});
+    }
+    if (compare_baseline(baseline, case_results, arguments.noise) > 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: corpus.cpp
+ * Description: Contains implementations of corpus of raw images shared by tools, that measure codec on them
+ * */
+#include "corpus.hpp"
+
+/**
+ * Load raw images, input can be given as <filename>:<width>
+ * @param[in] inputs Names of files, with width after last colon
+ * @param[in] width Width of images without their own width, 0 when it is missing
+ * @param[out] corpus Loaded images
+ * @returns True when all images were loaded, false otherwise
+ * */
+bool load_corpus(const std::vector<std::string> &inputs, const uint32_t &width, std::vector<CorpusImage> &corpus) {
+  for (const std::string &input : inputs) {
+    CorpusImage image;
+    image.name = input;
+    image.width = width;
+
+    // Width given after last colon
+    const size_t colon = input.rfind(':');
+    if (colon != std::string::npos && colon + 1 < input.size() &&
+      input.find_first_not_of("0123456789", colon + 1) == std::string::npos)
+    {
+      image.name = input.substr(0, colon);
+      std::stringstream sstream(input.substr(colon + 1));
+      sstream >> image.width;
+    }
+
+    if (image.width == 0) {
+      std::cerr << "Width of " << image.name << " is missing, use -w or <filename>:<width>!" << std::endl;
+      return false;
+    }
+
+    DataWorker data_worker;
+    if (!data_worker.LoadRawImage(image.name, image.width, image.height)) {
+      return false;
+    }
+    if (image.height == 0) {
+      std::cerr << "Image " << image.name << " is smaller than one row!" << std::endl;
+      return false;
+    }
+
+    // Bytes after last whole row are ignored
+    const uint8_t *buffer = data_worker.GetBuffer();
+    image.pixels.assign(buffer, buffer + static_cast<size_t>(image.width) * image.height);
+    corpus.push_back(image);
+  }
+  return true;
+}
+
+/**
+ * Generate synthetic images, "corpus" is replaced by all images of SYNTHETIC_CORPUS
+ * @param[in] specs Properties of images, as parsed by SyntheticImage::Parse
+ * @param[out] corpus Generated images, named by their properties
+ * @returns True when all properties were valid, false otherwise
+ * */
+bool generate_corpus(const std::vector<std::string> &specs, std::vector<CorpusImage> &corpus) {
+  std::vector<std::string> expanded;
+  for (const std::string &spec : specs) {
+    if (spec == "corpus") {
+      expanded.insert(expanded.end(), SYNTHETIC_CORPUS.begin(), SYNTHETIC_CORPUS.end());
+    }
+    else {
+      expanded.push_back(spec);
+    }
+  }
+
+  for (const std::string &spec : expanded) {
+    SyntheticParams params;
+    if (!SyntheticImage::Parse(spec, params)) {
+      return false;
+    }
+
+    CorpusImage image = {spec, {}, params.width, params.height};
+    SyntheticImage synthetic_image(params);
+    synthetic_image.Generate(image.pixels);
+    corpus.push_back(image);
+  }
+  return true;
+}
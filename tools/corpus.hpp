@@ -0,0 +1,50 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: corpus.hpp
+ * Description: Contains definitions of corpus of raw images shared by tools, that measure codec on them
+ * */
+#ifndef __CORPUS__
+#define __CORPUS__
+
+#include <cstdint>  // uint8_t, uint32_t
+#include <string>   // string
+#include <sstream>  // stringstream
+#include <iostream> // cerr
+#include <vector>   // vector
+
+#include "../src/data_worker.hpp"
+#include "synthetic.hpp"
+
+/**
+ * Image of corpus
+ * @param name Name of file
+ * @param pixels Pixels of image
+ * @param width Width of image
+ * @param height Height of image
+ * */
+typedef struct CorpusImage {
+  std::string name;
+  std::vector<uint8_t> pixels;
+  uint32_t width;
+  uint32_t height;
+} CorpusImage;
+
+/**
+ * Load raw images, input can be given as <filename>:<width>
+ * @param[in] inputs Names of files, with width after last colon
+ * @param[in] width Width of images without their own width, 0 when it is missing
+ * @param[out] corpus Loaded images
+ * @returns True when all images were loaded, false otherwise
+ * */
+bool load_corpus(const std::vector<std::string> &inputs, const uint32_t &width, std::vector<CorpusImage> &corpus);
+
+/**
+ * Generate synthetic images, "corpus" is replaced by all images of SYNTHETIC_CORPUS
+ * @param[in] specs Properties of images, as parsed by SyntheticImage::Parse
+ * @param[out] corpus Generated images, named by their properties
+ * @returns True when all properties were valid, false otherwise
+ * */
+bool generate_corpus(const std::vector<std::string> &specs, std::vector<CorpusImage> &corpus);
+
+#endif
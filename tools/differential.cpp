@@ -0,0 +1,542 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: differential.cpp
+ * Description: Differential test of RLE and adaptive huffman coding, each variant of codec is run on random
+ * and synthetic images against frozen scalar reference, compressed data need to be identical and round trip exact
+ * */
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <unistd.h> // getopt
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <vector>   // vector
+#include <random>   // mt19937_64
+#include <functional> // function
+#include <algorithm> // min
+
+#include "../src/data_worker.hpp"
+#include "../src/rle/rle_compressor.hpp"
+#include "../src/rle/rle_decompressor.hpp"
+#include "../src/huffman/huffman_coder.hpp"
+#include "../src/huffman/huffman_decoder.hpp"
+#include "reference/reference_rle_compressor.hpp"
+#include "reference/reference_rle_decompressor.hpp"
+#include "reference/reference_huffman_coder.hpp"
+#include "reference/reference_huffman_decoder.hpp"
+#include "corpus.hpp"
+
+// Scanning of RLE compressor
+constexpr uint8_t DIFFERENTIAL_HORIZONTAL = 0;
+constexpr uint8_t DIFFERENTIAL_VERTICAL = 1;
+constexpr uint8_t DIFFERENTIAL_ADAPTIVE = 2;
+
+// Names of scanning, indexed by scanning
+const std::vector<std::string> DIFFERENTIAL_SCANNING_NAMES = {"horizontal", "vertical", "adaptive"};
+
+/**
+ * Settings of differential test, given by arguments
+ * @param iterations Number specified in -n param, random images checked
+ * @param seed Number specified in -s param, seed of first random image, next images have next seeds
+ * @param max_size Number specified in -d param, maximal width and height of random image
+ * @param synthetic_specs Synthetic images given by -g, checked before random images
+ * */
+typedef struct DifferentialArguments {
+  uint32_t iterations;
+  uint64_t seed;
+  uint32_t max_size;
+  std::vector<std::string> synthetic_specs;
+} DifferentialArguments;
+
+/**
+ * Variant of RLE coding checked against reference
+ * @param name Name of variant
+ * @param compress Compress image with given scanning, with or without preprocessing bit, into data
+ * @param decompress Decompress data into image and model bit, returns false when data are invalid
+ * */
+typedef struct RleVariant {
+  std::string name;
+  std::function<void(const std::vector<uint8_t> &, const uint32_t &, const uint32_t &, const uint8_t &, const bool &,
+    std::vector<uint8_t> &)> compress;
+  std::function<bool(const std::vector<uint8_t> &, std::vector<uint8_t> &, bool &)> decompress;
+} RleVariant;
+
+/**
+ * Variant of adaptive huffman coding checked against reference
+ * @param name Name of variant
+ * @param encode Encode data with tree trained by model into settings byte and encoded data
+ * @param decode Decode data with tree trained by model, returns false when data are invalid
+ * */
+typedef struct HuffmanVariant {
+  std::string name;
+  std::function<void(const std::vector<uint8_t> &, const std::vector<uint8_t> &, uint8_t &, std::vector<uint8_t> &)> encode;
+  std::function<bool(const std::vector<uint8_t> &, const uint8_t &, const std::vector<uint8_t> &, std::vector<uint8_t> &)> decode;
+} HuffmanVariant;
+
+/**
+ * Sequence scanning of RLE compressors in one direction, private scanning functions of codec are reached
+ * as friend of RleCompressor
+ * */
+struct RleScanningDifferential {
+  /**
+   * Scan image in one direction with RLE compressor of codec, with settings byte of that direction
+   * @param[in] compressor RLE compressor of image
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * @param[in] input_preprocessing True when image was preprocessed
+   * @param[in] vertical True for vertical scanning, false for horizontal one
+   * */
+  static void Scan(
+    RleCompressor &compressor,
+    const uint32_t &width,
+    const uint32_t &height,
+    const bool &input_preprocessing,
+    const bool &vertical
+  ) {
+    // Vertical scanning has scanning bit cleared
+    uint8_t settings = (input_preprocessing ? MODEL_MASK : 0) | (vertical ? 0 : SCANNING_MASK);
+    compressor.appendSettingsToBuff(settings, width, height);
+    if (vertical) {
+      compressor.VerticalScanning(width, height);
+    } else {
+      compressor.HorizontalScanning(width, height);
+    }
+  }
+
+  /**
+   * Scan image in one direction with frozen reference RLE compressor
+   * @param[in] compressor RLE compressor of image
+   * @param[in] width Width of image
+   * @param[in] height Height of image
+   * @param[in] input_preprocessing True when image was preprocessed
+   * @param[in] vertical True for vertical scanning, false for horizontal one
+   * */
+  static void Scan(
+    ReferenceRleCompressor &compressor,
+    const uint32_t &width,
+    const uint32_t &height,
+    const bool &input_preprocessing,
+    const bool &vertical
+  ) {
+    compressor.SequenceScanning(width, height, input_preprocessing, vertical);
+  }
+};
+
+/**
+ * Compress image with RLE compressor of given class
+ * @param[in] image Pixels of image
+ * @param[in] width Width of image
+ * @param[in] height Height of image
+ * @param[in] scanning DIFFERENTIAL_HORIZONTAL, DIFFERENTIAL_VERTICAL or DIFFERENTIAL_ADAPTIVE
+ * @param[in] input_preprocessing True when image was preprocessed
+ * @param[out] data RLE data
+ * */
+template <class Compressor>
+void rle_compress(
+  const std::vector<uint8_t> &image,
+  const uint32_t &width,
+  const uint32_t &height,
+  const uint8_t &scanning,
+  const bool &input_preprocessing,
+  std::vector<uint8_t> &data
+) {
+  Compressor compressor(image.data(), width, height);
+  if (scanning == DIFFERENTIAL_ADAPTIVE) {
+    compressor.AdaptiveScanning(width, height, input_preprocessing);
+  } else {
+    RleScanningDifferential::Scan(compressor, width, height, input_preprocessing, scanning == DIFFERENTIAL_VERTICAL);
+  }
+  data.assign(compressor.GetBuffer(), compressor.GetBuffer() + compressor.GetSize());
+}
+
+/**
+ * Decompress RLE data with RLE decompressor of given class
+ * @param[in] data RLE data
+ * @param[out] image Pixels of image
+ * @param[out] convert_from_model Model bit of data
+ * @returns True when data were decompressed, false otherwise
+ * */
+template <class Decompressor>
+bool rle_decompress(const std::vector<uint8_t> &data, std::vector<uint8_t> &image, bool &convert_from_model) {
+  std::vector<uint8_t> input(data);
+  uint8_t *input_data = input.data();
+  Decompressor decompressor(input_data, input.size());
+  convert_from_model = false;
+  if (!decompressor.Decompress(convert_from_model)) {
+    return false;
+  }
+  image.assign(decompressor.GetBuffer(), decompressor.GetBuffer() + decompressor.GetSize());
+  return true;
+}
+
+/**
+ * Encode data with adaptive huffman coder of given class
+ * @param[in] model Symbols training tree before coding, empty for untrained tree
+ * @param[in] data Data to be encoded
+ * @param[out] settings Settings byte
+ * @param[out] encoded Encoded data
+ * */
+template <class Coder>
+void huffman_encode(const std::vector<uint8_t> &model, const std::vector<uint8_t> &data, uint8_t &settings, std::vector<uint8_t> &encoded) {
+  std::vector<uint8_t> input(data);
+  uint8_t *input_data = input.data();
+  Coder coder;
+  coder.Train(model.data(), model.size());
+  coder.Encode(input_data, input.size(), settings);
+  encoded.assign(coder.GetBuffer(), coder.GetBuffer() + coder.GetSize());
+}
+
+/**
+ * Decode data with adaptive huffman decoder of given class
+ * @param[in] model Symbols training tree before decoding, empty for untrained tree
+ * @param[in] settings Settings byte
+ * @param[in] encoded Encoded data
+ * @param[out] data Decoded data
+ * @returns True when data were decoded, false otherwise
+ * */
+template <class Decoder>
+bool huffman_decode(const std::vector<uint8_t> &model, const uint8_t &settings, const std::vector<uint8_t> &encoded, std::vector<uint8_t> &data) {
+  std::vector<uint8_t> input(encoded);
+  uint8_t *input_data = input.data();
+  Decoder decoder;
+  decoder.Train(model.data(), model.size());
+  if (!decoder.Decode(settings, input_data, input.size())) {
+    return false;
+  }
+  data.assign(decoder.GetBuffer(), decoder.GetBuffer() + decoder.GetSize());
+  return true;
+}
+
+// Reference implementations, scalar code as it was before optimizations
+const RleVariant DIFFERENTIAL_RLE_REFERENCE = {
+  "reference", rle_compress<ReferenceRleCompressor>, rle_decompress<ReferenceRleDecompressor>
+};
+const HuffmanVariant DIFFERENTIAL_HUFFMAN_REFERENCE = {
+  "reference", huffman_encode<ReferenceHuffmanCoder>, huffman_decode<ReferenceHuffmanDecoder>
+};
+
+// Variants checked against reference, optimized or SIMD variant of codec is added here
+const std::vector<RleVariant> DIFFERENTIAL_RLE_VARIANTS = {
+  {"codec", rle_compress<RleCompressor>, rle_decompress<RleDecompressor>}
+};
+const std::vector<HuffmanVariant> DIFFERENTIAL_HUFFMAN_VARIANTS = {
+  {"codec", huffman_encode<HuffmanCoder>, huffman_decode<HuffmanDecoder>}
+};
+
+/**
+ * Print help of tool
+ * */
+void print_help() {
+  std::cout << "Usage: ./huff_differential [-n <iterations>] [-s <seed>] [-d <size>] [-g <synthetic> ...]" << std::endl
+    << "  -n <iterations>     random images checked (default 100)" << std::endl
+    << "  -s <seed>           seed of first random image, image i has seed + i, so -s <seed> -n 1 repeats one image (default 1)" << std::endl
+    << "  -d <size>           maximal width and height of random image (default 96)" << std::endl
+    << "  -g <synthetic>      synthetic image checked before random images, as by ./huff_generate, corpus for all" << std::endl
+    << "Each variant needs to give the same RLE and huffman data as reference, and decode them back exactly." << std::endl;
+}
+
+/**
+ * Function will parse arguments and assign their values to given structure
+ * @param[in] argc Number of arguments
+ * @param[in] argv Array of arguments
+ * @param[out] arguments Structure holding values of all arguments
+ * @return True when all arguments were rightly formatted, false otherwise
+ **/
+bool parse_arguments(const int &argc, char* argv[], DifferentialArguments &arguments) {
+  arguments.iterations = 100;
+  arguments.seed = 1;
+  arguments.max_size = 96;
+
+  int opt;
+  while ((opt = getopt(argc, argv, ":n:s:d:g:h")) != -1) {
+    switch (opt) {
+      case 'n':
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.iterations;
+          if (sstream.fail()) {
+            std::cerr << "Number of iterations, needs to be >= 0!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      case 's':
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.seed;
+          if (sstream.fail()) {
+            std::cerr << "Seed, needs to be >= 0!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      case 'd':
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.max_size;
+          if (sstream.fail() || arguments.max_size < 1 || arguments.max_size > SYNTHETIC_MAX_SIZE) {
+            std::cerr << "Maximal size of image, needs to be >= 1 and <= " << SYNTHETIC_MAX_SIZE << "!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      case 'g':
+        arguments.synthetic_specs.push_back(optarg);
+        break;
+      case 'h':
+        print_help();
+        return false;
+      case ':':
+        std::cerr << "Option needs a value" << std::endl;
+        return false;
+      case '?':
+        std::cerr << "Unknown param" << std::endl;
+        return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Generate random image, size, pattern and properties depend only on seed
+ * @param[in] seed Seed of image
+ * @param[in] max_size Maximal width and height
+ * @returns Generated image, named by seed and its properties
+ * */
+CorpusImage random_image(const uint64_t &seed, const uint32_t &max_size) {
+  std::mt19937_64 random(seed);
+
+  // Small sizes are more likely, so edges of rows and columns are hit often
+  const auto random_size = [&]() {
+    const uint32_t limit = (random() % 4 == 0) ? std::min<uint32_t>(max_size, 4) : max_size;
+    return static_cast<uint32_t>(random() % limit) + 1;
+  };
+
+  SyntheticParams params;
+  params.pattern = random() % 3;
+  params.width = random_size();
+  params.height = random_size();
+  params.seed = random();
+  params.run = 1 + static_cast<double>(random() % 1000);
+  params.smooth = 1 + random() % 256;
+  params.noise = (random() % 2 == 0) ? 0 : random() % 16;
+  params.levels = (random() % 2 == 0) ? 256 : 2 + random() % 32;
+  params.dither = random() % 3;
+  params.repeat = static_cast<double>(random() % 100) / 100;
+
+  CorpusImage image;
+  image.width = params.width;
+  image.height = params.height;
+  SyntheticImage(params).Generate(image.pixels);
+
+  std::stringstream name;
+  name << "seed " << seed << " (pattern " << static_cast<uint32_t>(params.pattern) << ", levels " << params.levels
+    << ", dither " << static_cast<uint32_t>(params.dither) << ", repeat " << params.repeat << ")";
+  image.name = name.str();
+  return image;
+}
+
+/**
+ * Add shortest single row images, whose huffman code ends with each number of padding bits, so decoder
+ * is checked to stop at the end of code, with one padding bit the end is at the start of next byte
+ * @param[out] corpus Images, where images are added
+ * */
+void padding_images(std::vector<CorpusImage> &corpus) {
+  // Few values repeating irregularly, so huffman code is shorter than data already after few symbols
+  std::vector<uint8_t> sequence(400);
+  for (size_t i = 0; i < sequence.size(); i++) {
+    sequence[i] = (i * i + 3 * i) % 5;
+  }
+
+  std::vector<bool> found(BITS_IN_BYTE, false);
+  for (size_t size = 1; size <= sequence.size(); size++) {
+    const std::vector<uint8_t> pixels(sequence.begin(), sequence.begin() + size);
+    uint8_t settings = 0;
+    std::vector<uint8_t> encoded;
+    DIFFERENTIAL_HUFFMAN_REFERENCE.encode(std::vector<uint8_t>(), pixels, settings, encoded);
+
+    const uint8_t padding_bits = (settings & PADDING_BITS_MASK);
+    if (!(settings & SETTINGS_BIT_CHECK) || found[padding_bits]) {
+      continue;
+    }
+    found[padding_bits] = true;
+    corpus.push_back({std::to_string(size) + "x1 huffman padding " + std::to_string(padding_bits), pixels,
+      static_cast<uint32_t>(size), 1});
+  }
+}
+
+/**
+ * Add images of edge cases, single pixel, single row and column, constant image with runs longer than counter,
+ * alternating values without runs and huffman code ending with each number of padding bits
+ * @param[out] corpus Images, where edge cases are added
+ * */
+void edge_images(std::vector<CorpusImage> &corpus) {
+  corpus.push_back({"1x1", {7}, 1, 1});
+  corpus.push_back({"1x1 zero", {0}, 1, 1});
+  corpus.push_back({"300x1 constant", std::vector<uint8_t>(300, 255), 300, 1});
+  corpus.push_back({"1x300 constant", std::vector<uint8_t>(300, 1), 1, 300});
+  corpus.push_back({"257x131 constant", std::vector<uint8_t>(257 * 131, 128), 257, 131});
+
+  CorpusImage alternating = {"64x64 alternating", std::vector<uint8_t>(64 * 64), 64, 64};
+  for (size_t i = 0; i < alternating.pixels.size(); i++) {
+    alternating.pixels[i] = (i % 2 == 0) ? 0 : 255;
+  }
+  corpus.push_back(alternating);
+
+  CorpusImage values = {"256x3 all values", std::vector<uint8_t>(256 * 3), 256, 3};
+  for (size_t i = 0; i < values.pixels.size(); i++) {
+    values.pixels[i] = i % 256;
+  }
+  corpus.push_back(values);
+
+  padding_images(corpus);
+}
+
+/**
+ * Print failure of check
+ * @param[in] image Checked image
+ * @param[in] variant Name of variant
+ * @param[in] check Description of failed check
+ * */
+void report(const CorpusImage &image, const std::string &variant, const std::string &check) {
+  std::cerr << "FAIL " << image.name << " " << image.width << "x" << image.height << ", variant " << variant << ": " << check << std::endl;
+}
+
+/**
+ * Check variants of adaptive huffman coding on given data, with and without model
+ * @param[in] image Image, that data were made from
+ * @param[in] data Data to be encoded
+ * @param[in] model Symbols training tree
+ * @param[in] what Description of data
+ * @returns Number of failed checks
+ * */
+uint32_t check_huffman(const CorpusImage &image, const std::vector<uint8_t> &data, const std::vector<uint8_t> &model, const std::string &what) {
+  uint32_t failures = 0;
+
+  for (const bool trained : {false, true}) {
+    const std::vector<uint8_t> &used_model = trained ? model : std::vector<uint8_t>();
+    const std::string description = what + (trained ? " with model" : "");
+
+    uint8_t reference_settings = 0;
+    std::vector<uint8_t> reference_encoded;
+    DIFFERENTIAL_HUFFMAN_REFERENCE.encode(used_model, data, reference_settings, reference_encoded);
+
+    for (const HuffmanVariant &variant : DIFFERENTIAL_HUFFMAN_VARIANTS) {
+      uint8_t settings = 0;
+      std::vector<uint8_t> encoded;
+      variant.encode(used_model, data, settings, encoded);
+      if (settings != reference_settings || encoded != reference_encoded) {
+        report(image, variant.name, "huffman code of " + description + " differs from reference");
+        failures++;
+      }
+
+      // Variant needs to decode its own data and data of reference
+      std::vector<uint8_t> decoded;
+      if (!variant.decode(used_model, settings, encoded, decoded) || decoded != data) {
+        report(image, variant.name, "huffman round trip of " + description + " is not exact");
+        failures++;
+      }
+      if (!variant.decode(used_model, reference_settings, reference_encoded, decoded) || decoded != data) {
+        report(image, variant.name, "huffman code of reference of " + description + " is not decoded exactly");
+        failures++;
+      }
+    }
+  }
+  return failures;
+}
+
+/**
+ * Check all variants on image, RLE with every scanning with and without preprocessing, huffman of RLE data
+ * and of raw pixels
+ * @param[in] image Checked image
+ * @returns Number of failed checks
+ * */
+uint32_t check_image(const CorpusImage &image) {
+  uint32_t failures = 0;
+
+  // Model is made from image itself, so failure is repeated by the same image alone
+  const std::vector<uint8_t> model(image.pixels.rbegin(), image.pixels.rbegin() + std::min<size_t>(image.pixels.size(), 4096));
+
+  std::vector<uint8_t> preprocessed(image.pixels);
+  uint8_t *preprocessed_data = preprocessed.data();
+  DataWorker::Preprocess(preprocessed_data, preprocessed.size(), 0);
+
+  std::vector<uint8_t> huffman_input;
+  for (uint8_t scanning = DIFFERENTIAL_HORIZONTAL; scanning <= DIFFERENTIAL_ADAPTIVE; scanning++) {
+    for (const bool input_preprocessing : {false, true}) {
+      const std::vector<uint8_t> &pixels = input_preprocessing ? preprocessed : image.pixels;
+      const std::string description = DIFFERENTIAL_SCANNING_NAMES[scanning] + (input_preprocessing ? " with model" : "");
+
+      std::vector<uint8_t> reference_data;
+      DIFFERENTIAL_RLE_REFERENCE.compress(pixels, image.width, image.height, scanning, input_preprocessing, reference_data);
+
+      // RLE data of adaptive scanning of preprocessed image are the same as in pipeline -m -a
+      if (scanning == DIFFERENTIAL_ADAPTIVE && input_preprocessing) {
+        huffman_input = reference_data;
+      }
+
+      for (const RleVariant &variant : DIFFERENTIAL_RLE_VARIANTS) {
+        std::vector<uint8_t> data;
+        variant.compress(pixels, image.width, image.height, scanning, input_preprocessing, data);
+        if (data != reference_data) {
+          report(image, variant.name, "RLE data of " + description + " differ from reference");
+          failures++;
+        }
+
+        // Variant needs to decompress its own data and data of reference
+        std::vector<uint8_t> decompressed;
+        bool convert_from_model = false;
+        if (!variant.decompress(data, decompressed, convert_from_model) || decompressed != pixels ||
+          convert_from_model != input_preprocessing)
+        {
+          report(image, variant.name, "RLE round trip of " + description + " is not exact");
+          failures++;
+        }
+        if (!variant.decompress(reference_data, decompressed, convert_from_model) || decompressed != pixels ||
+          convert_from_model != input_preprocessing)
+        {
+          report(image, variant.name, "RLE data of reference of " + description + " are not decompressed exactly");
+          failures++;
+        }
+      }
+    }
+  }
+
+  failures += check_huffman(image, huffman_input, model, "RLE data");
+  failures += check_huffman(image, image.pixels, model, "pixels");
+  return failures;
+}
+
+int main(int argc, char* argv[]) {
+  DifferentialArguments arguments;
+  if (!parse_arguments(argc, argv, arguments)) {
+    return 1;
+  }
+
+  // Edge cases and synthetic images are checked before random images
+  std::vector<CorpusImage> corpus;
+  edge_images(corpus);
+  if (!generate_corpus(arguments.synthetic_specs, corpus)) {
+    return 1;
+  }
+
+  uint32_t failures = 0;
+  uint32_t failed_images = 0;
+  const auto check = [&](const CorpusImage &image) {
+    const uint32_t image_failures = check_image(image);
+    failures += image_failures;
+    failed_images += (image_failures > 0);
+  };
+
+  for (const CorpusImage &image : corpus) {
+    check(image);
+  }
+  for (uint32_t i = 0; i < arguments.iterations; i++) {
+    check(random_image(arguments.seed + i, arguments.max_size));
+  }
+
+  const size_t images = corpus.size() + arguments.iterations;
+  std::cout << "Checked " << DIFFERENTIAL_RLE_VARIANTS.size() << " RLE and " << DIFFERENTIAL_HUFFMAN_VARIANTS.size()
+    << " huffman variants on " << images << " images, " << failed_images << " images failed with " << failures << " failed checks" << std::endl;
+  return (failures > 0) ? 1 : 0;
+}
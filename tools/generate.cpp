@@ -0,0 +1,122 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: generate.cpp
+ * Description: Tool that writes deterministic synthetic raw images, image is generated row after row,
+ * so even 32768x32768 image is not kept in memory
+ * */
+#include <string>
+#include <iostream>
+#include <cstdio>   // fopen, fwrite
+#include <unistd.h> // getopt
+#include <cstdint>  // uint8_t, uint32_t
+#include <vector>   // vector
+#include <filesystem> // create_directories
+
+#include "synthetic.hpp"
+
+/**
+ * Print help of tool
+ * */
+void print_help() {
+  std::cout << "Usage: ./huff_generate -g <pattern>:<width>x<height>[,key=value...] -o <file>" << std::endl
+    << "       ./huff_generate -g corpus -o <directory>" << std::endl
+    << "  patterns:        runs, gradient, noise" << std::endl
+    << "  seed=<N>         seed of random generator (default 1)" << std::endl
+    << "  run=<N>          mean length of runs of runs pattern (default 16)" << std::endl
+    << "  smooth=<N>       distance of interpolated points of gradient pattern (default 64)" << std::endl
+    << "  noise=<N>        maximal difference of noise added to each pixel (default 0)" << std::endl
+    << "  levels=<N>       number of gray levels from 2 to 256 (default 256)" << std::endl
+    << "  dither=<D>       none, bayer or random dithering of reduced gray levels (default none)" << std::endl
+    << "  repeat=<P>       probability, that row is copy of previous row (default 0)" << std::endl;
+}
+
+/**
+ * Write synthetic image to file row after row
+ * @param[in] spec Properties of image
+ * @param[in] filename Name of output file
+ * @returns True when image was written, false otherwise
+ * */
+bool write_image(const std::string &spec, const std::string &filename) {
+  SyntheticParams params;
+  if (!SyntheticImage::Parse(spec, params)) {
+    return false;
+  }
+
+  FILE *file = std::fopen(filename.c_str(), "wb");
+  if (file == nullptr) {
+    std::cerr << "File could not be opened!" << std::endl;
+    return false;
+  }
+
+  SyntheticImage synthetic_image(params);
+  std::vector<uint8_t> row(params.width);
+  for (uint32_t y = 0; y < params.height; y++) {
+    synthetic_image.NextRow(row.data());
+    if (std::fwrite(row.data(), 1, row.size(), file) != row.size()) {
+      std::cerr << "Failed to write RAW image data into given file." << std::endl;
+      std::fclose(file);
+      return false;
+    }
+  }
+  std::fclose(file);
+
+  std::cout << filename << ": " << params.width << "x" << params.height << std::endl;
+  return true;
+}
+
+/**
+ * Main function of tool
+ * @param[in] argc Number of arguments
+ * @param[in] argv Array of arguments
+ * @returns 0 when images were written, 1 otherwise
+ * */
+int main(int argc, char* argv[]) {
+  std::string spec = "";
+  std::string output = "";
+
+  int opt;
+  while ((opt = getopt(argc, argv, ":g:o:h")) != -1) {
+    switch (opt) {
+      case 'g':
+        spec = optarg;
+        break;
+      case 'o':
+        output = optarg;
+        break;
+      case 'h':
+        print_help();
+        return 0;
+      case ':':
+        std::cerr << "Option needs a value" << std::endl;
+        return 1;
+      case '?':
+        std::cerr << "Unknown param" << std::endl;
+        return 1;
+    }
+  }
+
+  if (spec == "" || output == "") {
+    std::cerr << "Params -g and -o are mandatory, for help type -h!" << std::endl;
+    return 1;
+  }
+
+  if (spec != "corpus") {
+    return write_image(spec, output) ? 0 : 1;
+  }
+
+  // Each image of corpus is named by its properties
+  std::filesystem::create_directories(output);
+  for (const std::string &corpus_spec : SYNTHETIC_CORPUS) {
+    std::string name = corpus_spec;
+    for (char &character : name) {
+      if (character == ':' || character == ',' || character == '=') {
+        character = '_';
+      }
+    }
+    if (!write_image(corpus_spec, (std::filesystem::path(output) / (name + ".raw")).string())) {
+      return 1;
+    }
+  }
+  return 0;
+}
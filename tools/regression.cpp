@@ -0,0 +1,210 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: regression.cpp
+ * Description: Contains implementations of functions comparing results of benchmark with baseline JSON
+ * saved by earlier run of benchmark, regressions of ratio and throughput are flagged
+ * */
+#include "regression.hpp"
+
+/**
+ * Find start of value of key in line of JSON
+ * @param[in] line Line of JSON
+ * @param[in] key Key without quotes
+ * @param[out] position Position of first character of value
+ * @returns True when key was found, false otherwise
+ * */
+bool find_value(const std::string &line, const std::string &key, size_t &position) {
+  const std::string pattern = "\"" + key + "\": ";
+  position = line.find(pattern);
+  if (position == std::string::npos) {
+    return false;
+  }
+  position += pattern.size();
+  return true;
+}
+
+/**
+ * Read string value of key, quotes and backslashes are unescaped
+ * @param[in] line Line of JSON
+ * @param[in] key Key without quotes
+ * @param[out] value Value of key
+ * @returns True when key with string value was found, false otherwise
+ * */
+bool read_string(const std::string &line, const std::string &key, std::string &value) {
+  size_t position;
+  if (!find_value(line, key, position) || position >= line.size() || line[position] != '"') {
+    return false;
+  }
+
+  value = "";
+  for (size_t i = position + 1; i < line.size(); i++) {
+    if (line[i] == '"') {
+      return true;
+    }
+    if (line[i] == '\\' && i + 1 < line.size()) {
+      i++;
+    }
+    value += line[i];
+  }
+  return false;
+}
+
+/**
+ * Read number value of key
+ * @param[in] line Line of JSON
+ * @param[in] key Key without quotes
+ * @param[out] value Value of key
+ * @returns True when key with number value was found, false otherwise
+ * */
+bool read_number(const std::string &line, const std::string &key, double &value) {
+  size_t position;
+  if (!find_value(line, key, position)) {
+    return false;
+  }
+
+  const char *start = line.c_str() + position;
+  char *end = nullptr;
+  value = std::strtod(start, &end);
+  return end != start;
+}
+
+/**
+ * Load results of baseline saved by -j of benchmark, every result is on its own line
+ * @param[in] filename Name of baseline JSON
+ * @param[out] baseline Results of baseline
+ * @returns True when file was read and contained at least one result, false otherwise
+ * */
+bool load_baseline(const std::string &filename, std::vector<CaseResult> &baseline) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    std::cerr << "Failed to open baseline " << filename << "!" << std::endl;
+    return false;
+  }
+
+  std::string line;
+  while (std::getline(file, line)) {
+    CaseResult result;
+    if (!read_string(line, "name", result.name)) {
+      continue;
+    }
+    if (!read_string(line, "image", result.image) || !read_number(line, "median_ms", result.median_ms) ||
+      !read_number(line, "min_ms", result.min_ms) || !read_number(line, "mb_per_s", result.mb_per_s) ||
+      !read_number(line, "ratio", result.ratio))
+    {
+      std::cerr << "Invalid result " << result.name << " in baseline " << filename << "!" << std::endl;
+      return false;
+    }
+    baseline.push_back(result);
+  }
+
+  if (baseline.empty()) {
+    std::cerr << "Baseline " << filename << " does not contain any result!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Print table of differences of results against baseline, ratio is flagged when it decreased by more than
+ * REGRESSION_RATIO_THRESHOLD percent, throughput when both median and minimal time increased by more than noise,
+ * only for cases with median time of baseline at least REGRESSION_MIN_TIME_MS, cases of baseline that were not run are flagged too
+ * @param[in] baseline Results of baseline
+ * @param[in] results Results of this run
+ * @param[in] noise Allowed decrease of throughput in percent, REGRESSION_NO_SPEED to compare only ratio
+ * @returns Number of flagged cases
+ * */
+uint32_t compare_baseline(const std::vector<CaseResult> &baseline, const std::vector<CaseResult> &results, const double &noise) {
+  uint32_t regressions = 0;
+  uint32_t new_cases = 0;
+  uint32_t matched = 0;
+  std::string image = "";
+
+  std::cout.unsetf(std::ios_base::floatfield);
+  std::cout << "Comparison with baseline, ratio threshold " << REGRESSION_RATIO_THRESHOLD << " %";
+  if (noise >= 0) {
+    std::cout << ", throughput noise " << noise << " % of cases slower than " << REGRESSION_MIN_TIME_MS << " ms";
+  } else {
+    std::cout << ", throughput is not compared";
+  }
+  std::cout << std::endl;
+  for (const CaseResult &result : results) {
+    // Results are grouped by image, as they are printed by benchmark
+    if (result.image != image) {
+      image = result.image;
+      std::cout << image << std::endl;
+      std::cout << std::left << std::setw(38) << "case" << std::right << std::setw(10) << "base ratio" << std::setw(9) << "ratio"
+        << std::setw(9) << "diff %" << std::setw(11) << "base MB/s" << std::setw(10) << "MB/s" << std::setw(9) << "diff %"
+        << "  status" << std::endl;
+    }
+
+    // Case of the same name on the same image
+    const CaseResult *base = nullptr;
+    for (const CaseResult &candidate : baseline) {
+      if (candidate.name == result.name && candidate.image == result.image) {
+        base = &candidate;
+        break;
+      }
+    }
+    std::cout << std::left << std::setw(38) << result.name << std::right << std::fixed;
+    if (base == nullptr) {
+      std::cout << std::setw(10) << "-" << std::setprecision(4) << std::setw(9) << result.ratio << std::setw(9) << "-"
+        << std::setw(11) << "-" << std::setprecision(2) << std::setw(10) << result.mb_per_s << std::setw(9) << "-" << "  new" << std::endl;
+      new_cases++;
+      continue;
+    }
+    matched++;
+
+    // Ratio is deterministic, so even small decrease is regression
+    const bool ratio_regressed = base->ratio > 0 && result.ratio < base->ratio * (1 - REGRESSION_RATIO_THRESHOLD / 100);
+
+    // One slow repetition does not move minimal time, so both times need to be slower
+    const bool speed_regressed = noise >= 0 && base->median_ms >= REGRESSION_MIN_TIME_MS &&
+      result.median_ms > base->median_ms * (1 + noise / 100) && result.min_ms > base->min_ms * (1 + noise / 100);
+
+    std::cout << std::setprecision(4) << std::setw(10) << base->ratio << std::setw(9) << result.ratio;
+    if (base->ratio > 0) {
+      std::cout << std::setprecision(3) << std::setw(9) << (result.ratio / base->ratio - 1) * 100;
+    } else {
+      std::cout << std::setw(9) << "";
+    }
+    std::cout << std::setprecision(2) << std::setw(11) << base->mb_per_s << std::setw(10) << result.mb_per_s
+      << std::setw(9) << (result.mb_per_s / std::max(base->mb_per_s, 1e-12) - 1) * 100;
+
+    if (ratio_regressed || speed_regressed) {
+      std::cout << "  " << (ratio_regressed ? "RATIO" : "") << ((ratio_regressed && speed_regressed) ? " " : "")
+        << (speed_regressed ? "SPEED" : "");
+      regressions++;
+    } else {
+      std::cout << "  ok";
+    }
+    std::cout << std::endl;
+  }
+  std::cout.unsetf(std::ios_base::floatfield);
+
+  // Case missing in this run would hide its regression, so it fails as well
+  uint32_t not_run = 0;
+  for (const CaseResult &base : baseline) {
+    bool found = false;
+    for (const CaseResult &result : results) {
+      if (result.name == base.name && result.image == base.image) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      std::cout << "NOT RUN " << base.name << " on " << base.image << std::endl;
+      not_run++;
+    }
+  }
+
+  std::cout << regressions << " of " << matched << " cases regressed";
+  if (new_cases > 0) {
+    std::cout << ", " << new_cases << " cases are not in baseline";
+  }
+  if (not_run > 0) {
+    std::cout << ", " << not_run << " cases of baseline were not run";
+  }
+  std::cout << std::endl;
+  return regressions + not_run;
+}
@@ -0,0 +1,66 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: regression.hpp
+ * Description: Contains definitions of functions comparing results of benchmark with baseline JSON
+ * saved by earlier run of benchmark, regressions of ratio and throughput are flagged
+ * */
+#ifndef __REGRESSION__
+#define __REGRESSION__
+
+#include <cstdint>  // uint32_t
+#include <string>   // string
+#include <vector>   // vector
+#include <cstdlib>  // strtod
+#include <fstream>  // ifstream
+#include <iostream> // cout, cerr
+#include <iomanip>  // setw, setprecision
+#include <algorithm> // max
+
+// Highest allowed relative decrease of compression ratio, in percent
+constexpr double REGRESSION_RATIO_THRESHOLD = 0.1;
+
+// Throughput is compared only when -N is given, baseline is usually saved on another machine
+constexpr double REGRESSION_NO_SPEED = -1.0;
+
+// Shortest median time of baseline case in ms, whose throughput is compared, shorter cases are dominated by noise
+constexpr double REGRESSION_MIN_TIME_MS = 10.0;
+
+/**
+ * Result of one case, as saved in JSON of benchmark
+ * @param name Name of case
+ * @param image Name of image
+ * @param median_ms Median time of case in ms
+ * @param min_ms Minimal time of case in ms
+ * @param mb_per_s Throughput of median time in MB/s
+ * @param ratio Compression ratio, 0 for cases without compressed result
+ * */
+typedef struct CaseResult {
+  std::string name;
+  std::string image;
+  double median_ms;
+  double min_ms;
+  double mb_per_s;
+  double ratio;
+} CaseResult;
+
+/**
+ * Load results of baseline saved by -j of benchmark, every result is on its own line
+ * @param[in] filename Name of baseline JSON
+ * @param[out] baseline Results of baseline
+ * @returns True when file was read and contained at least one result, false otherwise
+ * */
+bool load_baseline(const std::string &filename, std::vector<CaseResult> &baseline);
+
+/**
+ * Print table of differences of results against baseline, ratio is flagged when it decreased by more than
+ * REGRESSION_RATIO_THRESHOLD percent, throughput when both median and minimal time increased by more than noise,
+ * only for cases with median time of baseline at least REGRESSION_MIN_TIME_MS, cases of baseline that were not run are flagged too
+ * @param[in] baseline Results of baseline
+ * @param[in] results Results of this run
+ * @param[in] noise Allowed decrease of throughput in percent, REGRESSION_NO_SPEED to compare only ratio
+ * @returns Number of flagged cases
+ * */
+uint32_t compare_baseline(const std::vector<CaseResult> &baseline, const std::vector<CaseResult> &results, const double &noise);
+
+#endif
@@ -0,0 +1,230 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: synthetic.cpp
+ * Description: Contains implementations of SyntheticImage class, that generates deterministic images with
+ * controlled properties row after row, so benchmarks do not need large binary fixtures
+ * */
+#include "synthetic.hpp"
+
+// Ordered dithering thresholds of 4x4 Bayer matrix
+constexpr uint8_t BAYER_MATRIX[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
+/**
+ * Constructor that will initialize random generator
+ * @param[in] params Properties of image
+ * */
+SyntheticImage::SyntheticImage(const SyntheticParams &params) {
+  this->params = params;
+  this->state = params.seed;
+  this->row_index = 0;
+  this->run_value = 0;
+}
+
+/**
+ * Return next random number, generated by splitmix64, so result does not depend on standard library
+ * @returns Random number
+ * */
+uint64_t SyntheticImage::NextRandom() {
+  this->state += 0x9E3779B97F4A7C15;
+  uint64_t z = this->state;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+  return z ^ (z >> 31);
+}
+
+/**
+ * Return true with given probability
+ * @param[in] probability Probability from 0 to 1
+ * @returns True with given probability
+ * */
+bool SyntheticImage::NextChance(const double &probability) {
+  // Random number is always taken, so the rest of image does not depend on probability being 0 or 1
+  const uint64_t random = this->NextRandom();
+  if (probability >= 1) {
+    return true;
+  }
+  if (probability <= 0) {
+    return false;
+  }
+  return random < static_cast<uint64_t>(probability * 18446744073709551616.0);
+}
+
+/**
+ * Return random value of lattice point of gradient, computed from its position, so any row can be generated
+ * @param[in] x Column of lattice point
+ * @param[in] y Row of lattice point
+ * @returns Value from 0 to 255
+ * */
+uint32_t SyntheticImage::LatticeValue(const uint32_t &x, const uint32_t &y) {
+  uint64_t z = this->params.seed ^ (static_cast<uint64_t>(x) * 0x9E3779B97F4A7C15) ^ (static_cast<uint64_t>(y) * 0xC2B2AE3D27D4EB4F);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+  return (z ^ (z >> 31)) & 0xFF;
+}
+
+/**
+ * Return value of base pattern at pixel
+ * @param[in] x Column of pixel
+ * @param[in] y Row of pixel
+ * @returns Value from 0 to 255
+ * */
+uint32_t SyntheticImage::BaseValue(const uint32_t &x, const uint32_t &y) {
+  switch (this->params.pattern) {
+    case SYNTHETIC_RUNS:
+      // Run ends at each pixel with the same probability, so lengths have geometric distribution
+      if ((x == 0 && y == 0) || this->NextChance(1.0 / this->params.run)) {
+        this->run_value = this->NextRandom() & 0xFF;
+      }
+      return this->run_value;
+    case SYNTHETIC_GRADIENT:
+      {
+        // Bilinear interpolation of four surrounding lattice points
+        const uint64_t s = this->params.smooth;
+        const uint64_t fx = x % s;
+        const uint64_t fy = y % s;
+        const uint32_t gx = x / s;
+        const uint32_t gy = y / s;
+        const uint64_t sum = this->LatticeValue(gx, gy) * (s - fx) * (s - fy) + this->LatticeValue(gx + 1, gy) * fx * (s - fy) +
+          this->LatticeValue(gx, gy + 1) * (s - fx) * fy + this->LatticeValue(gx + 1, gy + 1) * fx * fy;
+        return sum / (s * s);
+      }
+  }
+  return this->NextRandom() & 0xFF;
+}
+
+/**
+ * Reduce number of gray levels of value with dithering
+ * @param[in] value Value from 0 to 255
+ * @param[in] x Column of pixel
+ * @param[in] y Row of pixel
+ * @returns Reduced value
+ * */
+uint8_t SyntheticImage::Quantize(const uint32_t &value, const uint32_t &x, const uint32_t &y) {
+  // Threshold in sixteenths of level, without dithering value is rounded
+  uint32_t threshold = 8;
+  if (this->params.dither == SYNTHETIC_DITHER_BAYER) {
+    threshold = BAYER_MATRIX[y % 4][x % 4];
+  }
+  else if (this->params.dither == SYNTHETIC_DITHER_RANDOM) {
+    threshold = this->NextRandom() & 0x0F;
+  }
+
+  // Level is computed in 32ths, so threshold is in the middle of its sixteenth
+  const uint32_t steps = this->params.levels - 1;
+  const uint32_t level = std::min((value * steps * 32 + (2 * threshold + 1) * 255) / (255 * 32), steps);
+  return (level * 255 + steps / 2) / steps;
+}
+
+/**
+ * Parse properties from <pattern>:<width>x<height>[,key=value...], keys are seed, run, smooth, noise,
+ * levels, dither (none, bayer or random) and repeat
+ * @param[in] spec Text with properties
+ * @param[out] params Parsed properties
+ * @returns True when text is valid, false otherwise
+ * */
+bool SyntheticImage::Parse(const std::string &spec, SyntheticParams &params) {
+  params = {SYNTHETIC_NOISE, 0, 0, 1, 16, 64, 0, 256, SYNTHETIC_DITHER_NONE, 0};
+
+  const size_t colon = spec.find(':');
+  const std::string pattern = spec.substr(0, colon);
+  if (pattern == "runs") {
+    params.pattern = SYNTHETIC_RUNS;
+  }
+  else if (pattern == "gradient") {
+    params.pattern = SYNTHETIC_GRADIENT;
+  }
+  else if (pattern != "noise" || colon == std::string::npos) {
+    std::cerr << "Unknown pattern of synthetic image " << spec << ", use runs, gradient or noise!" << std::endl;
+    return false;
+  }
+
+  // Size is followed by comma separated properties
+  std::stringstream sstream(spec.substr(colon + 1));
+  std::string item;
+  std::getline(sstream, item, ',');
+  std::stringstream size_stream(item);
+  char separator = 0;
+  size_stream >> params.width >> separator >> params.height;
+  if (size_stream.fail() || separator != 'x' || params.width < 1 || params.height < 1 ||
+    params.width > SYNTHETIC_MAX_SIZE || params.height > SYNTHETIC_MAX_SIZE)
+  {
+    std::cerr << "Size of synthetic image " << spec << ", needs to be <width>x<height> from 1 to " << SYNTHETIC_MAX_SIZE << "!" << std::endl;
+    return false;
+  }
+
+  while (std::getline(sstream, item, ',')) {
+    const size_t equals = item.find('=');
+    const std::string key = item.substr(0, equals);
+    std::stringstream value((equals == std::string::npos) ? "" : item.substr(equals + 1));
+
+    bool valid = true;
+    if (key == "seed") {
+      valid = static_cast<bool>(value >> params.seed);
+    }
+    else if (key == "run") {
+      valid = (value >> params.run) && params.run >= 1;
+    }
+    else if (key == "smooth") {
+      valid = (value >> params.smooth) && params.smooth >= 1 && params.smooth <= SYNTHETIC_MAX_SIZE;
+    }
+    else if (key == "noise") {
+      valid = (value >> params.noise) && params.noise <= 255;
+    }
+    else if (key == "levels") {
+      valid = (value >> params.levels) && params.levels >= 2 && params.levels <= 256;
+    }
+    else if (key == "repeat") {
+      valid = (value >> params.repeat) && params.repeat >= 0 && params.repeat <= 1;
+    }
+    else if (key == "dither") {
+      const std::string dither = value.str();
+      params.dither = (dither == "bayer") ? SYNTHETIC_DITHER_BAYER : (dither == "random") ? SYNTHETIC_DITHER_RANDOM : SYNTHETIC_DITHER_NONE;
+      valid = (dither == "bayer" || dither == "random" || dither == "none");
+    }
+    else {
+      valid = false;
+    }
+
+    if (!valid) {
+      std::cerr << "Invalid property " << item << " of synthetic image " << spec << "!" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Generate next row of image
+ * @param[out] row Pixels of row, width of image is allocated
+ * */
+void SyntheticImage::NextRow(uint8_t *row) {
+  const uint32_t y = this->row_index++;
+
+  // Repeated row is copy of previous one
+  if (this->NextChance(this->params.repeat) && y > 0) {
+    std::copy(this->previous_row.begin(), this->previous_row.end(), row);
+    return;
+  }
+
+  for (uint32_t x = 0; x < this->params.width; x++) {
+    int32_t value = this->BaseValue(x, y);
+    if (this->params.noise > 0) {
+      value += static_cast<int32_t>(this->NextRandom() % (2 * this->params.noise + 1)) - static_cast<int32_t>(this->params.noise);
+      value = std::min(std::max(value, 0), 0xFF);
+    }
+    row[x] = (this->params.levels < 256 || this->params.dither != SYNTHETIC_DITHER_NONE) ? this->Quantize(value, x, y) : value;
+  }
+  this->previous_row.assign(row, row + this->params.width);
+}
+
+/**
+ * Generate whole image
+ * @param[out] pixels Pixels of image, row after row
+ * */
+void SyntheticImage::Generate(std::vector<uint8_t> &pixels) {
+  pixels.resize(static_cast<size_t>(this->params.width) * this->params.height);
+  for (uint32_t y = 0; y < this->params.height; y++) {
+    this->NextRow(&pixels[static_cast<size_t>(y) * this->params.width]);
+  }
+}
@@ -0,0 +1,155 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: synthetic.hpp
+ * Description: Contains definitions of SyntheticImage class, that generates deterministic images with
+ * controlled properties row after row, so benchmarks do not need large binary fixtures
+ * */
+#ifndef __SYNTHETIC__
+#define __SYNTHETIC__
+
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <string>   // string
+#include <sstream>  // stringstream
+#include <iostream> // cerr
+#include <vector>   // vector
+#include <algorithm> // min, max
+
+// Maximal width and height of generated image
+constexpr uint32_t SYNTHETIC_MAX_SIZE = 32768;
+
+// Base patterns of image
+constexpr uint8_t SYNTHETIC_RUNS = 0;      // runs of random values with geometric distribution of lengths
+constexpr uint8_t SYNTHETIC_GRADIENT = 1;  // random values on lattice, interpolated between lattice points
+constexpr uint8_t SYNTHETIC_NOISE = 2;     // independent random values
+
+// Dithering used when gray levels are reduced
+constexpr uint8_t SYNTHETIC_DITHER_NONE = 0;
+constexpr uint8_t SYNTHETIC_DITHER_BAYER = 1;   // ordered 4x4 Bayer matrix
+constexpr uint8_t SYNTHETIC_DITHER_RANDOM = 2;  // random threshold
+
+// Images covering extremes of content, 256x256 each, generated by -g corpus
+const std::vector<std::string> SYNTHETIC_CORPUS = {
+  "runs:256x256,run=100000",
+  "runs:256x256,run=64,levels=4",
+  "runs:256x256,run=4",
+  "gradient:256x256,smooth=512",
+  "gradient:256x256,smooth=64,noise=4",
+  "gradient:256x256,smooth=128,levels=2,dither=bayer",
+  "gradient:256x256,smooth=128,levels=8,dither=random",
+  "noise:256x256,levels=16,repeat=0.9",
+  "noise:256x256"
+};
+
+/**
+ * Properties of generated image
+ * @param pattern Base pattern of image
+ * @param width Width of image
+ * @param height Height of image
+ * @param seed Seed of random generator, the same seed gives the same image
+ * @param run Mean length of run of SYNTHETIC_RUNS pattern
+ * @param smooth Distance of lattice points of SYNTHETIC_GRADIENT pattern in pixels, higher is smoother
+ * @param noise Maximal difference of random noise added to each pixel
+ * @param levels Number of gray levels from 2 to 256
+ * @param dither Dithering used when gray levels are reduced
+ * @param repeat Probability, that row is copy of previous row
+ * */
+typedef struct SyntheticParams {
+  uint8_t pattern;
+  uint32_t width;
+  uint32_t height;
+  uint64_t seed;
+  double run;
+  uint32_t smooth;
+  uint32_t noise;
+  uint32_t levels;
+  uint8_t dither;
+  double repeat;
+} SyntheticParams;
+
+/**
+ * Class generating image row after row, so even the biggest images do not have to be kept in memory,
+ * only integer arithmetic and own random generator are used, so the same params give the same image everywhere
+ * */
+class SyntheticImage {
+private:
+  SyntheticParams params;
+
+  // State of random generator
+  uint64_t state;
+
+  // Index of next row and previous row, that can be repeated
+  uint32_t row_index;
+  std::vector<uint8_t> previous_row;
+
+  // Value of current run, runs continue over rows
+  uint8_t run_value;
+
+  /**
+   * Return next random number, generated by splitmix64, so result does not depend on standard library
+   * @returns Random number
+   * */
+  uint64_t NextRandom();
+
+  /**
+   * Return true with given probability
+   * @param[in] probability Probability from 0 to 1
+   * @returns True with given probability
+   * */
+  bool NextChance(const double &probability);
+
+  /**
+   * Return random value of lattice point of gradient, computed from its position, so any row can be generated
+   * @param[in] x Column of lattice point
+   * @param[in] y Row of lattice point
+   * @returns Value from 0 to 255
+   * */
+  uint32_t LatticeValue(const uint32_t &x, const uint32_t &y);
+
+  /**
+   * Return value of base pattern at pixel
+   * @param[in] x Column of pixel
+   * @param[in] y Row of pixel
+   * @returns Value from 0 to 255
+   * */
+  uint32_t BaseValue(const uint32_t &x, const uint32_t &y);
+
+  /**
+   * Reduce number of gray levels of value with dithering
+   * @param[in] value Value from 0 to 255
+   * @param[in] x Column of pixel
+   * @param[in] y Row of pixel
+   * @returns Reduced value
+   * */
+  uint8_t Quantize(const uint32_t &value, const uint32_t &x, const uint32_t &y);
+
+public:
+  /**
+   * Constructor that will initialize random generator
+   * @param[in] params Properties of image
+   * */
+  SyntheticImage(const SyntheticParams &params);
+
+  /**
+   * Parse properties from <pattern>:<width>x<height>[,key=value...], keys are seed, run, smooth, noise,
+   * levels, dither (none, bayer or random) and repeat
+   * @param[in] spec Text with properties
+   * @param[out] params Parsed properties
+   * @returns True when text is valid, false otherwise
+   * */
+  static bool Parse(const std::string &spec, SyntheticParams &params);
+
+  /**
+   * Generate next row of image
+   * @param[out] row Pixels of row, width of image is allocated
+   * */
+  void NextRow(uint8_t *row);
+
+  /**
+   * Generate whole image
+   * @param[out] pixels Pixels of image, row after row
+   * */
+  void Generate(std::vector<uint8_t> &pixels);
+};
+
+#endif
@@ -0,0 +1,358 @@
+/**
+ * Author: Matúš Škuta (xskuta04)
+ * Date created: 18.10.2026
+ * Name: tune.cpp
+ * Description: Tool that compresses corpus of images with each mode of compression, measures ratio
+ * and speed of each mode and saves Pareto-optimal modes into profile loaded by --profile
+ * */
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <iomanip>  // setw, setprecision
+#include <unistd.h> // getopt
+#include <cstdint>  // uint8_t, uint32_t, uint64_t
+#include <cstring>  // memcmp
+#include <vector>   // vector
+#include <chrono>   // steady_clock
+#include <algorithm> // min, sort
+
+#include "../src/data_worker.hpp"
+#include "../src/image_codec.hpp"
+#include "../src/tiles/tiles_compressor.hpp"
+#include "../src/tiles/tiles_decompressor.hpp"
+#include "../src/tiles/tile_workers.hpp"
+#include "../src/profile/compression_profile.hpp"
+#include "corpus.hpp"
+
+// Number of modes with adaptive huffman code tried besides modes on Pareto front of static huffman code
+constexpr uint8_t TUNE_ADAPTIVE_EXTRA = 3;
+
+/**
+ * Settings of tool, given by arguments
+ * @param input_files Images given by -i as <filename>:<width>
+ * @param synthetic_specs Synthetic images given by -g, generated in memory
+ * @param width Number specified in -w param, used for images without width
+ * @param output_file Name of profile specified in -o param
+ * @param tile_sizes Sizes of tiles given by -t, 0 codes whole image
+ * @param thread_counts Numbers of threads coding tiles given by -T
+ * @param repetitions Number specified in -r param, the fastest repetition is measured
+ * @param static_only True when param -s is present, modes with adaptive huffman code are not tried
+ * */
+typedef struct TuneArguments {
+  std::vector<std::string> input_files;
+  std::vector<std::string> synthetic_specs;
+  uint32_t width;
+  std::string output_file;
+  std::vector<uint32_t> tile_sizes;
+  std::vector<uint32_t> thread_counts;
+  uint32_t repetitions;
+  bool static_only;
+} TuneArguments;
+
+/**
+ * Print help of tool
+ * */
+void print_help() {
+  std::cout << "Usage: ./huff_tune -i <file>:<width> [-i <file>:<width> ...] [-g <synthetic> ...] -o <profile> [-w <width>] [-t <sizes>] "
+    "[-T <threads>] [-r <repetitions>] [-s]" << std::endl
+    << "  -i <file>:<width>   raw image of corpus, width can be given by -w for all images" << std::endl
+    << "  -g <synthetic>      synthetic image generated in memory, as by ./huff_generate, corpus for all" << std::endl
+    << "  -o <profile>        file, where Pareto-optimal modes are saved, loaded by ./huff_codec --profile" << std::endl
+    << "  -t <sizes>          comma separated sizes of tiles, 0 codes whole image (default 0,64,128,256)" << std::endl
+    << "  -T <threads>        comma separated numbers of threads coding tiles, 0 for all hardware threads (default 1)" << std::endl
+    << "  -r <repetitions>    number of repetitions of each measurement, the fastest is used (default 1)" << std::endl
+    << "  -s                  try only modes with static huffman code" << std::endl;
+}
+
+/**
+ * Function will parse arguments and assign their values to given structure
+ * @param[in] argc Number of arguments
+ * @param[in] argv Array of arguments
+ * @param[out] arguments Structure holding values of all arguments
+ * @return True when all arguments were rightly formatted, false otherwise
+ **/
+bool parse_arguments(const int &argc, char* argv[], TuneArguments &arguments) {
+  arguments.width = 0;
+  arguments.output_file = "";
+  arguments.tile_sizes = {0, 64, 128, TILES_DEFAULT_SIZE};
+  arguments.thread_counts = {1};
+  arguments.repetitions = 1;
+  arguments.static_only = false;
+
+  int opt;
+  while ((opt = getopt(argc, argv, ":i:g:o:w:t:T:r:sh")) != -1) {
+    switch (opt) {
+      case 'i':
+        arguments.input_files.push_back(optarg);
+        break;
+      case 'g':
+        arguments.synthetic_specs.push_back(optarg);
+        break;
+      case 'o':
+        arguments.output_file = optarg;
+        break;
+      case 'w':
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.width;
+        }
+        break;
+      case 't':
+        {
+          arguments.tile_sizes.clear();
+          std::stringstream sstream(optarg);
+          std::string size;
+          while (std::getline(sstream, size, ',')) {
+            std::stringstream size_stream(size);
+            uint32_t tile_size;
+            size_stream >> tile_size;
+            if (size_stream.fail() || (tile_size > 0 && tile_size < 8)) {
+              std::cerr << "Size of tile, needs to be 0 or >= 8!" << std::endl;
+              return false;
+            }
+            arguments.tile_sizes.push_back(tile_size);
+          }
+        }
+        break;
+      case 'T':
+        {
+          arguments.thread_counts.clear();
+          std::stringstream sstream(optarg);
+          std::string count;
+          while (std::getline(sstream, count, ',')) {
+            std::stringstream count_stream(count);
+            int64_t threads = 0;
+            count_stream >> threads;
+            if (count_stream.fail() || threads < 0 || threads > TILE_WORKERS_MAX_THREADS) {
+              std::cerr << "Number of threads, needs to be from 0 to " << TILE_WORKERS_MAX_THREADS << "!" << std::endl;
+              return false;
+            }
+            arguments.thread_counts.push_back((threads == 0) ? TileWorkers::GetHardwareThreads() : static_cast<uint32_t>(threads));
+          }
+        }
+        break;
+      case 'r':
+        {
+          std::stringstream sstream(optarg);
+          sstream >> arguments.repetitions;
+          if (sstream.fail() || arguments.repetitions < 1) {
+            std::cerr << "Number of repetitions, needs to be >= 1!" << std::endl;
+            return false;
+          }
+        }
+        break;
+      case 's':
+        arguments.static_only = true;
+        break;
+      case 'h':
+        print_help();
+        return false;
+      case ':':
+        std::cerr << "Option needs a value" << std::endl;
+        return false;
+      case '?':
+        std::cerr << "Unknown param" << std::endl;
+        return false;
+    }
+  }
+
+  if ((arguments.input_files.empty() && arguments.synthetic_specs.empty()) || arguments.output_file == "" ||
+    arguments.tile_sizes.empty() || arguments.thread_counts.empty())
+  {
+    std::cerr << "At least one input image, output profile, size of tile and number of threads are mandatory!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Compress image with mode
+ * @param[in] entry Mode of compression
+ * @param[in] image Image of corpus
+ * @param[out] encoded Encoded data
+ * */
+void compress_image(const ProfileEntry &entry, const CorpusImage &image, std::vector<uint8_t> &encoded) {
+  const CodecSettings settings = CompressionProfile::GetSettings(entry, {false, false, false, false, BWT_DEFAULT_BLOCK_SIZE, 0, false});
+
+  if (entry.tile_size == 0) {
+    ImageCodec image_codec;
+    image_codec.Compress(image.pixels.data(), image.width, image.height, settings);
+    encoded.assign(image_codec.GetBuffer(), image_codec.GetBuffer() + image_codec.GetSize());
+    return;
+  }
+
+  TilesCompressor tiles_compressor(image.pixels.data(), image.width, image.height);
+  tiles_compressor.SetThreads(entry.threads);
+  tiles_compressor.CompressWithMode(settings, entry.tile_size, entry.predictor);
+  encoded.assign(tiles_compressor.GetBuffer(), tiles_compressor.GetBuffer() + tiles_compressor.GetSize());
+}
+
+/**
+ * Decompress image and compare it with original
+ * @param[in] entry Mode of compression
+ * @param[in] image Image of corpus
+ * @param[in] encoded Encoded data
+ * @returns True when decompressed image is the same as original, false otherwise
+ * */
+bool decompress_image(const ProfileEntry &entry, const CorpusImage &image, std::vector<uint8_t> encoded) {
+  if (entry.tile_size == 0) {
+    ImageCodec image_codec;
+    return image_codec.Decompress(encoded.data(), encoded.size()) && image_codec.GetSize() == image.pixels.size() &&
+      memcmp(image_codec.GetBuffer(), image.pixels.data(), image.pixels.size()) == 0;
+  }
+
+  uint8_t *data = encoded.data();
+  TilesDecompressor tiles_decompressor(data, encoded.size());
+  tiles_decompressor.SetThreads(entry.threads);
+  return tiles_decompressor.ReadHeader() && tiles_decompressor.Decompress() &&
+    tiles_decompressor.GetSize() == image.pixels.size() &&
+    memcmp(tiles_decompressor.GetBuffer(), image.pixels.data(), image.pixels.size()) == 0;
+}
+
+/**
+ * Measure ratio and speed of mode on whole corpus, the fastest repetition is used
+ * @param[in,out] entry Mode of compression, its results are filled
+ * @param[in] corpus Images of corpus
+ * @param[in] repetitions Number of repetitions of each measurement
+ * @returns True when all images were decompressed back, false otherwise
+ * */
+bool measure(ProfileEntry &entry, const std::vector<CorpusImage> &corpus, const uint32_t &repetitions) {
+  uint64_t raw_size = 0;
+  uint64_t encoded_size = 0;
+  double compress_time = 0;
+  double decompress_time = 0;
+
+  for (const CorpusImage &image : corpus) {
+    std::vector<uint8_t> encoded;
+    double best_compress = -1;
+    double best_decompress = -1;
+
+    for (uint32_t i = 0; i < repetitions; i++) {
+      auto start = std::chrono::steady_clock::now();
+      compress_image(entry, image, encoded);
+      const double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      best_compress = (best_compress < 0) ? time : std::min(best_compress, time);
+
+      start = std::chrono::steady_clock::now();
+      if (!decompress_image(entry, image, encoded)) {
+        std::cerr << "Mode " << CompressionProfile::Describe(entry) << " failed to decompress " << image.name << "!" << std::endl;
+        return false;
+      }
+      const double decompress = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      best_decompress = (best_decompress < 0) ? decompress : std::min(best_decompress, decompress);
+    }
+
+    raw_size += image.pixels.size();
+    encoded_size += encoded.size();
+    compress_time += best_compress;
+    decompress_time += best_decompress;
+  }
+
+  // Speeds are in megabytes of raw corpus per second
+  entry.ratio = static_cast<double>(raw_size) / std::max<uint64_t>(encoded_size, 1);
+  entry.compress_speed = raw_size / 1e6 / std::max(compress_time, 1e-9);
+  entry.decompress_speed = raw_size / 1e6 / std::max(decompress_time, 1e-9);
+  return true;
+}
+
+/**
+ * Print measured mode as one row of table
+ * @param[in] entry Measured mode
+ * @param[in] pareto True when mode is on Pareto front
+ * */
+void print_entry(const ProfileEntry &entry, const bool &pareto) {
+  std::cout << (pareto ? "* " : "  ") << std::fixed << std::setprecision(4) << std::setw(8) << entry.ratio
+    << std::setprecision(2) << std::setw(12) << entry.compress_speed << std::setw(12) << entry.decompress_speed
+    << "  " << CompressionProfile::Describe(entry) << std::endl;
+}
+
+/**
+ * Return true when both modes are the same, results are not compared
+ * @param[in] a First mode
+ * @param[in] b Second mode
+ * @returns True when modes are the same
+ * */
+bool same_mode(const ProfileEntry &a, const ProfileEntry &b) {
+  return a.tile_size == b.tile_size && a.predictor == b.predictor && a.scanning == b.scanning &&
+    a.bwt_transform == b.bwt_transform && a.static_huffman == b.static_huffman && a.threads == b.threads;
+}
+
+/**
+ * Main function of tool, modes with static huffman code are measured first, adaptive huffman code,
+ * which is much slower, is measured only for modes on their Pareto front and few modes with the best ratio
+ * @param[in] argc Number of arguments
+ * @param[in] argv Array of arguments
+ * @returns 0 when profile was saved, 1 otherwise
+ * */
+int main(int argc, char* argv[]) {
+  TuneArguments arguments;
+  if (!parse_arguments(argc, argv, arguments)) {
+    return 1;
+  }
+
+  std::vector<CorpusImage> corpus;
+  if (!load_corpus(arguments.input_files, arguments.width, corpus) || !generate_corpus(arguments.synthetic_specs, corpus)) {
+    return 1;
+  }
+
+  // Whole image can be coded only with difference from left pixel on one thread, tiles with any predictor
+  // on each number of threads
+  std::vector<ProfileEntry> modes;
+  for (const uint32_t &tile_size : arguments.tile_sizes) {
+    const uint8_t predictors = (tile_size == 0) ? (TILE_PREDICTOR_LEFT + 1) : (TILE_PREDICTOR_LOWEST_ENTROPY + 1);
+    const std::vector<uint32_t> thread_counts = (tile_size == 0) ? std::vector<uint32_t>{1} : arguments.thread_counts;
+    for (uint8_t predictor = 0; predictor < predictors; predictor++) {
+      for (uint8_t scanning = 0; scanning < PROFILE_SCANNING_COUNT; scanning++) {
+        for (uint8_t bwt = 0; bwt < 2; bwt++) {
+          for (const uint32_t &threads : thread_counts) {
+            modes.push_back({tile_size, predictor, scanning, bwt == 1, true, threads, 0, 0, 0});
+          }
+        }
+      }
+    }
+  }
+
+  std::cout << "  ratio     comp MB/s  decomp MB/s  mode" << std::endl;
+  std::vector<ProfileEntry> measured;
+  for (ProfileEntry &mode : modes) {
+    if (!measure(mode, corpus, arguments.repetitions)) {
+      return 1;
+    }
+    measured.push_back(mode);
+    print_entry(mode, false);
+  }
+
+  if (!arguments.static_only) {
+    // Modes on front of static huffman code and modes with the best ratio are tried with adaptive code
+    std::vector<ProfileEntry> candidates = CompressionProfile::ParetoFront(measured);
+    std::vector<ProfileEntry> by_ratio = measured;
+    std::sort(by_ratio.begin(), by_ratio.end(), [](const ProfileEntry &a, const ProfileEntry &b) { return a.ratio > b.ratio; });
+    for (uint8_t i = 0; i < std::min<size_t>(TUNE_ADAPTIVE_EXTRA, by_ratio.size()); i++) {
+      if (std::none_of(candidates.begin(), candidates.end(), [&](const ProfileEntry &c) { return same_mode(c, by_ratio[i]); })) {
+        candidates.push_back(by_ratio[i]);
+      }
+    }
+
+    for (ProfileEntry mode : candidates) {
+      mode.static_huffman = false;
+      if (!measure(mode, corpus, arguments.repetitions)) {
+        return 1;
+      }
+      measured.push_back(mode);
+      print_entry(mode, false);
+    }
+  }
+
+  CompressionProfile profile;
+  profile.SetEntries(measured);
+  std::cout << std::endl << "Pareto front of " << measured.size() << " modes on " << corpus.size() << " images:" << std::endl;
+  for (const ProfileEntry &entry : profile.GetEntries()) {
+    print_entry(entry, true);
+  }
+
+  if (!profile.Save(arguments.output_file)) {
+    std::cerr << "Failed to write profile to given file." << std::endl;
+    return 1;
+  }
+  return 0;
+}